@@ -0,0 +1,44 @@
+/**
+ * @file
+ * Checks for std::to_chars and std::from_chars and defines HAS_CHARCONV (integral types) and
+ * HAS_CHARCONV_FLOATING_POINT (floating point types) accordingly.
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef A_UTIL_BASE_FEATURE_CHECK_LIBRARY_CHARCONV_H
+#define A_UTIL_BASE_FEATURE_CHECK_LIBRARY_CHARCONV_H
+
+/// @cond INTERNAL_DOCUMENTATION
+
+#if __has_include(<charconv>) &&                                                                  \
+    ((defined(_MSC_VER) && (_MSVC_LANG > 201402L)) || (__cplusplus > 201402L))
+
+#include <charconv>
+
+#define HAS_CHARCONV 1
+
+// only defined by the standard libraries supporting floating point types as well
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#define HAS_CHARCONV_FLOATING_POINT 1
+#else
+#define HAS_CHARCONV_FLOATING_POINT 0
+#endif // defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+
+#else // !__has_include(<charconv>) || C++14
+
+#define HAS_CHARCONV 0
+#define HAS_CHARCONV_FLOATING_POINT 0
+
+#endif // __has_include(<charconv>)
+
+/// @endcond
+
+#endif // A_UTIL_BASE_FEATURE_CHECK_LIBRARY_CHARCONV_H
@@ -43,8 +43,11 @@ namespace chrono {
 
 #include <a_util/concurrency/atomic.h>
 #include <a_util/concurrency/condition_variable.h>
+#include <a_util/concurrency/executor.h>
 #include <a_util/concurrency/fast_mutex.h>
+#include <a_util/concurrency/fast_semaphore.h>
 #include <a_util/concurrency/mutex.h>
+#include <a_util/concurrency/ring_buffer.h>
 #include <a_util/concurrency/semaphore.h>
 #include <a_util/concurrency/shared_mutex.h>
 #include <a_util/concurrency/thread.h>
@@ -0,0 +1,425 @@
+/**
+ * @file
+ * Public API for @ref a_util::concurrency::executor "executor" type
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef A_UTIL_UTIL_CONCURRENCY_EXECUTOR_HEADER_INCLUDED
+#define A_UTIL_UTIL_CONCURRENCY_EXECUTOR_HEADER_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace a_util {
+namespace concurrency {
+class executor;
+
+namespace detail {
+/// For internal use only. @internal A type erased task of the executor.
+class executor_task {
+public:
+    /// DTOR
+    virtual ~executor_task() = default;
+    /// Runs the task
+    virtual void run() = 0;
+};
+
+/// For internal use only. @internal
+template <typename Function>
+class executor_function_task final : public executor_task {
+public:
+    /// CTOR
+    template <typename Callable>
+    explicit executor_function_task(Callable&& function)
+        : _function(std::forward<Callable>(function))
+    {
+    }
+    void run() override
+    {
+        _function();
+    }
+
+private:
+    Function _function;
+};
+
+/// For internal use only. @internal
+template <typename Function>
+std::unique_ptr<executor_task> make_executor_task(Function&& function)
+{
+    using Task = executor_function_task<typename std::decay<Function>::type>;
+    return std::unique_ptr<executor_task>(new Task(std::forward<Function>(function)));
+}
+
+/**
+ * For internal use only. @internal The continuations of a submitted task, they are scheduled
+ * when the task completed.
+ */
+class executor_continuations {
+public:
+    /// CTOR
+    explicit executor_continuations(executor& owner);
+    /// Schedules the continuation, immediately if the task already completed
+    void add(std::unique_ptr<executor_task> continuation);
+    /// Marks the task as completed and schedules all continuations added so far
+    void complete();
+    /// Gets the executor running the task and its continuations
+    executor& get_executor() const;
+
+private:
+    executor& _executor;
+    std::mutex _mutex;
+    bool _completed;
+    std::vector<std::unique_ptr<executor_task>> _continuations;
+};
+
+/// For internal use only. @internal
+template <typename Function, typename... Args>
+using executor_result_t =
+    decltype(std::declval<typename std::decay<Function>::type&>()(std::declval<Args>()...));
+
+} // namespace detail
+
+/**
+ * The result of a task submitted to an @ref executor.
+ * In addition to a <a href="https://en.cppreference.com/w/cpp/thread/shared_future">
+ * std::shared_future</a> it allows to run continuations on the executor when the task completed,
+ * without blocking a thread meanwhile.
+ * @tparam T The result type of the task.
+ */
+template <typename T>
+class task_future {
+public:
+    /// CTOR - creates an invalid future
+    task_future() = default;
+
+    /**
+     * Check whether the future refers to a task
+     * @return @c true if the future refers to a task, @c false if default constructed.
+     */
+    bool valid() const
+    {
+        return _future.valid();
+    }
+
+    /// Blocks until the task completed
+    void wait() const
+    {
+        _future.wait();
+    }
+
+    /**
+     * Blocks until the task completed or the timeout expired
+     * @param[in] timeout The maximum time to wait.
+     * @return The state of the task, see
+     *         <a href="https://en.cppreference.com/w/cpp/thread/future_status">
+     *         std::future_status</a>.
+     */
+    template <typename Rep, typename Period>
+    std::future_status wait_for(const std::chrono::duration<Rep, Period>& timeout) const
+    {
+        return _future.wait_for(timeout);
+    }
+
+    /**
+     * Blocks until the task completed and gets its result
+     * @return The result of the task.
+     * @throw The exception thrown by the task.
+     */
+    decltype(std::declval<const std::shared_future<T>&>().get()) get() const
+    {
+        return _future.get();
+    }
+
+    /**
+     * Runs a continuation on the executor of the task after the task completed
+     * @param[in] continuation Function called with this future, which is ready then. The
+     *                         continuation should call @c get() to receive the result or the
+     *                         exception of the task.
+     * @return The future of the continuation.
+     * @pre @ref valid() returns @c true.
+     */
+    template <typename Function>
+    task_future<detail::executor_result_t<Function, task_future<T>>> then(
+        Function&& continuation) const;
+
+private:
+    /// For internal use only. @internal
+    friend class executor;
+    /// For internal use only. @internal
+    template <typename>
+    friend class task_future;
+    /// For internal use only. @internal
+    task_future(std::shared_future<T> future,
+                std::shared_ptr<detail::executor_continuations> continuations)
+        : _future(std::move(future)), _continuations(std::move(continuations))
+    {
+    }
+
+    std::shared_future<T> _future;
+    std::shared_ptr<detail::executor_continuations> _continuations;
+};
+
+/// Options of an @ref executor
+struct executor_options {
+    /// The amount of worker threads, 0 uses std::thread::hardware_concurrency().
+    std::size_t thread_count = 0;
+    /**
+     * The maximum amount of queued tasks submitted from outside of the workers, 0 for no limit.
+     * Submitting blocks (or fails with the @c try_ functions) while the limit is reached.
+     * Tasks submitted by tasks are never limited, since a blocked worker might be the one who
+     * had to process the queue.
+     */
+    std::size_t max_queued_tasks = 0;
+    /**
+     * Name of the worker threads, the worker index is appended. Only supported on Linux, where
+     * the name is truncated to 15 characters.
+     */
+    std::string thread_name = "a_util_exec";
+    /// Pins worker i to the i-th CPU (modulo the amount of CPUs) available to the process.
+    bool pin_threads = false;
+};
+
+/**
+ * A work stealing thread pool.
+ *
+ * Every worker has its own lock-free deque. Tasks submitted by a task are pushed to the deque of
+ * the worker running it and processed in LIFO order for cache locality, idle workers steal the
+ * oldest tasks of other workers. Tasks submitted from outside of the workers are queued in a
+ * shared FIFO queue. Idle workers sleep until a task is submitted.
+ *
+ * The destructor waits until all queued tasks completed, tasks may submit further tasks until
+ * then. Submitting from other threads during destruction is not allowed.
+ */
+class executor {
+    executor(const executor&);            // = delete;
+    executor& operator=(const executor&); // = delete;
+
+public:
+    /// CTOR - starts std::thread::hardware_concurrency() workers
+    executor();
+
+    /**
+     * CTOR
+     * @param[in] options The options of the thread pool.
+     */
+    explicit executor(const executor_options& options);
+
+    /// DTOR - runs all queued tasks and joins the workers
+    ~executor();
+
+    /**
+     * Gets the amount of worker threads
+     * @return The amount of worker threads.
+     */
+    std::size_t thread_count() const;
+
+    /**
+     * Queues a task without result, blocks while the queue limit is reached.
+     * This is the cheapest way to run a task.
+     * @param[in] function The task, exceptions thrown by it are discarded.
+     */
+    template <typename Function>
+    void post(Function&& function)
+    {
+        schedule(detail::make_executor_task(std::forward<Function>(function)), true);
+    }
+
+    /**
+     * Queues a task without result if the queue limit is not reached.
+     * @param[in] function The task, exceptions thrown by it are discarded.
+     * @return @c true if the task was queued, @c false if the queue limit is reached.
+     */
+    template <typename Function>
+    bool try_post(Function&& function)
+    {
+        return schedule(detail::make_executor_task(std::forward<Function>(function)), false);
+    }
+
+    /**
+     * Queues a task, blocks while the queue limit is reached.
+     * @param[in] function The task.
+     * @return The future of the task, providing its result or exception.
+     */
+    template <typename Function>
+    task_future<detail::executor_result_t<Function>> submit(Function&& function)
+    {
+        task_future<detail::executor_result_t<Function>> future;
+        submit_task(std::forward<Function>(function), future, true);
+        return future;
+    }
+
+    /**
+     * Queues a task if the queue limit is not reached.
+     * @param[in] function The task.
+     * @return The future of the task, invalid if the queue limit is reached.
+     */
+    template <typename Function>
+    task_future<detail::executor_result_t<Function>> try_submit(Function&& function)
+    {
+        task_future<detail::executor_result_t<Function>> future;
+        if (!submit_task(std::forward<Function>(function), future, false)) {
+            return {};
+        }
+        return future;
+    }
+
+    /**
+     * Calls a function for all indices of a range, distributed to the workers in chunks.
+     * The calling thread processes chunks as well and blocks until all indices were processed, so
+     * this may be called by tasks, too.
+     * @param[in] begin The first index.
+     * @param[in] end The index behind the last index.
+     * @param[in] function Function called with every index (as std::size_t).
+     * @param[in] grain_size The amount of indices processed in a row, 0 chooses a size resulting
+     *                       in about 8 chunks per worker.
+     * @throw The first exception thrown by @c function, after all indices were processed.
+     */
+    template <typename Function>
+    void parallel_for(std::size_t begin,
+                      std::size_t end,
+                      Function&& function,
+                      std::size_t grain_size = 0);
+
+private:
+    /// For internal use only. @internal
+    friend class detail::executor_continuations;
+    /// For internal use only. @internal
+    bool schedule(std::unique_ptr<detail::executor_task> task, bool wait_for_space);
+
+    /// For internal use only. @internal
+    template <typename Function, typename Result>
+    bool submit_task(Function&& function, task_future<Result>& future, bool wait_for_space)
+    {
+        std::packaged_task<Result()> task(std::forward<Function>(function));
+        auto continuations = std::make_shared<detail::executor_continuations>(*this);
+        task_future<Result> result(task.get_future().share(), continuations);
+        auto run = [task = std::move(task), continuations]() mutable {
+            task();
+            continuations->complete();
+        };
+        if (!schedule(detail::make_executor_task(std::move(run)), wait_for_space)) {
+            return false;
+        }
+        future = std::move(result);
+        return true;
+    }
+
+    class Implementation;
+    std::unique_ptr<Implementation> _impl;
+};
+
+template <typename T>
+template <typename Function>
+task_future<detail::executor_result_t<Function, task_future<T>>> task_future<T>::then(
+    Function&& continuation) const
+{
+    using Result = detail::executor_result_t<Function, task_future<T>>;
+    std::packaged_task<Result()> task(
+        [antecedent = *this, continuation = std::forward<Function>(continuation)]() mutable {
+            return continuation(antecedent);
+        });
+    auto continuations =
+        std::make_shared<detail::executor_continuations>(_continuations->get_executor());
+    task_future<Result> result(task.get_future().share(), continuations);
+    _continuations->add(
+        detail::make_executor_task([task = std::move(task), continuations]() mutable {
+            task();
+            continuations->complete();
+        }));
+    return result;
+}
+
+template <typename Function>
+void executor::parallel_for(std::size_t begin,
+                            std::size_t end,
+                            Function&& function,
+                            std::size_t grain_size)
+{
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t count = end - begin;
+    if (grain_size == 0) {
+        grain_size = std::max<std::size_t>(1, count / (thread_count() * 8));
+    }
+    struct State {
+        std::size_t chunk_count;
+        std::atomic<std::size_t> next_chunk{0};
+        std::atomic<std::size_t> remaining_chunks;
+        std::mutex mutex;
+        std::condition_variable done;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<State>();
+    state->chunk_count = (count + grain_size - 1) / grain_size;
+    state->remaining_chunks = state->chunk_count;
+
+    // the function is only called for claimed chunks and the caller waits until these completed,
+    // so helpers starting after all chunks were claimed do not access it anymore
+    auto* const callable = &function;
+    auto run_chunks = [state, callable, begin, end, grain_size]() {
+        for (;;) {
+            const std::size_t chunk = state->next_chunk.fetch_add(1);
+            if (chunk >= state->chunk_count) {
+                return;
+            }
+            const std::size_t first = begin + chunk * grain_size;
+            const std::size_t last = std::min(end, first + grain_size);
+            try {
+                for (std::size_t index = first; index < last; ++index) {
+                    (*callable)(index);
+                }
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (!state->error) {
+                    state->error = std::current_exception();
+                }
+            }
+            if (state->remaining_chunks.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->done.notify_all();
+            }
+        }
+    };
+
+    // helpers are only queued if there is space, the caller processes all chunks otherwise
+    const std::size_t helper_count = std::min(thread_count(), state->chunk_count - 1);
+    for (std::size_t helper = 0; helper < helper_count; ++helper) {
+        if (!try_post(run_chunks)) {
+            break;
+        }
+    }
+    run_chunks();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() { return state->remaining_chunks.load() == 0; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} // namespace concurrency
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_CONCURRENCY_EXECUTOR_HEADER_INCLUDED
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * Public API for @ref a_util::concurrency::fast_semaphore "fast_semaphore" type
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef A_UTIL_UTIL_CONCURRENCY_FAST_SEMAPHORE_HEADER_INCLUDED
+#define A_UTIL_UTIL_CONCURRENCY_FAST_SEMAPHORE_HEADER_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+namespace a_util {
+namespace concurrency {
+/**
+ * Lightweight counting semaphore with the interface of @ref a_util::concurrency::semaphore
+ *
+ * The counter is a single atomic value, so notifying and waiting on a non-zero counter is one
+ * atomic operation and never blocks. A waiter on a zero counter spins shortly before it sleeps,
+ * sleeping waiters are woken one by one, using a futex on Linux and a condition variable on
+ * other platforms.
+ */
+class fast_semaphore {
+    fast_semaphore(const fast_semaphore&);            // = delete;
+    fast_semaphore& operator=(const fast_semaphore&); // = delete;
+
+public:
+    /**
+     * CTOR
+     * @param[in] count Initial value of the counter
+     */
+    explicit fast_semaphore(int count = 0) : _count(count), _wakeups(0)
+    {
+    }
+
+    /// Increment the counter and wake up one waiter, if any
+    void notify()
+    {
+        if (_count.fetch_add(1, std::memory_order_release) < 0) {
+            wakeOne();
+        }
+    }
+
+    /// Decrement the counter, blocks until the count becomes non-zero (if neccessary)
+    void wait()
+    {
+        if (!try_wait()) {
+            waitContended();
+        }
+    }
+
+    /**
+     * Try decrementing the counter
+     * @return @c true if the counter is greater than zero, @c false otherwise
+     */
+    bool try_wait()
+    {
+        std::int32_t count = _count.load(std::memory_order_relaxed);
+        while (count > 0) {
+            if (_count.compare_exchange_weak(
+                    count, count - 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Wait for a specified duration of time and decrement the counter afterwards
+     * @tparam Rep An arithmetic type representing the number of ticks
+     * @tparam std::ratio representing the tick period (i.e. the number of seconds per tick)
+     * @param[in] timeout The duration to wait.
+     * @throw std::invalid_argument If <tt>timeout.count < 0</tt>
+     * @return @c true if the counter could be decreased after the waiting time, @c false otherwise
+     */
+    template <typename Rep, typename Period>
+    bool wait_for(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        if (timeout.count() < 0) {
+            throw std::invalid_argument("timeout.count() < 0");
+        }
+        return try_wait() ||
+               waitForContended(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    }
+
+    /// Reset the counter to 0
+    void reset();
+
+    /**
+     * Check whether the counter is set.
+     * @return @c true if the counter is greater than zero, @c false otherwise.
+     */
+    bool is_set() const
+    {
+        return _count.load(std::memory_order_relaxed) > 0;
+    }
+
+private:
+    void wakeOne();
+    void waitContended();
+    bool waitForContended(std::chrono::nanoseconds timeout);
+    bool spin();
+    bool tryConsumeWakeup();
+
+    /// the counter, a negative value is the negated number of sleeping waiters
+    std::atomic<std::int32_t> _count;
+    /// wake ups granted to sleeping waiters but not yet consumed, the futex word
+    std::atomic<std::uint32_t> _wakeups;
+};
+
+} // namespace concurrency
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_CONCURRENCY_FAST_SEMAPHORE_HEADER_INCLUDED
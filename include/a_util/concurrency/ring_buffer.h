@@ -0,0 +1,632 @@
+/**
+ * @file
+ * Public API for @ref a_util::concurrency::spsc_ring_buffer "spsc_ring_buffer",
+ * @ref a_util::concurrency::mpmc_ring_buffer "mpmc_ring_buffer" and
+ * @ref a_util::concurrency::blocking_ring_buffer "blocking_ring_buffer" types
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef A_UTIL_UTIL_CONCURRENCY_RING_BUFFER_HEADER_INCLUDED
+#define A_UTIL_UTIL_CONCURRENCY_RING_BUFFER_HEADER_INCLUDED
+
+#include <a_util/concurrency/fast_semaphore.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace a_util {
+namespace concurrency {
+namespace detail {
+/// For internal use only. @internal Size of a cache line, the indices are padded to it
+constexpr std::size_t cache_line_size = 64;
+
+/// For internal use only. @internal
+inline std::size_t ring_buffer_capacity(std::size_t capacity)
+{
+    std::size_t power_of_2 = 1;
+    while (power_of_2 < capacity) {
+        power_of_2 <<= 1;
+    }
+    return power_of_2;
+}
+
+/// For internal use only. @internal Uninitialized storage of one element
+template <typename T>
+struct ring_buffer_storage {
+    alignas(T) unsigned char data[sizeof(T)];
+
+    T* get()
+    {
+        return reinterpret_cast<T*>(data);
+    }
+};
+
+} // namespace detail
+
+/**
+ * Lock-free bounded FIFO queue for exactly one producer and one consumer thread.
+ *
+ * The producer and the consumer index are on separate cache lines, each side keeps a cached copy
+ * of the other index and only reloads it if the buffer seems full or empty, so pushing and
+ * popping usually touch no cache line written by the other side. Batch operations publish all
+ * elements with a single index update.
+ * @tparam T The element type, popped elements are move assigned to the destination.
+ */
+template <typename T>
+class spsc_ring_buffer {
+    spsc_ring_buffer(const spsc_ring_buffer&);            // = delete;
+    spsc_ring_buffer& operator=(const spsc_ring_buffer&); // = delete;
+
+public:
+    /// The element type
+    typedef T value_type;
+
+    /**
+     * CTOR
+     * @param[in] capacity The minimum amount of elements, rounded up to the next power of 2.
+     */
+    explicit spsc_ring_buffer(std::size_t capacity)
+        : _capacity(detail::ring_buffer_capacity(capacity)),
+          _slots(new detail::ring_buffer_storage<T>[_capacity])
+    {
+    }
+
+    /// DTOR - destroys the remaining elements
+    ~spsc_ring_buffer()
+    {
+        while (front()) {
+            pop();
+        }
+    }
+
+    /**
+     * Constructs an element in place (producer only)
+     * @param[in] args The arguments of the element constructor.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const std::size_t tail = _producer.tail.load(std::memory_order_relaxed);
+        if (tail - _producer.cached_head == _capacity) {
+            _producer.cached_head = _consumer.head.load(std::memory_order_acquire);
+            if (tail - _producer.cached_head == _capacity) {
+                return false;
+            }
+        }
+        new (slot(tail)) T(std::forward<Args>(args)...);
+        _producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Copies an element into the buffer (producer only)
+     * @param[in] value The element.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    /**
+     * Moves an element into the buffer (producer only)
+     * @param[in] value The element.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * Copies as many elements as fit into the buffer (producer only)
+     * @param[in] first Iterator to the first element.
+     * @param[in] count The amount of elements.
+     * @return The amount of pushed elements.
+     */
+    template <typename InputIterator>
+    std::size_t try_push_n(InputIterator first, std::size_t count)
+    {
+        const std::size_t tail = _producer.tail.load(std::memory_order_relaxed);
+        if (tail - _producer.cached_head + count > _capacity) {
+            _producer.cached_head = _consumer.head.load(std::memory_order_acquire);
+        }
+        const std::size_t pushed = std::min(count, _capacity - (tail - _producer.cached_head));
+        for (std::size_t index = 0; index < pushed; ++index, ++first) {
+            new (slot(tail + index)) T(*first);
+        }
+        _producer.tail.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    /**
+     * Moves the oldest element out of the buffer (consumer only)
+     * @param[out] value The element.
+     * @return @c true if popped, @c false if the buffer is empty.
+     */
+    bool try_pop(T& value)
+    {
+        T* const element = front();
+        if (!element) {
+            return false;
+        }
+        value = std::move(*element);
+        pop();
+        return true;
+    }
+
+    /**
+     * Moves as many elements as available out of the buffer (consumer only)
+     * @param[out] first Iterator to the first element to assign.
+     * @param[in] max_count The maximum amount of elements.
+     * @return The amount of popped elements.
+     */
+    template <typename OutputIterator>
+    std::size_t try_pop_n(OutputIterator first, std::size_t max_count)
+    {
+        const std::size_t head = _consumer.head.load(std::memory_order_relaxed);
+        if (_consumer.cached_tail - head < max_count) {
+            _consumer.cached_tail = _producer.tail.load(std::memory_order_acquire);
+        }
+        const std::size_t popped = std::min(max_count, _consumer.cached_tail - head);
+        for (std::size_t index = 0; index < popped; ++index, ++first) {
+            T* const element = slot(head + index);
+            *first = std::move(*element);
+            element->~T();
+        }
+        _consumer.head.store(head + popped, std::memory_order_release);
+        return popped;
+    }
+
+    /**
+     * Gets the oldest element to process it in place (consumer only)
+     * @return The oldest element, @c nullptr if the buffer is empty.
+     */
+    T* front()
+    {
+        const std::size_t head = _consumer.head.load(std::memory_order_relaxed);
+        if (head == _consumer.cached_tail) {
+            _consumer.cached_tail = _producer.tail.load(std::memory_order_acquire);
+            if (head == _consumer.cached_tail) {
+                return nullptr;
+            }
+        }
+        return slot(head);
+    }
+
+    /// Destroys the oldest element (consumer only), @ref front() must have returned an element.
+    void pop()
+    {
+        const std::size_t head = _consumer.head.load(std::memory_order_relaxed);
+        slot(head)->~T();
+        _consumer.head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * Gets the amount of elements, only a snapshot if the other side is active
+     * @return The amount of elements.
+     */
+    std::size_t size() const
+    {
+        const std::size_t head = _consumer.head.load(std::memory_order_acquire);
+        return _producer.tail.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * Check whether the buffer is empty, only a snapshot if the other side is active
+     * @return @c true if empty, @c false otherwise.
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Gets the maximum amount of elements
+     * @return The maximum amount of elements.
+     */
+    std::size_t capacity() const
+    {
+        return _capacity;
+    }
+
+private:
+    T* slot(std::size_t index)
+    {
+        return _slots[index & (_capacity - 1)].get();
+    }
+
+    struct alignas(detail::cache_line_size) Producer {
+        std::atomic<std::size_t> tail{0};
+        std::size_t cached_head = 0;
+    };
+    struct alignas(detail::cache_line_size) Consumer {
+        std::atomic<std::size_t> head{0};
+        std::size_t cached_tail = 0;
+    };
+
+    const std::size_t _capacity;
+    const std::unique_ptr<detail::ring_buffer_storage<T>[]> _slots;
+    Producer _producer;
+    Consumer _consumer;
+};
+
+/**
+ * Lock-free bounded FIFO queue for any amount of producer and consumer threads.
+ *
+ * Every slot has a sequence number telling producers and consumers whose turn it is, a push or
+ * pop claims its slot with a single compare and swap of the (cache line padded) producer or
+ * consumer index (D. Vyukov's bounded MPMC queue). Elements are popped in the order their push
+ * claimed a slot, so the elements of one producer are popped in the order pushed.
+ * @tparam T The element type, popped elements are move assigned to the destination.
+ */
+template <typename T>
+class mpmc_ring_buffer {
+    mpmc_ring_buffer(const mpmc_ring_buffer&);            // = delete;
+    mpmc_ring_buffer& operator=(const mpmc_ring_buffer&); // = delete;
+
+public:
+    /// The element type
+    typedef T value_type;
+
+    /**
+     * CTOR
+     * @param[in] capacity The minimum amount of elements, rounded up to the next power of 2.
+     */
+    explicit mpmc_ring_buffer(std::size_t capacity)
+        : _capacity(detail::ring_buffer_capacity(capacity)), _slots(new Slot[_capacity])
+    {
+        for (std::size_t index = 0; index < _capacity; ++index) {
+            _slots[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    /// DTOR - destroys the remaining elements
+    ~mpmc_ring_buffer()
+    {
+        const std::size_t tail = _tail.value.load(std::memory_order_relaxed);
+        for (std::size_t head = _head.value.load(std::memory_order_relaxed); head != tail; ++head) {
+            _slots[head & (_capacity - 1)].storage.get()->~T();
+        }
+    }
+
+    /**
+     * Constructs an element in place
+     * @param[in] args The arguments of the element constructor.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    template <typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        std::size_t tail = _tail.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& current = _slots[tail & (_capacity - 1)];
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(
+                current.sequence.load(std::memory_order_acquire) - tail);
+            if (difference == 0) {
+                if (_tail.value.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    new (current.storage.get()) T(std::forward<Args>(args)...);
+                    current.sequence.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                // the slot still holds the element pushed one round before
+                return false;
+            }
+            else {
+                tail = _tail.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Copies an element into the buffer
+     * @param[in] value The element.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    /**
+     * Moves an element into the buffer
+     * @param[in] value The element.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * Copies elements into the buffer until it is full. Elements of other producers may be pushed
+     * in between.
+     * @param[in] first Iterator to the first element.
+     * @param[in] count The amount of elements.
+     * @return The amount of pushed elements.
+     */
+    template <typename InputIterator>
+    std::size_t try_push_n(InputIterator first, std::size_t count)
+    {
+        std::size_t pushed = 0;
+        while (pushed < count && try_emplace(*first)) {
+            ++pushed;
+            ++first;
+        }
+        return pushed;
+    }
+
+    /**
+     * Moves the oldest element out of the buffer
+     * @param[out] value The element.
+     * @return @c true if popped, @c false if the buffer is empty.
+     */
+    bool try_pop(T& value)
+    {
+        std::size_t head = _head.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& current = _slots[head & (_capacity - 1)];
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(
+                current.sequence.load(std::memory_order_acquire) - (head + 1));
+            if (difference == 0) {
+                if (_head.value.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                    T* const element = current.storage.get();
+                    value = std::move(*element);
+                    element->~T();
+                    current.sequence.store(head + _capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                // nothing pushed (or the push is still in progress)
+                return false;
+            }
+            else {
+                head = _head.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Moves elements out of the buffer until it is empty
+     * @param[out] first Iterator to the first element to assign.
+     * @param[in] max_count The maximum amount of elements.
+     * @return The amount of popped elements.
+     */
+    template <typename OutputIterator>
+    std::size_t try_pop_n(OutputIterator first, std::size_t max_count)
+    {
+        std::size_t popped = 0;
+        while (popped < max_count && try_pop(*first)) {
+            ++popped;
+            ++first;
+        }
+        return popped;
+    }
+
+    /**
+     * Gets the amount of elements, only a snapshot while other threads are active
+     * @return The amount of elements (including pushes and pops in progress).
+     */
+    std::size_t size() const
+    {
+        const std::size_t head = _head.value.load(std::memory_order_acquire);
+        const std::size_t tail = _tail.value.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /**
+     * Check whether the buffer is empty, only a snapshot while other threads are active
+     * @return @c true if empty, @c false otherwise.
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * Gets the maximum amount of elements
+     * @return The maximum amount of elements.
+     */
+    std::size_t capacity() const
+    {
+        return _capacity;
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        detail::ring_buffer_storage<T> storage;
+    };
+    struct alignas(detail::cache_line_size) Index {
+        std::atomic<std::size_t> value{0};
+    };
+
+    const std::size_t _capacity;
+    const std::unique_ptr<Slot[]> _slots;
+    Index _tail;
+    Index _head;
+};
+
+/**
+ * Blocking wrapper of a ring buffer, counting the free slots and the elements with semaphores.
+ * The threading restrictions of the ring buffer apply (i.e. one producer and one consumer for
+ * @ref spsc_ring_buffer).
+ * @tparam RingBuffer The ring buffer, @ref spsc_ring_buffer or @ref mpmc_ring_buffer.
+ * @tparam Semaphore The semaphore type, see @ref a_util::concurrency::fast_semaphore.
+ */
+template <typename RingBuffer, typename Semaphore = fast_semaphore>
+class blocking_ring_buffer {
+    blocking_ring_buffer(const blocking_ring_buffer&);            // = delete;
+    blocking_ring_buffer& operator=(const blocking_ring_buffer&); // = delete;
+
+public:
+    /// The element type
+    typedef typename RingBuffer::value_type value_type;
+
+    /**
+     * CTOR
+     * @param[in] capacity The minimum amount of elements, rounded up to the next power of 2.
+     */
+    explicit blocking_ring_buffer(std::size_t capacity)
+        : _ring_buffer(capacity),
+          _free_slots(static_cast<int>(_ring_buffer.capacity())),
+          _elements(0)
+    {
+    }
+
+    /**
+     * Constructs an element in place, blocks while the buffer is full
+     * @param[in] args The arguments of the element constructor.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args)
+    {
+        _free_slots.wait();
+        emplaceIntoFreeSlot(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Copies an element into the buffer, blocks while the buffer is full
+     * @param[in] value The element.
+     */
+    void push(const value_type& value)
+    {
+        emplace(value);
+    }
+
+    /**
+     * Moves an element into the buffer, blocks while the buffer is full
+     * @param[in] value The element.
+     */
+    void push(value_type&& value)
+    {
+        emplace(std::move(value));
+    }
+
+    /**
+     * Copies an element into the buffer if it is not full
+     * @param[in] value The element.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    bool try_push(const value_type& value)
+    {
+        if (!_free_slots.try_wait()) {
+            return false;
+        }
+        emplaceIntoFreeSlot(value);
+        return true;
+    }
+
+    /**
+     * Moves an element into the buffer if it is not full
+     * @param[in] value The element.
+     * @return @c true if pushed, @c false if the buffer is full.
+     */
+    bool try_push(value_type&& value)
+    {
+        if (!_free_slots.try_wait()) {
+            return false;
+        }
+        emplaceIntoFreeSlot(std::move(value));
+        return true;
+    }
+
+    /**
+     * Moves the oldest element out of the buffer, blocks while the buffer is empty
+     * @param[out] value The element.
+     */
+    void pop(value_type& value)
+    {
+        _elements.wait();
+        popAvailable(value);
+    }
+
+    /**
+     * Moves the oldest element out of the buffer if it is not empty
+     * @param[out] value The element.
+     * @return @c true if popped, @c false if the buffer is empty.
+     */
+    bool try_pop(value_type& value)
+    {
+        if (!_elements.try_wait()) {
+            return false;
+        }
+        popAvailable(value);
+        return true;
+    }
+
+    /**
+     * Moves the oldest element out of the buffer, blocks while the buffer is empty at most for
+     * @c timeout
+     * @param[out] value The element.
+     * @param[in] timeout The maximum time to wait.
+     * @return @c true if popped, @c false if the buffer stayed empty.
+     * @throw std::invalid_argument If <tt>timeout.count < 0</tt>
+     */
+    template <typename Rep, typename Period>
+    bool pop_for(value_type& value, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        if (!_elements.wait_for(timeout)) {
+            return false;
+        }
+        popAvailable(value);
+        return true;
+    }
+
+    /**
+     * Gets the maximum amount of elements
+     * @return The maximum amount of elements.
+     */
+    std::size_t capacity() const
+    {
+        return _ring_buffer.capacity();
+    }
+
+private:
+    template <typename... Args>
+    void emplaceIntoFreeSlot(Args&&... args)
+    {
+        // a free slot might still be read by a consumer which claimed it before the one freeing
+        // the counted slot, so retry shortly
+        while (!_ring_buffer.try_emplace(std::forward<Args>(args)...)) {
+            std::this_thread::yield();
+        }
+        _elements.notify();
+    }
+
+    void popAvailable(value_type& value)
+    {
+        // see emplaceIntoFreeSlot(), the counted element might not be the next one
+        while (!_ring_buffer.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        _free_slots.notify();
+    }
+
+    RingBuffer _ring_buffer;
+    Semaphore _free_slots;
+    Semaphore _elements;
+};
+
+} // namespace concurrency
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_CONCURRENCY_RING_BUFFER_HEADER_INCLUDED
@@ -21,7 +21,11 @@ namespace a_util {
 namespace concurrency {
 /**
  * A shared_mutex class as a workaround for std::shared_timed_mutex
- * @see https://stackoverflow.com/a/42302130
+ *
+ * The mutex is writer-preferring: As soon as a writer waits, new readers wait until the writer
+ * unlocked, so writers do not starve on continuously overlapping readers. The lock state is a
+ * single atomic word, uncontended locking and unlocking is one atomic operation and waiting
+ * threads sleep in a futex wait on Linux.
  */
 class shared_mutex {
     shared_mutex(const shared_mutex&);            // = delete;
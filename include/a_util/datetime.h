@@ -21,6 +21,7 @@ namespace datetime {
 }
 } // namespace a_util
 
+#include <a_util/datetime/clock.h>
 #include <a_util/datetime/datetime.h>
 
 #endif //_A_UTIL_DATETIME_HEADER_INCLUDED_
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * Public API for fast clocks, the cached local time zone offset and the
+ * @ref a_util::datetime::TimestampFormatter "TimestampFormatter"
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef _A_UTILS_UTIL_DATETIME_CLOCK_HEADER_INCLUDED_
+#define _A_UTILS_UTIL_DATETIME_CLOCK_HEADER_INCLUDED_
+
+#include <a_util/base/types.h>        //timestamp_t
+#include <a_util/datetime/datetime.h> //TimestampReference
+
+#include <cstdint> //std::int64_t
+#include <string>  //std::string
+
+namespace a_util {
+namespace datetime {
+/**
+ * Get the time of the monotonic clock, which is not affected by changes of the system time.
+ * @return The microseconds since an unspecified point in time (usually the system start).
+ */
+timestamp_t getMonotonicMicroseconds();
+
+/**
+ * Get the system time (in UTC format).
+ * @return The microseconds since the unix time origin.
+ */
+timestamp_t getRealtimeMicroseconds();
+
+/**
+ * Get the offset of the local time zone to UTC at a point in time.
+ *
+ * The offset is cached per minute, so the time zone database is consulted at most once per minute
+ * for the current time. Changes of the time zone (e.g. of the @c TZ environment variable) are
+ * taken into account with the next minute or immediately after calling @ref refreshTimeZone.
+ * @param[in] unix_time The point in time in microseconds since the unix time origin (UTC).
+ * @return The microseconds to add to @c unix_time to get the local time.
+ */
+timestamp_t getUtcOffset(timestamp_t unix_time);
+
+/// Reload the time zone information and drop the cached UTC offset.
+void refreshTimeZone();
+
+/**
+ * Get the current local time as timestamp without breaking it down into date and time.
+ *
+ * The result equals <tt>getCurrentLocalDateTime().toTimestamp(timestampReference)</tt>.
+ * @param[in] timestampReference The reference point in time of the returned timestamp.
+ * @return The microseconds of the local time since the reference point in time.
+ */
+timestamp_t getCurrentLocalTimestamp(TimestampReference timestampReference =
+                                         TimestampReference::MicroSecondsSinceJulianDateOrigin);
+
+/**
+ * Formats timestamps with a fixed format string.
+ *
+ * Consecutive timestamps of the same second reuse the previously rendered text, so only the first
+ * timestamp of every second is broken down and passed to @c strftime. The timestamps are taken as
+ * they are, there is no conversion from UTC to local time (see @ref getCurrentLocalTimestamp).
+ * @note An instance must not be used by several threads concurrently.
+ */
+class TimestampFormatter {
+public:
+    /**
+     * Constructor
+     * @param[in] format_str The format of the string representation, see @ref DateTime::format.
+     * @param[in] timestampReference The reference point in time of the formatted timestamps.
+     * @throw std::invalid_argument If the format string is invalid
+     */
+    explicit TimestampFormatter(const std::string& format_str,
+                                TimestampReference timestampReference =
+                                    TimestampReference::MicroSecondsSinceJulianDateOrigin);
+
+    /**
+     * Create the string representation of a timestamp.
+     * @param[in] timestamp The timestamp in microseconds since the reference point in time.
+     * @return The formatted string, valid until the next call.
+     */
+    const std::string& format(timestamp_t timestamp);
+
+private:
+    std::string _format;
+    timestamp_t _unix_origin;
+    bool _rendered;
+    std::int64_t _rendered_second;
+    std::string _text;
+};
+
+} // namespace datetime
+} // namespace a_util
+
+#endif // _A_UTILS_UTIL_DATETIME_CLOCK_HEADER_INCLUDED_
@@ -23,6 +23,7 @@ namespace memory {
 
 #include <a_util/memory/memory.h>
 #include <a_util/memory/memorybuffer.h>
+#include <a_util/memory/memorybuffer_pool.h>
 #include <a_util/memory/shared_ptr.h>
 #include <a_util/memory/stack_ptr.h>
 #include <a_util/memory/unique_ptr.h>
@@ -19,6 +19,8 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 namespace a_util {
 namespace memory {
+class MemoryBufferPool;
+
 /// Memory buffer class to encapsulate and manage raw contiguously memory
 class MemoryBuffer {
 public:
@@ -38,6 +40,13 @@ public:
      */
     MemoryBuffer(void* buffer, std::size_t size);
 
+    /**
+     * CTOR with initial size of the buffer allocated from a pool (zero-initialized)
+     * @param[in] initial_size The initial buffer size
+     * @param[in] pool The pool to allocate from
+     */
+    MemoryBuffer(std::size_t initial_size, MemoryBufferPool& pool);
+
     /// DTOR, either detaching any referenced buffer or deleting allocated memory
     ~MemoryBuffer();
 
@@ -62,7 +71,18 @@ public:
     bool allocate(std::size_t new_size);
 
     /**
-     * Reset the memory (freeing or detaching any managed memory)
+     * Allocate and zero-initialize a new memory buffer from a pool, returning any managed memory
+     * to its pool, freeing or detaching it otherwise.
+     * If the managed memory is from @c pool, fits @c new_size and at most half of it stays unused,
+     * the memory is kept.
+     * @param[in] new_size The size of the new buffer (a value of zero equals reset())
+     * @param[in] pool The pool to allocate from
+     * @return @c true if the allocation succeeded, @c false otherwise
+     */
+    bool allocate(std::size_t new_size, MemoryBufferPool& pool);
+
+    /**
+     * Reset the memory (freeing, detaching or returning any managed memory to its pool)
      */
     void reset();
 
@@ -0,0 +1,104 @@
+/**
+ * @file
+ * Public API for @ref a_util::memory::MemoryBufferPool "MemoryBufferPool" type
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef _A_UTILS_UTIL_MEMORY_MEMORYBUFFER_POOL_INCLUDED_
+#define _A_UTILS_UTIL_MEMORY_MEMORYBUFFER_POOL_INCLUDED_
+
+#include <a_util/memory/memorybuffer.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace a_util {
+namespace memory {
+/// Backing of the large buffers of a @ref MemoryBufferPool
+enum class HugePages : std::int32_t {
+    none = 0x00,        //!< Allocate all buffers from the heap
+    transparent = 0x01, //!< Map large buffers and advise the kernel to use transparent huge pages
+    hugetlb = 0x02      //!< Map large buffers from the reserved huge pages (MAP_HUGETLB), falls
+                        //!< back to @c transparent if none are available
+};
+
+/**
+ * Pool of aligned memory for @ref MemoryBuffer objects
+ *
+ * Buffers allocated with @ref MemoryBuffer::allocate(std::size_t, MemoryBufferPool&) are rounded
+ * up to a size class (at most 25% larger than requested) and returned to the pool when the buffer
+ * is reset, reallocated or destroyed. The next allocation of the same size class reuses the memory
+ * instead of allocating it again, and a reallocation fitting into the size class of the current
+ * buffer keeps the memory. Huge pages are only used on Linux.
+ * @remark The pool is thread-safe. Buffers may outlive the pool, their memory is released with
+ *         the last buffer then.
+ */
+class MemoryBufferPool {
+public:
+    /// Alignment of the buffers if none is given, the size of a cache line
+    static constexpr std::size_t default_alignment = 64;
+    /// Buffers from this size on use huge pages if enabled, the size of a huge page
+    static constexpr std::size_t default_huge_page_threshold = 2 * 1024 * 1024;
+    /// Amount of released buffers kept per size class if none is given
+    static constexpr std::size_t default_max_cached_buffers = 4;
+
+    /**
+     * CTOR
+     * @param[in] alignment Alignment of the buffers, a power of two
+     * @param[in] huge_pages Backing of buffers of at least @c huge_page_threshold bytes
+     * @param[in] huge_page_threshold Minimum size of buffers backed by huge pages
+     * @param[in] max_cached_buffers Amount of released buffers kept per size class, further
+     *                               released buffers are freed
+     * @throw std::invalid_argument If @c alignment is not a power of two
+     */
+    explicit MemoryBufferPool(std::size_t alignment = default_alignment,
+                              HugePages huge_pages = HugePages::none,
+                              std::size_t huge_page_threshold = default_huge_page_threshold,
+                              std::size_t max_cached_buffers = default_max_cached_buffers);
+
+    /// DTOR, frees the released buffers
+    ~MemoryBufferPool();
+
+    /**
+     * Get the alignment of the buffers
+     * @return The alignment
+     */
+    std::size_t getAlignment() const;
+
+    /**
+     * Get the amount of memory of a buffer with the given size
+     * @param[in] size The requested size
+     * @return The size of the size class of @c size
+     */
+    std::size_t getCapacity(std::size_t size) const;
+
+    /**
+     * Get the amount of memory kept in released buffers for reuse
+     * @return The sum of the capacities of the released buffers
+     */
+    std::size_t getCachedSize() const;
+
+    /// Free all released buffers
+    void shrink();
+
+private:
+    MemoryBufferPool(const MemoryBufferPool&);            // = delete;
+    MemoryBufferPool& operator=(const MemoryBufferPool&); // = delete;
+
+    friend class MemoryBuffer;
+    class Implementation;
+    std::shared_ptr<Implementation> _impl;
+};
+
+} // namespace memory
+} // namespace a_util
+
+#endif // _A_UTILS_UTIL_MEMORY_MEMORYBUFFER_POOL_INCLUDED_
@@ -18,7 +18,10 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <a_util/base/types.h>
 #include <a_util/filesystem/path.h>
 
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace a_util {
 namespace process {
@@ -78,6 +81,52 @@ uint32_t execute(const a_util::filesystem::Path& executable_file,
                  std::string& std_out,
                  std::string& std_err);
 
+/// Options for running an executable with an argument list
+struct ExecuteOptions {
+    /// Working directory. If empty the current working directory is used.
+    a_util::filesystem::Path working_dir;
+    /// Called with each chunk of standard out as soon as it was read. If set, standard out is not
+    /// collected in @ref ExecuteResult::std_out.
+    std::function<void(const char* data, std::size_t size)> on_std_out;
+    /// Called with each chunk of standard error as soon as it was read. If set, standard error is
+    /// not collected in @ref ExecuteResult::std_err.
+    std::function<void(const char* data, std::size_t size)> on_std_err;
+    /// Timeout in microseconds after which the application gets killed, -1 -> no timeout.
+    /// Only supported on POSIX systems.
+    timestamp_t timeout = -1;
+};
+
+/// Result of running an executable with an argument list
+struct ExecuteResult {
+    /// Whether the application could be started at all
+    bool started = false;
+    /// Whether the application was killed because the timeout elapsed
+    bool timed_out = false;
+    /// Exit code of the application, 128 + signal number if the application was terminated by a
+    /// signal. Sign extended from 8 bit on POSIX systems like the other @ref execute() functions.
+    uint32_t exit_code = 0;
+    /// Standard out of the application, if not passed to @ref ExecuteOptions::on_std_out
+    std::string std_out;
+    /// Standard error of the application, if not passed to @ref ExecuteOptions::on_std_err
+    std::string std_err;
+};
+
+/**
+ * Start an executable directly (without a shell) and wait for the application to exit.
+ *
+ * The arguments are passed to the application as they are, no shell expansion, quoting or
+ * redirection takes place. Standard out and standard error are read through pipes while the
+ * application runs. On POSIX systems the application is started with @c posix_spawn.
+ * @note The new process will use the environment block of the calling process.
+ * @param[in] executable_file Executable file, searched in @c PATH if it contains no separator.
+ * @param[in] arguments Arguments passed to the executable.
+ * @param[in] options Working directory, output callbacks and timeout.
+ * @return The exit code and the collected output of the application.
+ */
+ExecuteResult execute(const a_util::filesystem::Path& executable_file,
+                      const std::vector<std::string>& arguments,
+                      const ExecuteOptions& options = ExecuteOptions());
+
 /**
  * Retrieve the current value of the environment variable given in @c environment_variable_name.
  *
@@ -17,10 +17,20 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace a_util {
 namespace regex {
-/// Basic regular expression matching
+/**
+ * Basic regular expression matching with the ECMAScript grammar
+ *
+ * Full matches without capture groups (@ref fullMatch(const std::string&) const and @ref filter)
+ * are matched by a deterministic finite automaton in one pass, if the pattern only uses literals,
+ * escapes, @c ., bracket expressions, the classes @c \d, @c \w, @c \s and their negations,
+ * (non-capturing) groups, alternations, quantifiers and the anchors @c ^ and @c $ at the start
+ * and end of the pattern. All other patterns (e.g. with back references, look arounds or word
+ * boundaries) and all other functions use @c std::regex.
+ */
 class RegularExpression {
 public:
     /// Anchor type
@@ -90,6 +100,19 @@ public:
      */
     bool fullMatch(const std::string& text) const;
 
+    /**
+     * Get the strings matching the pattern as a whole, like @ref fullMatch.
+     * @param[in] texts The strings to match
+     * @return The matching strings in the order of @c texts
+     */
+    std::vector<std::string> filter(const std::vector<std::string>& texts) const;
+
+    /**
+     * Check whether full matches use the automaton instead of @c std::regex.
+     * @return @c true if the pattern is set and within the subset supported by the automaton
+     */
+    bool isAutomatonUsed() const;
+
     /**
      * Check if the whole string matches the pattern, extracting up to 16 capture groups
      *
@@ -53,9 +53,19 @@ bool toUInt16(const std::string& from, std::uint16_t& to);
 bool toUInt32(const std::string& from, std::uint32_t& to);
 /// @copydoc toInt8(const std::string& from, std::int8_t& to)
 bool toUInt64(const std::string& from, std::uint64_t& to);
-/// @copydoc toInt8(const std::string& from, std::int8_t& to)
+
+/**
+ * Safely convert a string to a floating point value.
+ * @param[in] from String to convert. The decimal point is the one of the C locale (category
+                   @c LC_NUMERIC) like for @c strtod, e.g. "1,5" with a german locale. If the
+                   potentially convertible numeric value is not in range of @c decltype(to)
+                   numeric limits, the conversion fails.
+ * @param[out] to Numeric value converted from the string representation.
+ * @retval true Conversion was successful, @c to contains the converted value.
+ * @retval false Conversion failed, @c to is left untouched.
+ */
 bool toFloat(const std::string& from, float& to);
-/// @copydoc toInt8(const std::string& from, std::int8_t& to)
+/// @copydoc toFloat(const std::string& from, float& to)
 bool toDouble(const std::string& from, double& to);
 
 /// @copydoc toBool(const std::string& from, bool& to)
@@ -76,9 +86,9 @@ bool toUInt16(const char* from, std::uint16_t& to);
 bool toUInt32(const char* from, std::uint32_t& to);
 /// @copydoc toInt8(const std::string& from, std::int8_t& to)
 bool toUInt64(const char* from, std::uint64_t& to);
-/// @copydoc toInt8(const std::string& from, std::int8_t& to)
+/// @copydoc toFloat(const std::string& from, float& to)
 bool toFloat(const char* from, float& to);
-/// @copydoc toInt8(const std::string& from, std::int8_t& to)
+/// @copydoc toFloat(const std::string& from, float& to)
 bool toDouble(const char* from, double& to);
 
 /**
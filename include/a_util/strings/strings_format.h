@@ -15,6 +15,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #ifndef A_UTIL_UTIL_STRINGS_STRINGS_FORMAT_HEADER_INCLUDED
 #define A_UTIL_UTIL_STRINGS_STRINGS_FORMAT_HEADER_INCLUDED
 
+#include <cstdint>
 #include <string> //std::string
 
 namespace a_util {
@@ -76,11 +77,84 @@ std::string toString(std::uint16_t from);
 std::string toString(std::uint32_t from);
 /// @copydoc toString(std::int8_t from)
 std::string toString(std::uint64_t from);
-/// @copydoc toString(std::int8_t from)
+
+/**
+ * Convert the floating point value to a standard string like the format specifier "%f".
+ * The decimal point is the one of the C locale (category @c LC_NUMERIC), e.g. "1,500000" for 1.5
+ * with a german locale.
+ * @param[in] from The value converted to its string representation.
+ * @return String representation of the input parameter
+ */
 std::string toString(float from);
-/// @copydoc toString(std::int8_t from)
+/// @copydoc toString(float from)
 std::string toString(double from);
 
+/**
+ * Convert the floating point value to the shortest string representation which converts back to
+ * exactly the same value, e.g. "0.1" instead of "0.100000" of @ref toString(double from).
+ * The decimal point is the one of the C locale like for @ref toString(double from).
+ * @param[in] from The value converted to its string representation.
+ * @return String representation of the input parameter
+ */
+std::string toRoundTripString(float from);
+/// @copydoc toRoundTripString(float from)
+std::string toRoundTripString(double from);
+
+/**
+ * Write the string representation of the given value into a character buffer, this is the same
+ * as @ref toString(std::int8_t from) without allocating a string.
+ * @param[in] first Begin of the character buffer.
+ * @param[in] last End of the character buffer.
+ * @param[in] from The value converted to its string representation.
+ * @return End of the written characters (no terminating 0-character is written),
+ *         @c nullptr if the buffer is too small.
+ */
+char* toChars(char* first, char* last, bool from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::int8_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::int16_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::int32_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::int64_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::uint8_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::uint16_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::uint32_t from);
+/// @copydoc toChars(char* first, char* last, bool from)
+char* toChars(char* first, char* last, std::uint64_t from);
+
+/**
+ * Write the string representation of the given value into a character buffer, this is the same
+ * as @ref toString(double from) without allocating a string. The decimal point is the one of the
+ * C locale.
+ * @param[in] first Begin of the character buffer.
+ * @param[in] last End of the character buffer.
+ * @param[in] from The value converted to its string representation.
+ * @return End of the written characters (no terminating 0-character is written),
+ *         @c nullptr if the buffer is too small.
+ */
+char* toChars(char* first, char* last, float from);
+/// @copydoc toChars(char* first, char* last, float from)
+char* toChars(char* first, char* last, double from);
+
+/**
+ * Write the shortest string representation which converts back to exactly the same value into a
+ * character buffer, this is the same as @ref toRoundTripString(double from) without allocating a
+ * string.
+ * @param[in] first Begin of the character buffer.
+ * @param[in] last End of the character buffer.
+ * @param[in] from The value converted to its string representation.
+ * @return End of the written characters (no terminating 0-character is written),
+ *         @c nullptr if the buffer is too small.
+ */
+char* toRoundTripChars(char* first, char* last, float from);
+/// @copydoc toRoundTripChars(char* first, char* last, float from)
+char* toRoundTripChars(char* first, char* last, double from);
+
 } // namespace strings
 } // namespace a_util
 
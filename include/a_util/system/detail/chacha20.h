@@ -0,0 +1,45 @@
+/**
+ * @file
+ * Private ChaCha20 block function of the UUID generator, see @ref a_util::system::generateUUIDv4
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef A_UTIL_UTIL_SYSTEM_DETAIL_CHACHA20_INCLUDED
+#define A_UTIL_UTIL_SYSTEM_DETAIL_CHACHA20_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace a_util {
+namespace system {
+namespace detail {
+/// Number of bytes created by one call of @ref chaCha20Block
+constexpr std::size_t chacha20_block_size = 64;
+
+/**
+ * The ChaCha20 block function (D. J. Bernstein, RFC 8439 section 2.3)
+ * @param[in] key The 256 bit key as little endian words
+ * @param[in] counter The block counter
+ * @param[in] nonce The 96 bit nonce as little endian words
+ * @param[out] destination Buffer of at least @ref chacha20_block_size bytes for the serialized
+ *                         key stream block
+ */
+void chaCha20Block(const std::array<std::uint32_t, 8>& key,
+                   std::uint32_t counter,
+                   const std::array<std::uint32_t, 3>& nonce,
+                   std::uint8_t* destination);
+
+} // namespace detail
+} // namespace system
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_SYSTEM_DETAIL_CHACHA20_INCLUDED
@@ -1,6 +1,7 @@
 /**
  * @file
- * Public API for @ref a_util::system::generateUUIDv4 "generateUUIDv4" function
+ * Public API for @ref a_util::system::generateUUIDv4 "generateUUIDv4" function and the binary
+ * @ref a_util::system::Uuid "Uuid" type
  *
  * @copyright
  * @verbatim
@@ -15,10 +16,100 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #ifndef A_UTIL_UTIL_SYSTEM_UUID_INCLUDED
 #define A_UTIL_UTIL_SYSTEM_UUID_INCLUDED
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 namespace a_util {
 namespace system {
+/// Universally unique identifier (RFC 4122) in its binary 128 bit representation
+class Uuid {
+public:
+    /// Number of characters of the string representation, e.g. "6ba7b810-9dad-41d1-80b4-..."
+    static constexpr std::size_t string_length = 36;
+    /// The bytes in network byte order
+    using Bytes = std::array<std::uint8_t, 16>;
+
+    /// Default constructor - initializes the nil UUID (all bits zero)
+    Uuid();
+
+    /**
+     * Constructor
+     * @param[in] bytes The bytes in network byte order
+     */
+    explicit Uuid(const Bytes& bytes);
+
+    /**
+     * Get the bytes.
+     * @return The bytes in network byte order
+     */
+    const Bytes& getBytes() const;
+
+    /**
+     * Check for the nil UUID.
+     * @return @c true if all bits are zero, @c false otherwise
+     */
+    bool isNil() const;
+
+    /**
+     * Write the string representation (lower case hex digits) into a caller provided buffer.
+     * @param[out] destination Buffer of at least @ref string_length characters, no terminating
+     *                         zero is written.
+     */
+    void format(char* destination) const;
+
+    /**
+     * Get the string representation (lower case hex digits).
+     * @return The 36 character string
+     */
+    std::string toString() const;
+
+    /**
+     * Get the hash value, for use in unordered containers (see @c std::hash<Uuid>).
+     * @return The hash value
+     */
+    std::size_t getHash() const;
+
+private:
+    Bytes _bytes;
+};
+
+/**
+ * Compare two UUIDs for equality
+ * @param[in] lhs Left-hand side object
+ * @param[in] rhs Right-hand side object
+ * @return @c true if both UUIDs are equal, @c false otherwise
+ */
+bool operator==(const Uuid& lhs, const Uuid& rhs);
+
+/**
+ * Compare two UUIDs for inequality
+ * @param[in] lhs Left-hand side object
+ * @param[in] rhs Right-hand side object
+ * @return @c true if the UUIDs are not equal, @c false otherwise
+ */
+bool operator!=(const Uuid& lhs, const Uuid& rhs);
+
+/**
+ * Order two UUIDs by their bytes
+ * @param[in] lhs Left-hand side object
+ * @param[in] rhs Right-hand side object
+ * @return @c true if @c lhs is ordered before @c rhs, @c false otherwise
+ */
+bool operator<(const Uuid& lhs, const Uuid& rhs);
+
+/**
+ * Generate a binary UUIDv4
+ *
+ * The random bits are taken from a cryptographically secure generator (ChaCha20) per thread, which
+ * is keyed from the random device of the operating system and rekeyed in a forked child process.
+ * No lock is taken and no memory is allocated.
+ * @return A fully randomized UUIDv4
+ */
+Uuid generateBinaryUUIDv4();
+
 /**
  * Generate a UUIDv4 string
  * @return A fully randomized UUIDv4 string
@@ -28,4 +119,20 @@ std::string generateUUIDv4();
 } // namespace system
 } // namespace a_util
 
+namespace std {
+/// Hash specialization to use @ref a_util::system::Uuid in unordered containers
+template <>
+struct hash<a_util::system::Uuid> {
+    /**
+     * Get the hash value
+     * @param[in] uuid The UUID
+     * @return The hash value
+     */
+    std::size_t operator()(const a_util::system::Uuid& uuid) const
+    {
+        return uuid.getHash();
+    }
+};
+} // namespace std
+
 #endif // A_UTIL_UTIL_SYSTEM_UUID_INCLUDED
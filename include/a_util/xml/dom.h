@@ -21,12 +21,15 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <list>
 #include <map>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace a_util {
 namespace xml {
 class DOM;
 class DOMElement;
+class DOMElementHandle;
 
 /// Exception class used by the DOM classes
 class DOMException : public std::runtime_error {
@@ -40,9 +43,58 @@ public:
 
 /// Tyoe alias for DOMElement lists
 typedef std::list<DOMElement> DOMElementList;
+/// Type alias for DOMElementHandle lists
+typedef std::vector<DOMElementHandle> DOMElementHandleList;
 /// Type alias for DOM attributes
 typedef std::map<std::string, std::string> DOMAttributes;
 
+/**
+ * Precompiled query to find nodes in a DOM.
+ * Finding nodes with a query string compiles the query each time it is used. A DOMQuery is
+ * compiled once and can be used for any element of any DOM. Copies share the compiled query,
+ * a DOMQuery can be used by multiple threads at once.
+ * See DOMElement::findNode() for the syntax.
+ */
+class DOMQuery {
+public:
+    /// CTOR, creates an invalid query
+    DOMQuery();
+
+    /**
+     * CTOR, compiles the query
+     * @param[in] query The query string
+     * @post @c isValid() returns @c false if the query could not be compiled
+     */
+    explicit DOMQuery(const std::string& query);
+
+    /// DTOR
+    ~DOMQuery();
+
+    /**
+     * Check whether the query was compiled successfully
+     * @return @c true if the query is valid, @c false otherwise
+     */
+    bool isValid() const;
+
+    /**
+     * Get the query string this query was compiled from
+     * @return The query string
+     */
+    std::string getQuery() const;
+
+    /**
+     * Get the error description if the query could not be compiled
+     * @return The error description, empty if the query is valid
+     */
+    std::string getLastError() const;
+
+private:
+    class Implementation;
+    std::shared_ptr<const Implementation> _impl;
+    friend class DOMElement;
+    friend class DOMElementHandle;
+};
+
 /// Representation for an element in the DOM
 class DOMElement {
 public:
@@ -202,6 +254,9 @@ public:
     ///
     ///  - *[\@prop1='3' and \@prop2='4']     :logical AND comparison for attributes
     ///
+    /// The compiled queries are cached per DOM (the 64 least recently used query strings). Use a
+    /// DOMQuery to compile a query once for many documents.
+    ///
     /// @param[in] query The query string
     /// @param[out] element_ptr This will point to the found element
     /// @return @c false if no matching node is found or the query is invalid, @c true otherwise
@@ -217,6 +272,34 @@ public:
      */
     bool findNodes(const std::string& query, DOMElementList& elements) const;
 
+    /**
+     * Finds a node based on a precompiled query.
+     * See @ref findNode() for the syntax.
+     * @param[in] query The precompiled query
+     * @param[out] element_ptr This will point to the found element
+     * @return @c false if no matching node is found or the query is invalid, @c true otherwise
+     */
+    bool findNode(const DOMQuery& query, DOMElement& element_ptr) const;
+
+    /**
+     * Finds nodes based on a precompiled query.
+     * See @ref findNode() for the syntax.
+     * @param[in] query The precompiled query
+     * @param[out] elements This list will be filled with the found elements
+     * @return @c false if no matching node is found or the query is invalid, @c true otherwise
+     */
+    bool findNodes(const DOMQuery& query, DOMElementList& elements) const;
+
+    /**
+     * Finds nodes based on a precompiled query.
+     * In contrast to a DOMElementList no element is allocated, use this to iterate over many
+     * elements.
+     * @param[in] query The precompiled query
+     * @param[out] elements This list will be filled with the handles of the found elements
+     * @return @c false if no matching node is found or the query is invalid, @c true otherwise
+     */
+    bool findNodes(const DOMQuery& query, DOMElementHandleList& elements) const;
+
     /// Sort the queried nodes by name
     /// example: @code{.cpp} sortNodes("units/*", SortingOrder::ascending); @endcode
     /// @param[in] query  Xpath that describes the nodes to sort
@@ -304,6 +387,7 @@ private:
     class Implementation;
     memory::StackPtr<Implementation, 16> _impl;
     friend class DOM;
+    friend class DOMElementHandle;
 };
 
 /**
@@ -314,6 +398,127 @@ private:
  */
 bool operator!=(const DOMElement& lhs, const DOMElement& rhs);
 
+/**
+ * Lightweight, non-owning handle to an element in the DOM.
+ * The handle is trivially copyable and only valid as long as the DOM it refers to exists and the
+ * element is not removed. It provides read access without allocations, the returned strings are
+ * owned by the DOM and valid until the element is changed. Use @ref toElement() to get a full
+ * DOMElement.
+ */
+class DOMElementHandle {
+public:
+    /// CTOR, creates a null handle
+    DOMElementHandle() = default;
+
+    /**
+     * CTOR, creates a handle to the given element
+     * @param[in] element The element to refer to
+     */
+    explicit DOMElementHandle(const DOMElement& element);
+
+    /**
+     * Get the name of the element
+     * @return The name of the element, empty if the handle is null
+     */
+    const char* getName() const;
+
+    /**
+     * Returns the value of an attribute with @c name
+     * @param[in] name The name of the attribute
+     * @param[in] def_value A default value that is returned if the attribute does not exist
+     * @return The value of the attribute or the default value
+     */
+    const char* getAttribute(const char* name, const char* def_value = "") const;
+
+    /**
+     * Checks if an attribute exists
+     * @param[in] name The name of the attribute
+     * @return @c true if attribute exists, otherwise @c false
+     */
+    bool hasAttribute(const char* name) const;
+
+    /**
+     * Get the data of the element.
+     * @return The data
+     */
+    const char* getData() const;
+
+    /**
+     * Get this elements parent element
+     * @return The parent element - null if no parent element exists
+     */
+    DOMElementHandle getParent() const;
+
+    /**
+     * Get the first child element (text nodes are skipped)
+     * @return The first child element - null if there is no child element
+     */
+    DOMElementHandle getFirstChild() const;
+
+    /**
+     * Get the first child element matching the @c name
+     * @param[in] name The name of the child element
+     * @return The child element - null if not found
+     */
+    DOMElementHandle getChild(const char* name) const;
+
+    /**
+     * Get the next sibling element (text nodes are skipped)
+     * @return The next sibling element - null if this is the last element
+     */
+    DOMElementHandle getNextSibling() const;
+
+    /**
+     * Finds a node based on a precompiled query.
+     * See DOMElement::findNode() for the syntax.
+     * @param[in] query The precompiled query
+     * @param[out] element This will refer to the found element
+     * @return @c false if no matching node is found or the query is invalid, @c true otherwise
+     */
+    bool findNode(const DOMQuery& query, DOMElementHandle& element) const;
+
+    /**
+     * Finds nodes based on a precompiled query.
+     * See DOMElement::findNode() for the syntax.
+     * @param[in] query The precompiled query
+     * @param[out] elements This list will be filled with the found elements
+     * @return @c false if no matching node is found or the query is invalid, @c true otherwise
+     */
+    bool findNodes(const DOMQuery& query, DOMElementHandleList& elements) const;
+
+    /**
+     * Creates a DOMElement referring to the same element
+     * @return The element
+     */
+    DOMElement toElement() const;
+
+    /**
+     * Check whether this handle refers to no element
+     * @return @c true if null, @c false otherwise
+     */
+    bool isNull() const;
+
+    /**
+     * Comparison operator.
+     * @param[in] other The other handle
+     * @return @c true if both handles refer to the same element (no deep comparison)
+     */
+    bool operator==(const DOMElementHandle& other) const;
+
+    /**
+     * Incomparison operator.
+     * @param[in] other The other handle
+     * @return @c true if the handles refer to different elements (no deep comparison)
+     */
+    bool operator!=(const DOMElementHandle& other) const;
+
+private:
+    /// the node of the parser, opaque to not expose the parser in the interface
+    void* _node = nullptr;
+    DOM* _document = nullptr;
+    friend class DOMElement;
+};
+
 /// XML parser to read and write standard XML files
 class DOM {
 public:
@@ -395,6 +600,26 @@ public:
      */
     bool findNodes(const std::string& query, DOMElementList& elements) const;
 
+    /**
+     * Finds a node based on a precompiled query
+     * See DOMElement::findNode() for the syntax.
+     *
+     * @param[in] query The precompiled query
+     * @param[out] element_ptr This will point to the found element.
+     * @return Whether or not the node was found
+     */
+    bool findNode(const DOMQuery& query, DOMElement& element_ptr) const;
+
+    /**
+     * Finds nodes based on a precompiled query.
+     * See DOMElement::findNode() for the syntax.
+     *
+     * @param[in] query The precompiled query
+     * @param[out] elements This list will be filled with the found elements
+     * @return Whether or not any nodes where found
+     */
+    bool findNodes(const DOMQuery& query, DOMElementList& elements) const;
+
     /**
      * Get the last error description occurred
      * @return The last occurred error
@@ -99,6 +99,14 @@ public:
      * @see @ref forEachLeafElement, @ref forEachElement, @ref Decoder::Element, @ref CodecIndex
      */
     const Elements& getElements() const;
+    /**
+     * Retrieves the codec indices of all leaf elements in the order of @ref forEachLeafElement.
+     * The position within the vector is the leaf index.
+     * The leaf elements are collected once and shared by all copies of this decoder,
+     * iterating them is a linear scan without any recursion.
+     * @return The codec indices of the leaf elements.
+     */
+    const std::vector<CodecIndex>& getLeafIndices() const;
     /**
      * @brief Gets the buffer size in bytes for the main structure.
      * @retval size_t of the structure depending on the current representation (@ref
@@ -239,6 +247,24 @@ public:
     {
         LeafValueSetter<T>::setValue(getData(), getDataSize(), leaf_codec_index.getLayout(), value);
     }
+    /**
+     * Sets the current value of the given element with the pre-bound write function of the
+     * typed leaf access. Use this within loops over many samples.
+     * @param[in] typed_leaf_access The typed leaf access of the element.
+     * @param[in] value The value to set.
+     * @tparam T Type of the value to set
+     * @throws std::runtime_error if there is no valid conversion or the element is not within the
+     * data.
+     */
+    template <typename T>
+    void setElementValue(const TypedLeafAccess<T>& typed_leaf_access,
+                         const typename TypedLeafAccess<T>::value_type& value)
+    {
+        if (getDataSize() < typed_leaf_access.getRequiredDataSize()) {
+            throw std::runtime_error("copy action exceeds buffersize");
+        }
+        typed_leaf_access.setValue(getData(), value);
+    }
     /**
      * Sets the current value of the given element from the given variant.
      * If this element is a enum type the enum types element name can be used in \p value.
@@ -276,6 +302,7 @@ public:
     /**
      * Sets all elements to their default values, constant values defined in the data definition or
      * zero if \p zero_values is set.
+     * For static structs the reset values are precalculated once per CodecFactory and copied.
      * @param[in] zero_values set the value to 0 if no constant or default value set in data
      * definition.
      */
@@ -17,6 +17,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <ddl/codec/codec.h>
 #include <ddl/codec/codec_iterator.h>
+#include <ddl/codec/codec_projection.h>
 #include <ddl/codec/legacy/access_element_legacy.h>
 #include <ddl/codec/static_codec.h>
 #include <ddl/dd/dd.h>
@@ -136,6 +137,30 @@ public:
      * @return a codec.
      */
     Codec makeCodecFor(void* data, size_t data_size, DataRepresentation rep = deserialized) const;
+
+    /**
+     * Creates a projection which extracts only the given leaf elements from the data into a
+     * compact output struct.
+     * @param[in] element_names The full names of the leaf elements to extract.
+     * @param[in] rep The representation of the data to extract from.
+     * @return a projection.
+     * @throw throws std::runtime_error if an element is not found or is not a leaf element of a
+     *        standard type.
+     */
+    CodecProjection makeProjection(const std::vector<std::string>& element_names,
+                                   DataRepresentation rep = deserialized) const;
+
+    /**
+     * Creates a projection which extracts only the given leaf elements from the data into a
+     * compact output struct.
+     * @param[in] codec_indices The codec indices of the leaf elements to extract.
+     * @param[in] rep The representation of the data to extract from.
+     * @return a projection.
+     * @throw throws std::runtime_error if an element is not found or is not a leaf element of a
+     *        standard type.
+     */
+    CodecProjection makeProjection(const std::vector<CodecIndex>& codec_indices,
+                                   DataRepresentation rep = deserialized) const;
     /**
      * Type of a single factory element.
      */
@@ -178,6 +203,14 @@ public:
      * CodecIndex
      */
     const Elements& getElements() const;
+    /**
+     * Retrieves the codec indices of all leaf elements in the order of @ref forEachLeafElement.
+     * The position within the vector is the leaf index.
+     * The leaf elements are collected once and shared by all static decoders and codecs of this
+     * factory, iterating them is a linear scan without any recursion.
+     * @return The codec indices of the leaf elements.
+     */
+    const std::vector<CodecIndex>& getLeafIndices() const;
     /**
      * Retrieves the amount of child elements for the given codec index.
      * @param[in] codec_index The codec index of the element.
@@ -265,6 +298,8 @@ public: // legacy functions
                                             const ddl::StructElement*& legacy_struct_element) const;
 
 private:
+    friend class ColumnarDecoder;
+    friend class SampleDiff;
     /// For internal use only.  @internal The struct layout.
     std::shared_ptr<const StructAccess> _codec_access;
     /// For internal use only. @internal The constructor result.
@@ -321,11 +356,7 @@ inline size_t getDecoderOrFactoryElementCount(const ddl::codec::Codec& codec)
 template <typename T>
 std::vector<CodecIndex> getCodecIndices(const T& decoder_or_factory)
 {
-    std::vector<CodecIndex> indices;
-    indices.reserve(detail::getDecoderOrFactoryElementCount<T>(decoder_or_factory));
-    forEachLeafElement(decoder_or_factory.getElements(),
-                       [&indices](const auto& element) { indices.push_back(element.getIndex()); });
-    return indices;
+    return decoder_or_factory.getLeafIndices();
 }
 /**
  * @brief Get the leaf indices object.
@@ -340,11 +371,12 @@ template <typename T>
 std::vector<LeafCodecIndex> getLeafCodecIndices(const T& decoder_or_factory,
                                                 ddl::DataRepresentation rep)
 {
+    const auto& leaf_indices = decoder_or_factory.getLeafIndices();
     std::vector<LeafCodecIndex> indices;
-    indices.reserve(detail::getDecoderOrFactoryElementCount<T>(decoder_or_factory));
-    forEachLeafElement(decoder_or_factory.getElements(), [&indices, &rep](const auto& element) {
-        indices.push_back(LeafCodecIndex(element.getIndex(), rep));
-    });
+    indices.reserve(leaf_indices.size());
+    for (const auto& leaf_index: leaf_indices) {
+        indices.push_back(LeafCodecIndex(leaf_index, rep));
+    }
     return indices;
 }
 
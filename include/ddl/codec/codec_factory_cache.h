@@ -0,0 +1,125 @@
+/**
+ * @file
+ * Cache of codec factories created from description strings.
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef DDL_CODEC_FACTORY_CACHE_CLASS_HEADER
+#define DDL_CODEC_FACTORY_CACHE_CLASS_HEADER
+
+#include <ddl/codec/codec_factory.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ddl {
+namespace codec {
+
+/**
+ * Thread safe and size bounded cache of codec factories created from description strings.
+ * Creating a @ref CodecFactory from a description string parses the whole description and
+ * creates the struct layout. The cache keeps the factories of the last used struct name and
+ * description combinations (the key is the struct name and a hash of the description, the
+ * description itself is compared on a hit). The returned factories share the immutable struct
+ * layout with the cached one, so they are as cheap to copy as a @ref CodecFactory copy.
+ * If the cache is full the least recently used factory is removed.
+ * Invalid factories are not cached.
+ */
+class CodecFactoryCache {
+public:
+    /**
+     * The default maximum amount of cached factories.
+     */
+    static constexpr size_t default_max_size = 256;
+
+    /**
+     * CTOR
+     * @param[in] max_size The maximum amount of cached factories.
+     */
+    explicit CodecFactoryCache(size_t max_size = default_max_size);
+    /**
+     * no copy CTOR
+     */
+    CodecFactoryCache(const CodecFactoryCache&) = delete;
+    /**
+     * no copy assignment
+     */
+    CodecFactoryCache& operator=(const CodecFactoryCache&) = delete;
+
+    /**
+     * Gets the process wide cache, i.e. used by the mapping engine.
+     * @return The process wide cache.
+     */
+    static CodecFactoryCache& getGlobalCache();
+
+    /**
+     * Gets the factory for the struct within the description, creates and caches it if not cached.
+     * This is equal to CodecFactory(struct_name, dd_string).
+     * @param[in] struct_name The name of the struct.
+     * @param[in] dd_string The description containing the struct.
+     * @return The factory, check @ref CodecFactory::isValid.
+     */
+    CodecFactory getFactory(const std::string& struct_name, const std::string& dd_string);
+
+    /**
+     * Gets the amount of cached factories.
+     * @return The amount of cached factories.
+     */
+    size_t getSize() const;
+    /**
+     * Gets the maximum amount of cached factories.
+     * @return The maximum amount of cached factories.
+     */
+    size_t getMaxSize() const;
+    /**
+     * Sets the maximum amount of cached factories, the least recently used factories are removed
+     * if there are more.
+     * @param[in] max_size The maximum amount of cached factories.
+     */
+    void setMaxSize(size_t max_size);
+    /**
+     * Removes all cached factories.
+     */
+    void clear();
+
+private:
+    /// For internal use only. @internal The key of a cached factory.
+    struct Key {
+        std::string struct_name;
+        size_t dd_string_hash;
+        bool operator==(const Key& other) const;
+    };
+    /// For internal use only. @internal
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    /// For internal use only. @internal A cached factory.
+    struct Entry {
+        Key key;
+        std::string dd_string;
+        CodecFactory factory;
+    };
+    /// For internal use only. @internal
+    void shrinkTo(size_t size);
+
+    mutable std::mutex _mutex;
+    size_t _max_size;
+    /// the most recently used entry is the first one
+    std::list<Entry> _entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+};
+
+} // namespace codec
+} // namespace ddl
+
+#endif // DDL_CODEC_FACTORY_CACHE_CLASS_HEADER
@@ -19,6 +19,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <ddl/codec/codec_index.h>
 
 #include <functional>
+#include <type_traits>
 
 namespace ddl {
 namespace codec {
@@ -1408,6 +1409,76 @@ private:
     }
 };
 
+namespace detail {
+/**
+ * @brief The reference type of the elements passed to the visitor of @ref forEachLeafElement and
+ * @ref forEachElement.
+ * @tparam ElementsType The type of elements.
+ */
+template <typename ElementsType>
+using ElementReference = std::conditional_t<std::is_const<ElementsType>::value,
+                                            const typename ElementsType::element_type,
+                                            typename ElementsType::element_type>&;
+
+/**
+ * @brief Implementation of @ref forEachLeafElement, the visitor is called directly and can be
+ * inlined.
+ * @tparam ElementsType The type of elements.
+ * @tparam Visitor The type of the visitor.
+ * @param elements The elements
+ * @param visitor The visitor to call per leaf element
+ */
+template <typename ElementsType, typename Visitor>
+void forEachLeafElement(ElementsType& elements, Visitor& visitor)
+{
+    for (auto& element: elements) {
+        if (element.hasChildren()) {
+            if (element.isArray()) {
+                for (size_t array_pos = 0; array_pos < element.getArraySize(); ++array_pos) {
+                    auto array_element = element.getArrayElement(array_pos);
+                    auto& children = array_element.getChildElements();
+                    detail::forEachLeafElement(children, visitor);
+                }
+            }
+            else {
+                auto& children = element.getChildElements();
+                detail::forEachLeafElement(children, visitor);
+            }
+        }
+        else {
+            if (element.isArray()) {
+                for (size_t array_pos = 0; array_pos < element.getArraySize(); ++array_pos) {
+                    auto array_element = element.getArrayElement(array_pos);
+                    visitor(static_cast<ElementReference<ElementsType>>(array_element));
+                }
+            }
+            else {
+                visitor(static_cast<ElementReference<ElementsType>>(element));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Implementation of @ref forEachElement, the visitor is called directly and can be inlined.
+ * @tparam ElementsType The type of elements.
+ * @tparam Visitor The type of the visitor.
+ * @param elements The elements
+ * @param visitor The visitor to call per element
+ */
+template <typename ElementsType, typename Visitor>
+void forEachElement(ElementsType& elements, Visitor& visitor)
+{
+    for (auto& element: elements) {
+        visitor(static_cast<ElementReference<ElementsType>>(element));
+        if (element.hasChildren()) {
+            auto& children = element.getChildElements();
+            detail::forEachElement(children, visitor);
+        }
+    }
+}
+} // namespace detail
+
 /**
  * @brief Iterates ALL leaf elements within ALL array elements.
  *
@@ -1446,38 +1517,26 @@ private:
  *      @ref StaticCodec::getElements, @ref StaticDecoder::getElements
  */
 template <typename ElementsType>
-void forEachLeafElement(
-    ElementsType& elements,
-    const std::function<void(std::conditional_t<std::is_const<ElementsType>::value,
-                                                const typename ElementsType::element_type,
-                                                typename ElementsType::element_type>&)>& func)
+void forEachLeafElement(ElementsType& elements,
+                        const std::function<void(detail::ElementReference<ElementsType>)>& func)
 {
-    for (auto& element: elements) {
-        if (element.hasChildren()) {
-            if (element.isArray()) {
-                for (size_t array_pos = 0; array_pos < element.getArraySize(); ++array_pos) {
-                    auto array_element = element.getArrayElement(array_pos);
-                    auto& children = array_element.getChildElements();
-                    forEachLeafElement(children, func);
-                }
-            }
-            else {
-                auto& children = element.getChildElements();
-                forEachLeafElement(children, func);
-            }
-        }
-        else {
-            if (element.isArray()) {
-                for (size_t array_pos = 0; array_pos < element.getArraySize(); ++array_pos) {
-                    auto array_element = element.getArrayElement(array_pos);
-                    func(array_element);
-                }
-            }
-            else {
-                func(element);
-            }
-        }
-    }
+    detail::forEachLeafElement(elements, func);
+}
+
+/**
+ * @brief Iterates ALL leaf elements within ALL array elements.
+ * Same as the std::function overload, but the visitor (i.e. a lambda) is called directly, so the
+ * call can be inlined.
+ * @tparam ElementsType The type of elements.
+ * @tparam Visitor The type of the visitor, callable with a reference to the element.
+ * @param elements The elements
+ * @param visitor The visitor to call per leaf element
+ * @see @ref CodecFactory::getLeafIndices to iterate the leaf elements without recursion.
+ */
+template <typename ElementsType, typename Visitor>
+void forEachLeafElement(ElementsType& elements, Visitor&& visitor)
+{
+    detail::forEachLeafElement(elements, visitor);
 }
 
 /**
@@ -1525,19 +1584,25 @@ void forEachLeafElement(
  *      @ref StaticCodec::getElements, @ref StaticDecoder::getElements
  */
 template <typename ElementsType>
-void forEachElement(
-    ElementsType& elements,
-    const std::function<void(std::conditional_t<std::is_const<ElementsType>::value,
-                                                const typename ElementsType::element_type,
-                                                typename ElementsType::element_type>&)>& func)
+void forEachElement(ElementsType& elements,
+                    const std::function<void(detail::ElementReference<ElementsType>)>& func)
 {
-    for (auto& element: elements) {
-        func(element);
-        if (element.hasChildren()) {
-            auto& children = element.getChildElements();
-            forEachElement(children, func);
-        }
-    }
+    detail::forEachElement(elements, func);
+}
+
+/**
+ * @brief Iterates elements without array elements (also structures).
+ * Same as the std::function overload, but the visitor (i.e. a lambda) is called directly, so the
+ * call can be inlined.
+ * @tparam ElementsType The type of elements.
+ * @tparam Visitor The type of the visitor, callable with a reference to the element.
+ * @param elements The elements
+ * @param visitor The visitor to call per element
+ */
+template <typename ElementsType, typename Visitor>
+void forEachElement(ElementsType& elements, Visitor&& visitor)
+{
+    detail::forEachElement(elements, visitor);
 }
 
 } // namespace codec
@@ -0,0 +1,132 @@
+/**
+ * @file
+ * Projection of selected leaf elements of a struct into a compact output struct.
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef DDL_CODEC_PROJECTION_CLASS_HEADER
+#define DDL_CODEC_PROJECTION_CLASS_HEADER
+
+#include <ddl/codec/codec_index.h>
+#include <ddl/codec/codec_type_info.h>
+#include <ddl/codec/data_representation.h>
+#include <ddl/codec/leaf_value_access.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ddl {
+namespace codec {
+
+class StructAccess;
+class CodecFactory;
+
+/**
+ * Extractor plan for a selection of leaf elements, created by @ref CodecFactory::makeProjection.
+ * The projection reads only the selected leaf elements of the data into a compact output struct.
+ * The output struct contains the values in their own type in the order of the selection, each
+ * value is aligned to its size (like a C struct with these members), i.e. the selection
+ * {"a" (tUInt8), "b" (tFloat64), "c" (tInt16)} is extracted into
+ * @code
+ * struct Output {
+ *     uint8_t a;
+ *     double b;
+ *     int16_t c;
+ * };
+ * @endcode
+ * bool values are extracted as 0 or 1.
+ *
+ * The positions (offset, bit position, byte order) of the elements are resolved while creation.
+ * For dynamic structs the positions depend on the array sizes within the data, they are resolved
+ * with the first data and cached until a following data has other array sizes.
+ * @remark Only leaf elements of standard types (bool, all int types, float, double) are supported.
+ */
+class CodecProjection {
+public:
+    /**
+     * no default CTOR
+     */
+    CodecProjection() = delete;
+
+    /**
+     * Gets the data representation of the data to extract from.
+     * @return The data representation.
+     */
+    DataRepresentation getRepresentation() const noexcept;
+    /**
+     * Gets the amount of selected elements.
+     * @return The amount of selected elements.
+     */
+    size_t getElementCount() const noexcept;
+    /**
+     * Gets the element type (and so the value type) of the selected element.
+     * @param[in] element The position of the element within the selection.
+     * @return The element type.
+     * @throw std::runtime_error if the element does not exist.
+     */
+    ElementType getElementType(size_t element) const;
+    /**
+     * Gets the offset of the selected element within the output struct.
+     * @param[in] element The position of the element within the selection.
+     * @return The offset in bytes.
+     * @throw std::runtime_error if the element does not exist.
+     */
+    size_t getElementOffset(size_t element) const;
+    /**
+     * Gets the size of the output struct.
+     * @return The size in bytes.
+     */
+    size_t getOutputSize() const noexcept;
+
+    /**
+     * Extracts the selected elements of the data into the output struct.
+     * @param[in] data The data of the struct in the representation of the projection.
+     * @param[in] data_size The size of the data.
+     * @param[out] output The output struct.
+     * @param[in] output_size The size of the output struct, at least @ref getOutputSize.
+     * @throw std::runtime_error if the data or the output is too small or a dynamic element
+     *        does not exist for the array sizes within the data.
+     */
+    void extract(const void* data, size_t data_size, void* output, size_t output_size) const;
+
+private:
+    friend class CodecFactory;
+    /// For internal use only. @internal
+    CodecProjection(std::shared_ptr<const StructAccess> codec_access,
+                    const std::vector<std::string>& element_names,
+                    const std::vector<CodecIndex>& codec_indices,
+                    DataRepresentation representation);
+    /// For internal use only. @internal The resolved positions of a dynamic struct.
+    struct DynamicLayout;
+    /// For internal use only. @internal
+    std::shared_ptr<const DynamicLayout> resolveDynamicLayout(const void* data,
+                                                              size_t data_size) const;
+
+    /// For internal use only. @internal A selected element.
+    struct Element {
+        std::string name;
+        CodecIndex codec_index;
+        LeafLayout leaf_layout;
+        size_t output_offset;
+    };
+    std::shared_ptr<const StructAccess> _codec_access;
+    DataRepresentation _representation;
+    std::vector<Element> _elements;
+    size_t _data_size = {};
+    size_t _output_size = {};
+    mutable std::shared_ptr<const DynamicLayout> _dynamic_layout;
+};
+
+} // namespace codec
+} // namespace ddl
+
+#endif // DDL_CODEC_PROJECTION_CLASS_HEADER
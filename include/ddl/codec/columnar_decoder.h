@@ -0,0 +1,231 @@
+/**
+ * @file
+ * Columnar (struct of arrays) batch decoding of samples of one static struct.
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef DDL_COLUMNAR_DECODER_CLASS_HEADER
+#define DDL_COLUMNAR_DECODER_CLASS_HEADER
+
+#include <ddl/codec/codec_factory.h>
+#include <ddl/codec/codec_index.h>
+#include <ddl/codec/codec_type_info.h>
+#include <ddl/codec/data_representation.h>
+#include <ddl/codec/leaf_value_access.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ddl {
+namespace codec {
+
+namespace detail {
+/**
+ * @brief Maps the value type of a column to its ElementType.
+ * @tparam T The value type of the column.
+ */
+template <typename T>
+struct ColumnElementType;
+
+/// @cond nodoc
+#define DDL_COLUMN_ELEMENT_TYPE(__data_type, __element_type)                                       \
+    template <>                                                                                    \
+    struct ColumnElementType<__data_type>                                                          \
+        : public std::integral_constant<ElementType, ElementType::__element_type> {                \
+    };
+DDL_COLUMN_ELEMENT_TYPE(bool, cet_bool)
+DDL_COLUMN_ELEMENT_TYPE(int8_t, cet_int8)
+DDL_COLUMN_ELEMENT_TYPE(uint8_t, cet_uint8)
+DDL_COLUMN_ELEMENT_TYPE(int16_t, cet_int16)
+DDL_COLUMN_ELEMENT_TYPE(uint16_t, cet_uint16)
+DDL_COLUMN_ELEMENT_TYPE(int32_t, cet_int32)
+DDL_COLUMN_ELEMENT_TYPE(uint32_t, cet_uint32)
+DDL_COLUMN_ELEMENT_TYPE(int64_t, cet_int64)
+DDL_COLUMN_ELEMENT_TYPE(uint64_t, cet_uint64)
+DDL_COLUMN_ELEMENT_TYPE(float, cet_float)
+DDL_COLUMN_ELEMENT_TYPE(double, cet_double)
+#undef DDL_COLUMN_ELEMENT_TYPE
+/// @endcond
+
+/// For internal use only. @internal The values of one column in the value type of the column.
+class ColumnValuesBase {
+public:
+    /// DTOR
+    virtual ~ColumnValuesBase() = default;
+    /**
+     * Provides the memory for the values, the memory is kept for smaller amounts of values.
+     * @param[in] count The amount of values.
+     * @return The first value.
+     */
+    virtual void* reserve(size_t count) = 0;
+};
+
+/// For internal use only. @internal
+template <typename T>
+class ColumnValues : public ColumnValuesBase {
+public:
+    void* reserve(size_t count) override
+    {
+        if (count > _capacity) {
+            _values.reset(new T[count]());
+            _capacity = count;
+        }
+        return _values.get();
+    }
+    /// Gets the first value.
+    const T* data() const noexcept
+    {
+        return _values.get();
+    }
+
+private:
+    std::unique_ptr<T[]> _values;
+    size_t _capacity = {};
+};
+} // namespace detail
+
+/**
+ * Decoder for batches of samples of one static struct.
+ * Each selected leaf element is decoded into its own typed column (struct of arrays), i.e. to
+ * export recorded samples to analytic formats or to calculate statistics.
+ * The layout of the columns is calculated once while construction (see @ref LeafCodecIndex):
+ * \li leaves at byte positions in platform byte order are gathered with a fixed size copy
+ * \li leaves at byte positions in the other byte order are gathered and byte swapped afterwards
+ * \li serialized bit fields are read bit by bit
+ *
+ * The columns are reused for the next batch, decoding does not allocate memory if the batch is not
+ * larger than the largest batch decoded before.
+ * @remark Only leaf elements of standard types (bool, all int types, float, double) of static
+ *         structs are supported.
+ */
+class ColumnarDecoder {
+public:
+    /**
+     * no default CTOR
+     */
+    ColumnarDecoder() = delete;
+    /**
+     * CTOR, creates a column for each leaf element of the struct.
+     * @param[in] factory The codec factory of the struct.
+     * @param[in] rep The data representation of the samples to decode.
+     * @throw std::runtime_error if the factory is invalid, the struct is dynamic or one of the
+     *        leaf elements is not of a standard type.
+     */
+    ColumnarDecoder(const CodecFactory& factory, DataRepresentation rep = deserialized);
+    /**
+     * CTOR, creates a column for each given leaf element.
+     * @param[in] factory The codec factory of the struct.
+     * @param[in] leaf_names The full names of the leaf elements to decode.
+     * @param[in] rep The data representation of the samples to decode.
+     * @throw std::runtime_error if the factory is invalid, the struct is dynamic or one of the
+     *        elements is not found or is not a leaf element of a standard type.
+     */
+    ColumnarDecoder(const CodecFactory& factory,
+                    const std::vector<std::string>& leaf_names,
+                    DataRepresentation rep = deserialized);
+    /**
+     * CTOR, creates a column for each given leaf element.
+     * @param[in] factory The codec factory of the struct.
+     * @param[in] leaf_indices The codec indices of the leaf elements to decode.
+     * @param[in] rep The data representation of the samples to decode.
+     * @throw std::runtime_error if the factory is invalid, the struct is dynamic or one of the
+     *        elements is not found or is not a leaf element of a standard type.
+     */
+    ColumnarDecoder(const CodecFactory& factory,
+                    const std::vector<CodecIndex>& leaf_indices,
+                    DataRepresentation rep = deserialized);
+
+    /**
+     * Gets the data representation of the samples to decode.
+     * @return The data representation.
+     */
+    DataRepresentation getRepresentation() const noexcept;
+    /**
+     * Gets the size of one sample in bytes (the static buffer size of the struct).
+     * @return The size of one sample.
+     */
+    size_t getSampleSize() const noexcept;
+    /**
+     * Gets the amount of columns.
+     * @return The amount of columns.
+     */
+    size_t getColumnCount() const noexcept;
+    /**
+     * Gets the full element name of the column.
+     * @param[in] column The column position.
+     * @return The full element name.
+     * @throw std::runtime_error if the column does not exist.
+     */
+    const std::string& getColumnName(size_t column) const;
+    /**
+     * Gets the element type (and so the value type) of the column.
+     * @param[in] column The column position.
+     * @return The element type.
+     * @throw std::runtime_error if the column does not exist.
+     */
+    ElementType getColumnType(size_t column) const;
+
+    /**
+     * Decodes a batch of samples into the columns.
+     * The samples are placed one after another in \p samples with the distance \p stride.
+     * The amount of samples is the amount of complete samples in \p samples_size.
+     * @param[in] samples The data of the first sample.
+     * @param[in] samples_size The size of the batch in bytes.
+     * @param[in] stride The distance of the samples in bytes, 0 to use @ref getSampleSize.
+     * @return The amount of decoded samples.
+     * @throw std::runtime_error if \p stride is smaller than the size of one sample.
+     */
+    size_t decode(const void* samples, size_t samples_size, size_t stride = 0);
+    /**
+     * Gets the amount of samples decoded by the last call of @ref decode.
+     * @return The amount of samples within each column.
+     */
+    size_t getSampleCount() const noexcept;
+    /**
+     * Gets the values of the column decoded by the last call of @ref decode.
+     * @tparam T The value type of the column, it must match the element type of the column.
+     * @param[in] column The column position.
+     * @return The first value, the column contains @ref getSampleCount values.
+     * @throw std::runtime_error if the column does not exist or \p T does not match the type.
+     */
+    template <typename T>
+    const T* getColumn(size_t column) const
+    {
+        if (getColumnType(column) != detail::ColumnElementType<T>::value) {
+            throw std::runtime_error("the requested value type does not match the column type");
+        }
+        return static_cast<const detail::ColumnValues<T>&>(*_columns[column].values).data();
+    }
+
+private:
+    /// For internal use only. @internal The layout and values of one column.
+    struct Column {
+        std::string name;
+        LeafLayout leaf_layout;
+        std::unique_ptr<detail::ColumnValuesBase> values;
+    };
+    /// For internal use only. @internal
+    void addColumn(const CodecFactory& factory, const CodecIndex& leaf_index);
+
+    DataRepresentation _representation;
+    size_t _sample_size = {};
+    size_t _sample_count = {};
+    std::vector<Column> _columns;
+};
+
+} // namespace codec
+} // namespace ddl
+
+#endif // DDL_COLUMNAR_DECODER_CLASS_HEADER
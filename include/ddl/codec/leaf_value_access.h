@@ -189,8 +189,7 @@ private:
                     static_cast<uint8_t>(LeafDataRepresentation::serialized_be) :
                     static_cast<uint8_t>(LeafDataRepresentation::serialized_le);
             leaf_layout.bit_pos = layout.serialized.bit_offset % 8;
-            leaf_layout.byte_pos = static_cast<uint32_t>(layout.serialized.bit_offset / 8 +
-                                                         ((leaf_layout.bit_pos == 0) ? 0 : 1));
+            leaf_layout.byte_pos = static_cast<uint32_t>(layout.serialized.bit_offset / 8);
             if (layout.serialized.type_bit_size_used > (std::numeric_limits<uint8_t>::max)()) {
                 return false;
             }
@@ -18,8 +18,12 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <ddl/codec/bitserializer.h>
 #include <ddl/codec/codec.h>
 #include <ddl/codec/codec_factory.h>
+#include <ddl/codec/codec_factory_cache.h>
+#include <ddl/codec/columnar_decoder.h>
 #include <ddl/codec/legacy/access_element.h>
 #include <ddl/codec/legacy/struct_element.h>
+#include <ddl/codec/sample_diff.h>
 #include <ddl/codec/static_codec.h>
+#include <ddl/codec/typed_leaf_access.h>
 
 #endif // DDL_CODEC_PKG_HEADER
@@ -0,0 +1,172 @@
+/**
+ * @file
+ * Change detection and delta encoding between two samples of one static struct.
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef DDL_SAMPLE_DIFF_CLASS_HEADER
+#define DDL_SAMPLE_DIFF_CLASS_HEADER
+
+#include <ddl/codec/codec_factory.h>
+#include <ddl/codec/codec_index.h>
+#include <ddl/codec/data_representation.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace ddl {
+namespace codec {
+
+/**
+ * Detects the changed leaf elements between two samples of one static struct, i.e. for change
+ * driven publishing.
+ * The leaf elements are numbered in the order of @ref getCodecIndices (the leaf index).
+ * The layout is calculated once while construction:
+ * \li leaves at byte positions which follow each other without a gap are merged into byte ranges
+ *     of up to 64 bytes, a byte range is compared with one memcmp and only if it differs its
+ *     leaves are compared
+ * \li serialized bit fields are compared bit by bit
+ *
+ * Padding bytes are not compared.
+ *
+ * The changed leaves can be encoded into a delta, which can be applied to a sample with the
+ * previous values to retrieve the current sample.
+ * The delta is a sequence of the changed leaves, each one as
+ * \li the leaf index as uint32_t in platform byte order
+ * \li the bytes of the leaf within the sample, a bit field is stored in the lowest bits of
+ *     (bit size + 7) / 8 bytes (LSB first)
+ *
+ * A delta is only valid for a SampleDiff of the same struct and data representation.
+ * @remark Only static structs are supported.
+ */
+class SampleDiff {
+public:
+    /**
+     * no default CTOR
+     */
+    SampleDiff() = delete;
+    /**
+     * CTOR
+     * @param[in] factory The codec factory of the struct.
+     * @param[in] rep The data representation of the samples to compare.
+     * @throw std::runtime_error if the factory is invalid or the struct is dynamic.
+     */
+    SampleDiff(const CodecFactory& factory, DataRepresentation rep = deserialized);
+
+    /**
+     * Gets the data representation of the samples to compare.
+     * @return The data representation.
+     */
+    DataRepresentation getRepresentation() const noexcept;
+    /**
+     * Gets the size of one sample in bytes (the static buffer size of the struct).
+     * @return The size of one sample.
+     */
+    size_t getSampleSize() const noexcept;
+    /**
+     * Gets the amount of leaf elements.
+     * @return The amount of leaf elements.
+     */
+    size_t getLeafCount() const noexcept;
+    /**
+     * Gets the codec index of the leaf element.
+     * @param[in] leaf The leaf index.
+     * @return The codec index.
+     * @throw std::runtime_error if the leaf does not exist.
+     */
+    const CodecIndex& getLeafCodecIndex(size_t leaf) const;
+
+    /**
+     * Detects the changed leaf elements.
+     * @param[in] previous The previous sample.
+     * @param[in] previous_size The size of the previous sample.
+     * @param[in] current The current sample.
+     * @param[in] current_size The size of the current sample.
+     * @param[out] changed_leaves The ascending leaf indices of the changed leaves. The vector is
+     *                            cleared first, its capacity is reused.
+     * @return The amount of changed leaves.
+     * @throw std::runtime_error if one of the samples is smaller than @ref getSampleSize.
+     */
+    size_t diff(const void* previous,
+                size_t previous_size,
+                const void* current,
+                size_t current_size,
+                std::vector<size_t>& changed_leaves) const;
+    /**
+     * Detects the changed leaf elements.
+     * @param[in] previous The previous sample.
+     * @param[in] previous_size The size of the previous sample.
+     * @param[in] current The current sample.
+     * @param[in] current_size The size of the current sample.
+     * @return The ascending leaf indices of the changed leaves.
+     * @throw std::runtime_error if one of the samples is smaller than @ref getSampleSize.
+     */
+    std::vector<size_t> diff(const void* previous,
+                             size_t previous_size,
+                             const void* current,
+                             size_t current_size) const;
+
+    /**
+     * Encodes the changed leaf elements with their current values into a delta.
+     * @param[in] previous The previous sample.
+     * @param[in] previous_size The size of the previous sample.
+     * @param[in] current The current sample.
+     * @param[in] current_size The size of the current sample.
+     * @param[out] delta The delta. The vector is cleared first, its capacity is reused.
+     * @return The amount of changed leaves.
+     * @throw std::runtime_error if one of the samples is smaller than @ref getSampleSize.
+     */
+    size_t encodeDelta(const void* previous,
+                       size_t previous_size,
+                       const void* current,
+                       size_t current_size,
+                       std::vector<uint8_t>& delta) const;
+    /**
+     * Applies a delta created by @ref encodeDelta to a sample.
+     * @param[in] delta The delta.
+     * @param[in] delta_size The size of the delta.
+     * @param[in,out] data The sample to apply the delta to.
+     * @param[in] data_size The size of the sample.
+     * @throw std::runtime_error if the sample is smaller than @ref getSampleSize or the delta is
+     *        invalid.
+     */
+    void applyDelta(const void* delta, size_t delta_size, void* data, size_t data_size) const;
+
+private:
+    /// For internal use only. @internal The position of one leaf within the sample.
+    struct Leaf {
+        CodecIndex codec_index;
+        size_t bit_offset;
+        size_t bit_size;
+    };
+    /// For internal use only. @internal Byte leaves without a gap in between.
+    struct ByteRange {
+        size_t byte_pos;
+        size_t byte_size;
+        size_t first_leaf;
+        size_t leaf_count;
+    };
+    /// For internal use only. @internal
+    void checkSampleSizes(size_t previous_size, size_t current_size) const;
+
+    DataRepresentation _representation;
+    size_t _sample_size = {};
+    std::vector<Leaf> _leaves;
+    /// indices of the leaves at byte positions sorted by position, the byte ranges refer to this
+    std::vector<size_t> _byte_leaves;
+    std::vector<ByteRange> _byte_ranges;
+    std::vector<size_t> _bit_field_leaves;
+};
+
+} // namespace codec
+} // namespace ddl
+
+#endif // DDL_SAMPLE_DIFF_CLASS_HEADER
@@ -21,6 +21,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <ddl/codec/codec_iterator.h>
 #include <ddl/codec/data_representation.h>
 #include <ddl/codec/legacy/access_element_legacy.h>
+#include <ddl/codec/typed_leaf_access.h>
 #include <ddl/codec/value_access.h>
 
 #include <functional>
@@ -106,6 +107,14 @@ public:
      * CodecIndex
      */
     const Elements& getElements() const;
+    /**
+     * Retrieves the codec indices of all leaf elements in the order of @ref forEachLeafElement.
+     * The position within the vector is the leaf index.
+     * The leaf elements are collected once and shared by all static decoders and codecs of one
+     * factory, iterating them is a linear scan without any recursion.
+     * @return The codec indices of the leaf elements.
+     */
+    const std::vector<CodecIndex>& getLeafIndices() const;
     /**
      * Retrieves the amount of child elements for the given codec index.
      * @param[in] codec_index The codec index of the element.
@@ -175,6 +184,22 @@ public:
     {
         return LeafValueGetter<T>::getValue(getData(), getDataSize(), leaf_codec_index.getLayout());
     }
+    /**
+     * Returns the current value of the given element as a T with the pre-bound read function of
+     * the typed leaf access. Use this within loops over many samples.
+     * @param[in] typed_leaf_access The typed leaf access of the element.
+     * @tparam T The type of the value to retrieve.
+     * @return Returns the current value as T.
+     * @throws std::runtime_error if the element is not within the data.
+     */
+    template <typename T>
+    T getElementValue(const TypedLeafAccess<T>& typed_leaf_access) const
+    {
+        if (getDataSize() < typed_leaf_access.getRequiredDataSize()) {
+            throw std::runtime_error("copy action exceeds buffersize");
+        }
+        return typed_leaf_access.getValue(getData());
+    }
     /**
      * Returns the current value of the given element as a variant.
      * @param[in] codec_index The index of the element.
@@ -400,6 +425,24 @@ public:
     {
         LeafValueSetter<T>::setValue(getData(), getDataSize(), leaf_codec_index.getLayout(), value);
     }
+    /**
+     * Sets the current value of the given element with the pre-bound write function of the
+     * typed leaf access. Use this within loops over many samples.
+     * @param[in] typed_leaf_access The typed leaf access of the element.
+     * @param[in] value The value to set.
+     * @tparam T Type of the value to set
+     * @throws std::runtime_error if there is no valid conversion or the element is not within the
+     * data.
+     */
+    template <typename T>
+    void setElementValue(const TypedLeafAccess<T>& typed_leaf_access,
+                         const typename TypedLeafAccess<T>::value_type& value)
+    {
+        if (getDataSize() < typed_leaf_access.getRequiredDataSize()) {
+            throw std::runtime_error("copy action exceeds buffersize");
+        }
+        typed_leaf_access.setValue(getData(), value);
+    }
     /**
      * Sets the current value of the given element from the given variant.
      * If this element is a enum type the enum types element name can be used in \p value.
@@ -439,6 +482,7 @@ public:
     /**
      * Sets all elements to their default values, constant values defined in the data definition or
      * zero if \p zero_values is set.
+     * For static structs the reset values are precalculated once per CodecFactory and copied.
      * @param[in] zero_values set the value to 0 if no constant or default value set in data
      * definition.
      */
@@ -454,6 +498,11 @@ public:
 
 private:
     friend class CodecFactory;
+    friend bool resetWithDefaultValueImage(const std::shared_ptr<const StructAccess>& codec_access,
+                                           void* data,
+                                           size_t data_size,
+                                           DataRepresentation representation,
+                                           bool zero_values);
     /// For internal use only. @internal
     StaticCodec(std::shared_ptr<const StructAccess> codec_access,
                 void* data,
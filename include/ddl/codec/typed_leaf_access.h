@@ -0,0 +1,435 @@
+/**
+ * @file
+ * The typed leaf access is a header only optimization for the repeated access of one leaf value
+ * of a standard type in one value type.
+ *
+ * @copyright
+ * @verbatim
+Copyright @ 2022 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef DDL_TYPED_LEAF_ACCESS_CLASS_HEADER
+#define DDL_TYPED_LEAF_ACCESS_CLASS_HEADER
+
+#include <ddl/codec/leaf_value_access.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ddl {
+namespace codec {
+
+namespace detail {
+
+/// @cond nodoc
+inline uint8_t swapLeafBytes(uint8_t value)
+{
+    return value;
+}
+
+inline uint16_t swapLeafBytes(uint16_t value)
+{
+    return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+inline uint32_t swapLeafBytes(uint32_t value)
+{
+    return ((value & 0xFF000000u) >> 24) | ((value & 0x00FF0000u) >> 8) |
+           ((value & 0x0000FF00u) << 8) | ((value & 0x000000FFu) << 24);
+}
+
+inline uint64_t swapLeafBytes(uint64_t value)
+{
+    return (static_cast<uint64_t>(swapLeafBytes(static_cast<uint32_t>(value))) << 32) |
+           swapLeafBytes(static_cast<uint32_t>(value >> 32));
+}
+
+template <size_t Size>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1> {
+    using type = uint8_t;
+};
+template <>
+struct UnsignedOfSize<2> {
+    using type = uint16_t;
+};
+template <>
+struct UnsignedOfSize<4> {
+    using type = uint32_t;
+};
+template <>
+struct UnsignedOfSize<8> {
+    using type = uint64_t;
+};
+/// @endcond
+
+/**
+ * @brief Retrieves the bit position of the leaf within the data.
+ * @param leaf_layout The leaf layout
+ * @return The bit position.
+ */
+inline size_t getLeafBitOffset(const LeafLayout& leaf_layout)
+{
+    return leaf_layout.byte_pos * size_t(8) + leaf_layout.bit_pos;
+}
+
+/**
+ * @brief Retrieves the amount of bytes the data must have to contain the leaf.
+ * @param leaf_layout The leaf layout
+ * @return The size in bytes.
+ */
+inline size_t getLeafRequiredDataSize(const LeafLayout& leaf_layout)
+{
+    return (getLeafBitOffset(leaf_layout) + leaf_layout.bit_size + 7) / 8;
+}
+
+/**
+ * @brief Reads a little endian bit field of at most 64 bits (including the bit position).
+ * @param bytes The first byte of the bit field
+ * @param bit_pos The bit position within the first byte
+ * @param bit_size The size of the bit field
+ * @return The bits of the bit field
+ */
+inline uint64_t readLittleEndianBits(const uint8_t* bytes, size_t bit_pos, size_t bit_size)
+{
+    const size_t byte_count = (bit_pos + bit_size + 7) / 8;
+    uint64_t bits = 0;
+    for (size_t byte = 0; byte < byte_count; ++byte) {
+        bits |= static_cast<uint64_t>(bytes[byte]) << (byte * 8);
+    }
+    bits >>= bit_pos;
+    if (bit_size < 64) {
+        bits &= (uint64_t(1) << bit_size) - 1;
+    }
+    return bits;
+}
+
+/**
+ * @brief Writes a little endian bit field of at most 64 bits (including the bit position).
+ * The bits around the bit field are kept.
+ * @param bytes The first byte of the bit field
+ * @param bit_pos The bit position within the first byte
+ * @param bit_size The size of the bit field
+ * @param value The bits to write
+ */
+inline void writeLittleEndianBits(uint8_t* bytes, size_t bit_pos, size_t bit_size, uint64_t value)
+{
+    const size_t byte_count = (bit_pos + bit_size + 7) / 8;
+    uint64_t bits = 0;
+    for (size_t byte = 0; byte < byte_count; ++byte) {
+        bits |= static_cast<uint64_t>(bytes[byte]) << (byte * 8);
+    }
+    const uint64_t mask = ((bit_size < 64) ? ((uint64_t(1) << bit_size) - 1) : ~uint64_t(0))
+                          << bit_pos;
+    bits = (bits & ~mask) | ((value << bit_pos) & mask);
+    for (size_t byte = 0; byte < byte_count; ++byte) {
+        bytes[byte] = static_cast<uint8_t>(bits >> (byte * 8));
+    }
+}
+
+/**
+ * @brief The specialized read and write functions of one element type for @ref TypedLeafAccess.
+ * The data size is not checked, the caller must make sure the leaf is within the data.
+ * @tparam ElementValueType The type of the element within the data
+ * @tparam ValueType The value type to convert from and to
+ */
+template <typename ElementValueType, typename ValueType>
+struct TypedLeafAccessFunctions {
+    /// element at a byte position in platform byte order
+    static ValueType readBytes(const void* data, const LeafLayout& leaf_layout)
+    {
+        ElementValueType value;
+        std::memcpy(
+            &value, static_cast<const uint8_t*>(data) + leaf_layout.byte_pos, sizeof(value));
+        return TargetValueConverter<ElementValueType, ValueType>::convert(value);
+    }
+
+    /// element at a byte position in the other byte order
+    static ValueType readSwappedBytes(const void* data, const LeafLayout& leaf_layout)
+    {
+        using UnsignedType = typename UnsignedOfSize<sizeof(ElementValueType)>::type;
+        UnsignedType bytes;
+        std::memcpy(
+            &bytes, static_cast<const uint8_t*>(data) + leaf_layout.byte_pos, sizeof(bytes));
+        bytes = swapLeafBytes(bytes);
+        ElementValueType value;
+        std::memcpy(&value, &bytes, sizeof(value));
+        return TargetValueConverter<ElementValueType, ValueType>::convert(value);
+    }
+
+    /// integer bit field in little endian of at most 64 bits (including the bit position)
+    static ValueType readLittleEndianBits(const void* data, const LeafLayout& leaf_layout)
+    {
+        const uint64_t bits = detail::readLittleEndianBits(
+            static_cast<const uint8_t*>(data) + leaf_layout.byte_pos,
+            leaf_layout.bit_pos,
+            leaf_layout.bit_size);
+        return TargetValueConverter<ElementValueType, ValueType>::convert(
+            toElementValue(bits, leaf_layout.bit_size, std::is_signed<ElementValueType>{}));
+    }
+
+    /// any other bit field
+    static ValueType readBits(const void* data, const LeafLayout& leaf_layout)
+    {
+        return detail::readBits<ElementValueType, ValueType>(
+            data,
+            getLeafRequiredDataSize(leaf_layout),
+            getLeafBitOffset(leaf_layout),
+            leaf_layout.bit_size,
+            getByteOrder(leaf_layout));
+    }
+
+    /// element at a byte position in platform byte order
+    static void writeBytes(void* data, const LeafLayout& leaf_layout, const ValueType& value)
+    {
+        const auto element_value = toElementValue(value);
+        std::memcpy(static_cast<uint8_t*>(data) + leaf_layout.byte_pos,
+                    &element_value,
+                    sizeof(element_value));
+    }
+
+    /// element at a byte position in the other byte order
+    static void writeSwappedBytes(void* data, const LeafLayout& leaf_layout, const ValueType& value)
+    {
+        using UnsignedType = typename UnsignedOfSize<sizeof(ElementValueType)>::type;
+        const auto element_value = toElementValue(value);
+        UnsignedType bytes;
+        std::memcpy(&bytes, &element_value, sizeof(bytes));
+        bytes = swapLeafBytes(bytes);
+        std::memcpy(static_cast<uint8_t*>(data) + leaf_layout.byte_pos, &bytes, sizeof(bytes));
+    }
+
+    /// integer bit field in little endian of at most 64 bits (including the bit position)
+    static void writeLittleEndianBits(void* data,
+                                      const LeafLayout& leaf_layout,
+                                      const ValueType& value)
+    {
+        detail::writeLittleEndianBits(static_cast<uint8_t*>(data) + leaf_layout.byte_pos,
+                                      leaf_layout.bit_pos,
+                                      leaf_layout.bit_size,
+                                      static_cast<uint64_t>(toElementValue(value)));
+    }
+
+    /// any other bit field
+    static void writeBits(void* data, const LeafLayout& leaf_layout, const ValueType& value)
+    {
+        detail::writeBits<ElementValueType, ValueType>(data,
+                                                       getLeafRequiredDataSize(leaf_layout),
+                                                       getLeafBitOffset(leaf_layout),
+                                                       leaf_layout.bit_size,
+                                                       getByteOrder(leaf_layout),
+                                                       value);
+    }
+
+private:
+    static a_util::memory::Endianess getByteOrder(const LeafLayout& leaf_layout)
+    {
+        return ((leaf_layout.data_flags &
+                 static_cast<uint8_t>(LeafDataRepresentation::serialized_be)) ==
+                static_cast<uint8_t>(LeafDataRepresentation::serialized_be)) ?
+                   a_util::memory::bit_big_endian :
+                   a_util::memory::bit_little_endian;
+    }
+
+    static ElementValueType toElementValue(const ValueType& value)
+    {
+        ElementValueType element_value{};
+        if (!SourceValueConverter<ElementValueType, ValueType>::convert(element_value, value)) {
+            throw std::runtime_error("unsupported type conversion requested");
+        }
+        return element_value;
+    }
+
+    static ElementValueType toElementValue(uint64_t bits, size_t bit_size, std::true_type)
+    {
+        // replicate the sign bit
+        const auto shift = static_cast<unsigned int>(64 - bit_size);
+        return static_cast<ElementValueType>(static_cast<int64_t>(bits << shift) >> shift);
+    }
+
+    static ElementValueType toElementValue(uint64_t bits, size_t, std::false_type)
+    {
+        return static_cast<ElementValueType>(bits);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Typed access to one leaf value for the hot path, i.e. reading the same leaf of many
+ * samples in a loop.
+ * The read and write functions are selected once while construction for the element type, the
+ * data representation, the byte order and the bit alignment of the leaf, so the access itself has
+ * no type switch, no variant and no bounds check:
+ * \li leaves at byte positions in platform byte order are copied
+ * \li leaves at byte positions in the other byte order are copied and byte swapped
+ * \li little endian integer bit fields are shifted and masked
+ * \li all other bit fields are accessed with the @ref a_util::memory::BitSerializer
+ *
+ * Use @ref StaticDecoder::getElementValue and @ref StaticCodec::setElementValue with the typed
+ * leaf access to check the data size once per access.
+ *
+ * @tparam ValueType The value type to convert from and to (see @ref LeafValueGetter).
+ */
+template <typename ValueType>
+class TypedLeafAccess {
+public:
+    /**
+     * @brief The value type to convert from and to.
+     */
+    using value_type = ValueType;
+    /**
+     * @brief The pre-bound read function.
+     */
+    using ReadFunction = ValueType (*)(const void* data, const LeafLayout& leaf_layout);
+    /**
+     * @brief The pre-bound write function.
+     */
+    using WriteFunction = void (*)(void* data,
+                                   const LeafLayout& leaf_layout,
+                                   const ValueType& value);
+
+    /**
+     * @brief no default CTOR
+     */
+    TypedLeafAccess() = delete;
+    /**
+     * @brief CTOR
+     * @param leaf_codec_index The leaf codec index to access.
+     * @throws std::runtime_error if the type of the leaf is not a standard type.
+     */
+    explicit TypedLeafAccess(const LeafCodecIndex& leaf_codec_index)
+        : _leaf_layout(leaf_codec_index.getLayout())
+    {
+        select();
+    }
+    /**
+     * @brief CTOR
+     * @param codec_index The codec index of the leaf to access.
+     * @param rep The data representation of the data to access.
+     * @throws std::runtime_error if the codec index is not a leaf of a standard type.
+     */
+    TypedLeafAccess(const CodecIndex& codec_index, DataRepresentation rep)
+        : TypedLeafAccess(LeafCodecIndex(codec_index, rep))
+    {
+    }
+
+    /**
+     * @brief Gets the leaf layout.
+     * @return const LeafLayout&
+     */
+    const LeafLayout& getLayout() const noexcept
+    {
+        return _leaf_layout;
+    }
+    /**
+     * @brief Gets the amount of bytes the data must have to contain the leaf.
+     * @return The size in bytes.
+     */
+    size_t getRequiredDataSize() const noexcept
+    {
+        return detail::getLeafRequiredDataSize(_leaf_layout);
+    }
+
+    /**
+     * @brief Reads the value of the leaf.
+     * @param data The data, it must have at least @ref getRequiredDataSize bytes.
+     * @return The value of the leaf.
+     */
+    ValueType getValue(const void* data) const
+    {
+        return _read(data, _leaf_layout);
+    }
+    /**
+     * @brief Writes the value of the leaf.
+     * @param data The data, it must have at least @ref getRequiredDataSize bytes.
+     * @param value The value to write.
+     * @throws std::runtime_error if there is no valid conversion.
+     */
+    void setValue(void* data, const ValueType& value) const
+    {
+        _write(data, _leaf_layout, value);
+    }
+
+private:
+    template <typename ElementValueType>
+    void select()
+    {
+        using Functions = detail::TypedLeafAccessFunctions<ElementValueType, ValueType>;
+        const bool serialized =
+            (_leaf_layout.data_flags & static_cast<uint8_t>(LeafDataRepresentation::serialized)) ==
+            static_cast<uint8_t>(LeafDataRepresentation::serialized);
+        // serialized leaves at byte positions in platform byte order are already marked as
+        // deserialized by the LeafCodecIndex
+        if (!serialized) {
+            _read = &Functions::readBytes;
+            _write = &Functions::writeBytes;
+            return;
+        }
+        const bool little_endian =
+            (_leaf_layout.data_flags &
+             static_cast<uint8_t>(LeafDataRepresentation::serialized_be)) !=
+            static_cast<uint8_t>(LeafDataRepresentation::serialized_be);
+        if (_leaf_layout.bit_pos == 0 && _leaf_layout.bit_size == sizeof(ElementValueType) * 8) {
+            _read = &Functions::readSwappedBytes;
+            _write = &Functions::writeSwappedBytes;
+        }
+        else if (little_endian && !std::is_floating_point<ElementValueType>::value &&
+                 _leaf_layout.bit_pos + _leaf_layout.bit_size <= 64) {
+            _read = &Functions::readLittleEndianBits;
+            _write = &Functions::writeLittleEndianBits;
+        }
+        else {
+            _read = &Functions::readBits;
+            _write = &Functions::writeBits;
+        }
+    }
+
+    void select()
+    {
+        switch (_leaf_layout.element_type) {
+        case LeafElementType::let_bool:
+            return select<bool>();
+        case LeafElementType::let_uint8:
+            return select<uint8_t>();
+        case LeafElementType::let_int8:
+            return select<int8_t>();
+        case LeafElementType::let_uint16:
+            return select<uint16_t>();
+        case LeafElementType::let_int16:
+            return select<int16_t>();
+        case LeafElementType::let_uint32:
+            return select<uint32_t>();
+        case LeafElementType::let_int32:
+            return select<int32_t>();
+        case LeafElementType::let_uint64:
+            return select<uint64_t>();
+        case LeafElementType::let_int64:
+            return select<int64_t>();
+        case LeafElementType::let_float:
+            return select<float>();
+        case LeafElementType::let_double:
+            return select<double>();
+        default: // all others are not supported
+            break;
+        }
+        throw std::runtime_error("invalid type");
+    }
+
+    LeafLayout _leaf_layout;
+    ReadFunction _read = nullptr;
+    WriteFunction _write = nullptr;
+};
+
+} // namespace codec
+} // namespace ddl
+
+#endif // DDL_TYPED_LEAF_ACCESS_CLASS_HEADER
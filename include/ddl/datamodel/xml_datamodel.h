@@ -18,6 +18,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <a_util/base/enums.h>
 #include <ddl/datamodel/datamodel_datadefinition.h>
 
+#include <ostream>
 #include <string>
 
 namespace ddl {
@@ -47,6 +48,16 @@ DataDefinition fromXMLString(const std::string& xml_string,
  */
 std::string toXMLString(const DataDefinition& dd);
 
+/**
+ * @brief writes the XML of the DD datamodel into the given stream.
+ * The XML is written in one pass without creating a DOM, the output is the same as
+ * @ref toXMLString.
+ *
+ * @param dd the Data Defintion the xml is to create
+ * @param xml_stream the stream to write the xml to
+ */
+void toXMLStream(const DataDefinition& dd, std::ostream& xml_stream);
+
 /**
  * @brief creates a datamodel from a xml file
  *
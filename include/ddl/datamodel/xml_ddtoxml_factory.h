@@ -33,6 +33,9 @@ namespace dd {
  * functions: \li setAttribute(const std::string& name, const std::string& value); \li
  * DOM_NODE_TYPE& createChild(const std::string& name); \li setData(const std::string& name, const
  * std::string& data);
+ * All attributes of a node are set before its first child is created and the children are
+ * created in document order, so DOM_NODE_TYPE may also write the XML directly while the nodes
+ * are created.
  */
 template <typename DOM_NODE_TYPE>
 struct DDToXMLFactory {
@@ -220,6 +223,22 @@ struct DDToXMLFactory {
         }
     }
 
+    /**
+     * @brief Set the attributes of the serialized representation of the struct_type element.
+     *
+     * @param dom_node the dom node where to set the attributes
+     * @param element the datamodel of element
+     */
+    static void setSerializedAttributes(DOM_NODE_TYPE& dom_node,
+                                        const datamodel::StructType::Element& element)
+    {
+        dom_node.setAttribute("bytepos", std::to_string(*element.getBytePos()));
+        dom_node.setAttribute("byteorder",
+                              dd::ByteOrderConversion::toString(element.getByteOrder()));
+        setOptionalAttribute<size_t>(dom_node, "bitpos", element.getBitPos());
+        setOptionalAttribute<size_t>(dom_node, "numbits", element.getNumBits());
+    }
+
     /**
      * @brief Create a Node for the struct_type element.
      *
@@ -235,26 +254,11 @@ struct DDToXMLFactory {
         sub_node.setAttribute("name", element.getName());
         sub_node.setAttribute("type", element.getTypeName());
 
-        // From version 4.0 on this information is specified within the <deserialized> tag.
-        DOM_NODE_TYPE* serialized_node = &sub_node;
-        DOM_NODE_TYPE serialized_node_version_40;
-        if (file_ddl_version >= Version(4, 0)) {
-            serialized_node_version_40 = sub_node.createChild("serialized");
-            serialized_node = &serialized_node_version_40;
-        }
-        serialized_node->setAttribute("bytepos", std::to_string(*element.getBytePos()));
-        serialized_node->setAttribute("byteorder",
-                                      dd::ByteOrderConversion::toString(element.getByteOrder()));
-        setOptionalAttribute<size_t>(*serialized_node, "bitpos", element.getBitPos());
-        setOptionalAttribute<size_t>(*serialized_node, "numbits", element.getNumBits());
-        // From version 4.0 on this information is specified within the <serialized> tag.
-        DOM_NODE_TYPE* deserialized_node = &sub_node;
-        DOM_NODE_TYPE deserialized_node_version_40;
-        if (file_ddl_version >= Version(4, 0)) {
-            deserialized_node_version_40 = sub_node.createChild("deserialized");
-            deserialized_node = &deserialized_node_version_40;
+        // before version 4.0 the (de)serialized information is specified within the element tag
+        if (file_ddl_version < Version(4, 0)) {
+            setSerializedAttributes(sub_node, element);
+            sub_node.setAttribute("alignment", std::to_string(element.getAlignment()));
         }
-        deserialized_node->setAttribute("alignment", std::to_string(element.getAlignment()));
         // optional
         setOptionalAttribute(sub_node, "description", element.getDescription());
         setOptionalAttribute(sub_node, "unit", element.getUnitName());
@@ -284,6 +288,14 @@ struct DDToXMLFactory {
             setOptionalAttribute(sub_node, "scale", element.getScale());
             setOptionalAttribute(sub_node, "offset", element.getOffset());
         }
+        // From version 4.0 on this information is specified within the <serialized> and
+        // <deserialized> tag.
+        if (file_ddl_version >= Version(4, 0)) {
+            DOM_NODE_TYPE serialized_node = sub_node.createChild("serialized");
+            setSerializedAttributes(serialized_node, element);
+            DOM_NODE_TYPE deserialized_node = sub_node.createChild("deserialized");
+            deserialized_node.setAttribute("alignment", std::to_string(element.getAlignment()));
+        }
     }
     /**
      * @brief Create a Node for the struct_type.
@@ -19,7 +19,10 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <ddl/datamodel/datamodel_datadefinition.h>
 #include <ddl/dd/dd_infomodel_type.h>
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 /// @cond INTERNAL_DOCUMENTATION
 #define DEV_ESSENTIAL_DEPRECATED_TYPEINFO_API                                                      \
@@ -31,6 +34,29 @@ namespace ddl {
 
 namespace dd {
 
+/**
+ * @brief The static leaf layout of a struct type as compared by @ref ddl::DDCompare::isBinaryEqual.
+ */
+struct BinaryLayout {
+    /// hash over @ref leaves, different fingerprints reject different layouts early
+    uint64_t fingerprint = 0;
+    /// type, bit offset, aligned and unaligned bit size of every leaf
+    std::vector<uint64_t> leaves;
+};
+
+/**
+ * @brief Compares two binary layouts, the fingerprints first and the leaves only if they match.
+ *
+ * @param lhs left-hand side layout
+ * @param rhs right-hand side layout
+ * @return true the layouts are equal.
+ * @return false the layouts differ.
+ */
+inline bool operator==(const BinaryLayout& lhs, const BinaryLayout& rhs)
+{
+    return lhs.fingerprint == rhs.fingerprint && lhs.leaves == rhs.leaves;
+}
+
 /**
  * TypeInfo model will check for type.
  * The TypeInfo is needed to:
@@ -154,6 +180,25 @@ public:
                 datamodel::DataDefinition& parent_dd,
                 UpdateType update_type = UpdateType::only_changed);
 
+    /**
+     * @brief Get the cached binary layout of a struct_type (see @ref setBinaryLayout).
+     * Every update of the type info resets the cached layout.
+     *
+     * @param ddl_version the DDL version the layout was calculated for.
+     * @return std::shared_ptr<const BinaryLayout> the cached layout or nullptr if there is no
+     * valid layout for the \p ddl_version.
+     */
+    std::shared_ptr<const BinaryLayout> getBinaryLayout(const Version& ddl_version) const;
+    /**
+     * @brief Caches the binary layout of a struct_type.
+     * This is used by @ref ddl::DDCompare::isBinaryEqual to compare the layouts of unchanged
+     * types without building the codec access elements again.
+     *
+     * @param ddl_version the DDL version the layout was calculated for.
+     * @param layout the layout to cache.
+     */
+    void setBinaryLayout(const Version& ddl_version, BinaryLayout layout) const;
+
 private:
     size_t _type_bit_size = 0;
     size_t _type_alignment = 0;
@@ -164,6 +209,11 @@ private:
     bool _is_valid = false;
 
     bool _already_discovering = false;
+
+    /// binary layout with the DDL version it was calculated for
+    using VersionedBinaryLayout = std::pair<Version, BinaryLayout>;
+    /// cache only, may be set on const instances from multiple threads (atomic_load/atomic_store)
+    mutable std::shared_ptr<const VersionedBinaryLayout> _binary_layout;
 };
 
 /**
@@ -306,11 +306,17 @@ public:
         std::vector<std::string> _enum_type_names;
         /**
          * Collection of struct type names that are invalidated.
+         * Each struct type is listed after all struct types of this collection it depends on.
          */
         std::vector<std::string> _struct_type_names;
+        /**
+         * Collection of stream names that are invalidated.
+         */
+        std::vector<std::string> _stream_names;
     };
     /**
-     * Collect all dependent types to the given one and sets them invalid
+     * Collect all transitive dependent types (and streams) to the given one and sets them invalid.
+     * Only the dependency cone of the given type is visited.
      * @param type_name the type_name looking for dependencies
      * @param type the type of the given \p type_name
      * @param parent_dd the dd where to set forceRevalidation
@@ -28,6 +28,16 @@ class MapConfiguration;
  */
 class MapTriggerBase {
 public:
+    /// The kind of a trigger (\ref getKind)
+    enum TriggerKind {
+        // a MapPeriodicTrigger
+        tk_periodic,
+        // a MapSignalTrigger
+        tk_signal,
+        // a MapDataTrigger
+        tk_data
+    };
+
     /**
      * CTOR
      */
@@ -48,6 +58,11 @@ public:
      */
     virtual std::string getSourceDependency() const;
 
+    /**
+     * Returns the kind of the trigger, i.e. the concrete class of the trigger
+     */
+    virtual TriggerKind getKind() const = 0;
+
     /**
      * Polymorphic comparison method
      */
@@ -117,6 +132,12 @@ public:
      */
     MapPeriodicTrigger(MapConfiguration* config);
 
+    /**
+     * Overrides MapTriggerBase
+     * @return tk_periodic
+     */
+    TriggerKind getKind() const;
+
     /**
      * Returns the period of the trigger in ms
      */
@@ -173,6 +194,12 @@ public:
      */
     MapSignalTrigger(MapConfiguration* config);
 
+    /**
+     * Overrides MapTriggerBase
+     * @return tk_signal
+     */
+    TriggerKind getKind() const;
+
     /**
      * Overrides MapTriggerBase
      */
@@ -245,6 +272,12 @@ public:
      */
     MapDataTrigger(MapConfiguration* config);
 
+    /**
+     * Overrides MapTriggerBase
+     * @return tk_data
+     */
+    TriggerKind getKind() const;
+
     /**
      * Overrides MapTriggerBase
      * @return the source dependency name
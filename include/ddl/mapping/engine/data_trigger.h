@@ -16,6 +16,8 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <ddl/mapping/engine/trigger.h>
 
+#include <cstdint>
+
 namespace ddl {
 namespace mapping {
 namespace rt {
@@ -89,18 +91,57 @@ public:
      */
     bool compare(double value);
 
+    /**
+     * Compiles the comparison for the type of the variable (see @ref compare(const void*) const).
+     * For integer variables the value to compare to is converted once into the range of
+     * variable values fulfilling the comparison.
+     * @param [in] type32 The type of the variable (see @ref DataTypes)
+     * @retval ERR_INVALID_TYPE The type is not supported
+     * @retval a_util::result::SUCCESS      Everything went fine
+     */
+    a_util::result::Result compile(uint32_t type32);
+
+    /**
+     * Method to make the compiled comparison (see @ref compile), the comparison is never fulfilled
+     * if it is not compiled.
+     * @param [in] value The memory location of the variable within the sample
+     * @return the result of the comparison
+     */
+    bool compare(const void* value) const
+    {
+        return _compare(*this, value);
+    }
+
     /**
      * Returns the period of the trigger in ms
      */
     const std::string& getVariable() const;
 
 private:
+    /// @cond nodoc
+    template <typename T>
+    void compileInteger();
+    template <typename T>
+    void compileFloat();
+    static bool compareNever(const DataTrigger& trigger, const void* value);
+    template <typename T>
+    static bool compareInteger(const DataTrigger& trigger, const void* value);
+    template <typename T, Operator op>
+    static bool compareFloat(const DataTrigger& trigger, const void* value);
+
     IMappingEnvironment& _env;
     std::string _name;
     std::string _variable_name;
     Operator _operator;
     double _value;
     bool _is_running;
+    bool (*_compare)(const DataTrigger& trigger, const void* value);
+    /// the inclusive range of integer variables fulfilling the comparison (or not fulfilling it
+    /// for e_not_equal), widened to 64 bit
+    int64_t _signed_range[2];
+    uint64_t _unsigned_range[2];
+    bool _within_range;
+    /// @endcond
 };
 
 } // namespace rt
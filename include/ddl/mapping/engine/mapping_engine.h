@@ -59,6 +59,34 @@ public:
      */
     a_util::result::Result setConfiguration(const MapConfiguration& config);
 
+    /**
+     * Switches the mapped targets to a new mapping configuration without stopping the engine.
+     * The assignments of all mapped targets are created aside from the new configuration, the
+     * target buffers and the sources with unchanged types are reused, missing sources are
+     * created. Then the engine switches to the new assignments at once between two samples, so
+     * every sample is processed completely with either the previous or the new configuration.
+     * The values of the target buffers are kept, constants of the new configuration are set.
+     * No lock is held while waiting for a sample whose triggers call the environment, so the
+     * callbacks may wait for other samples meanwhile.
+     * Changes of the types or the triggers of mapped targets and of the types of used sources
+     * require an @ref unmap and @ref Map. This includes types the environment now resolves to
+     * another binary layout than the one the target or source was created with, other changes of
+     * their definitions (e.g. element names) are not detected.
+     * @param[in] config - The new Configuration instance
+     * @param[in] timeout_us - Maximum time in microseconds to wait for the switch
+     *
+     * @retval a_util::result::SUCCESS      Everything went fine
+     * @retval ERR_INVALID_ARG  A mapped target is missing, has another type or layout or other
+     *                          triggers in the new configuration or a used source has another
+     *                          type or layout
+     * @retval ERR_FAILED       Error during creation of the new assignments, the previous
+     *                          configuration is still in use
+     * @retval ERR_TIMEOUT      No switch within the timeout, e.g. a trigger callback or a target
+     *                          reader does not return, the previous configuration is still in use
+     */
+    a_util::result::Result updateConfiguration(const MapConfiguration& config,
+                                               timestamp_t timeout_us = 1000000);
+
     /**
      * Method to instanciate or expand the mapping structure for one particular target
      * @param [in] target_name The target name
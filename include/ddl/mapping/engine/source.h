@@ -15,6 +15,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #ifndef DDL_MAPPING_RT_SOURCE_HEADER
 #define DDL_MAPPING_RT_SOURCE_HEADER
 
+#include <a_util/concurrency.h>
 #include <a_util/result.h>
 #include <ddl/codec/codec_factory.h>
 #include <ddl/mapping/configuration/map_source.h>
@@ -22,6 +23,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <ddl/mapping/engine/mapping_environment_intf.h>
 
 #include <memory>
+#include <mutex>
 
 namespace ddl {
 namespace mapping {
@@ -51,6 +53,8 @@ namespace ddl {
 namespace mapping {
 namespace rt {
 class TriggerBase;
+class SignalTrigger;
+class DataTrigger;
 class Target;
 class TargetElement;
 /**
@@ -67,7 +71,8 @@ public: // types
     // Map of source elements and a vector of target elements
     /// @cond nodec
     typedef std::vector<std::pair<AssignmentStruct, TargetElementList>> Assignments;
-    typedef std::vector<std::pair<TriggerBase*, AssignmentStruct>> Triggers;
+    typedef std::vector<SignalTrigger*> SignalTriggers;
+    typedef std::vector<std::pair<DataTrigger*, uintptr_t>> DataTriggers;
     typedef std::vector<uint8_t> MemoryBuffer;
     typedef std::set<const Target*> TargetRefList;
     /// @endcond
@@ -122,12 +127,30 @@ public:
                                          TargetElement* target_element);
 
     /**
-     * Method to add a new trigger to the intern trigger list
+     * Method to add a new signal trigger to the intern trigger list
      * @param[in] map_config The Configuration instance
      * @param[in] trigger      The trigger
      * @retval a_util::result::SUCCESS      Everything went fine
      */
-    a_util::result::Result addTrigger(const MapConfiguration& map_config, TriggerBase* trigger);
+    a_util::result::Result addTrigger(const MapConfiguration& map_config, SignalTrigger* trigger);
+
+    /**
+     * Method to add a new data trigger to the intern trigger list, the comparison of the trigger
+     * is compiled for the type of its variable
+     * @param[in] map_config The Configuration instance
+     * @param[in] trigger      The trigger
+     * @retval ERR_POINTER      The variable of the trigger was not found
+     * @retval ERR_INVALID_TYPE The type of the variable is not supported
+     * @retval a_util::result::SUCCESS      Everything went fine
+     */
+    a_util::result::Result addTrigger(const MapConfiguration& map_config, DataTrigger* trigger);
+
+    /**
+     * Method to remove a trigger from the intern trigger lists
+     * @param[in] trigger      The trigger
+     * @retval a_util::result::SUCCESS      Everything went fine
+     */
+    a_util::result::Result removeTrigger(const TriggerBase* trigger);
 
     /**
      * Method to remove all elements of a target from the intern assignment list
@@ -143,13 +166,49 @@ public:
     const std::string& getTypeName() const;
 
     /**
-     * Getter for the assignment list
+     * Getter for the description the source type was resolved with
+     * @return the type description
+     */
+    const std::string& getTypeDescription() const;
+
+    /**
+     * Getter for the assignment list (the one of a started update, if there is one)
      * @return the assignment list
      */
     const Assignments& getAssigmentList() const;
 
+    /**
+     * Starts an update of the assignments while samples are received.
+     * The assignments added until @ref commitUpdate are collected in a new and empty assignment
+     * list, the current assignments are used for the received samples meanwhile.
+     */
+    void beginUpdate();
+
+    /**
+     * Switches to the assignments of the started update.
+     * The caller has to hold the update lock (see @ref lockForUpdate) and no sample may be in
+     * progress (see @ref isProcessingSample). The previous assignments are kept until
+     * @ref endUpdate.
+     */
+    void commitUpdate();
+
+    /**
+     * Checks whether a sample is in progress, i.e. it writes the targets or calls the triggers.
+     * The caller has to hold the update lock (see @ref lockForUpdate), so no sample starts.
+     * @return @c true if a sample is in progress, @c false otherwise
+     */
+    bool isProcessingSample() const;
+
+    /**
+     * Ends an update, the previous assignments (after @ref commitUpdate) or the assignments of
+     * the update (without @ref commitUpdate) are removed.
+     */
+    void endUpdate();
+
     /**
      * Method to handle a sample when it is received.
+     * The targets are written under the shared update lock, the triggers are called after it is
+     * released, so the callbacks of the environment never run while the lock is held.
      * @param[in] data The memory location of the received buffer
      * @param[in] size The memory size of the received buffer
      * @retval a_util::result::SUCCESS      Everything went fine
@@ -157,17 +216,39 @@ public:
     a_util::result::Result onSampleReceived(const void* data, size_t size);
 
 private:
+    /// @cond nodoc
+    /// everything a received sample is written to and the triggers it calls
+    struct Program {
+        Assignments assignments;
+        TargetRefList targets;
+        TargetElementList received_elements;
+        SignalTriggers signal_triggers;
+        DataTriggers data_triggers;
+    };
+    Program& getProgramToUpdate();
+
     IMappingEnvironment& _env;
     handle_t _handle;
     std::string _name;
     std::string _type_name;
     std::string _type_description;
-    Assignments _assignments;
-    TargetRefList _targets;
+    // a received sample keeps the program it started with until its triggers were called
+    std::shared_ptr<Program> _program;
+    std::shared_ptr<Program> _update_program;
+    mutable a_util::concurrency::shared_mutex _program_mutex;
     std::unique_ptr<ddl::codec::CodecFactory> _codec_factory;
     TypeMap _type_map;
-    TargetElementList _received_elements;
-    Triggers _triggers;
+    /// @endcond
+public:
+    /**
+     * Lock the assignments for @ref commitUpdate, waits until no sample writes the targets and
+     * no sample starts until the lock is released
+     * @return The lock, it is released on destruction
+     */
+    inline std::unique_lock<a_util::concurrency::shared_mutex> lockForUpdate() const
+    {
+        return std::unique_lock<a_util::concurrency::shared_mutex>(_program_mutex);
+    }
 };
 
 /// Public composite types used in the mapping::rt namespace
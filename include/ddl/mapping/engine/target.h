@@ -78,6 +78,36 @@ public:
                                   const std::string& target_description,
                                   SourceMap& sources);
 
+    /**
+     * Starts an update of the assignments while the target is in use.
+     * The elements of the new assignments are created aside and added to the started updates of
+     * the sources (see @ref Source::beginUpdate), the current assignments are used meanwhile.
+     * The type of the target must not be changed.
+     * @param[in] map_config - The new Configuration instance, it must be kept until the next
+     *                         update or the destruction of the target
+     * @param[in] map_target - target representation from the new mapping configuration
+     * @param[in, out] sources the sources, each with a started update
+     * @retval a_util::result::SUCCESS      Everything went fine
+     * @retval ERR_FAILED       Error while creating the assignments
+     */
+    a_util::result::Result beginUpdate(const MapConfiguration& map_config,
+                                       const MapTarget& map_target,
+                                       SourceMap& sources);
+
+    /**
+     * Switches to the assignments of the started update and sets their constants.
+     * The values of the buffer are kept. The caller has to hold the buffer lock (see
+     * @ref aquireReadLock). The previous assignments are kept until @ref endUpdate.
+     * @return error code
+     */
+    a_util::result::Result commitUpdate();
+
+    /**
+     * Ends an update, the previous assignments (after @ref commitUpdate) or the assignments of
+     * the update (without @ref commitUpdate) are removed.
+     */
+    void endUpdate();
+
     /**
      * Reset target Buffers
      * @param[in] map_config - The Configuration instance
@@ -97,6 +127,12 @@ public:
      */
     const std::string& getTypeName() const;
 
+    /**
+     * Getter for the description the target type was resolved with
+     * @return the type description
+     */
+    const std::string& getTypeDescription() const;
+
     /**
      * Getter for the element list
      * @return the element list
@@ -143,12 +179,28 @@ public:
 
 private:
     /// @cond nodoc
+    /// the elements of all assignments, they are owned by the program
+    struct Program {
+        Program() = default;
+        Program(const Program&) = delete;
+        Program& operator=(const Program&) = delete;
+        ~Program();
+
+        TargetElementList target_elements;
+        std::vector<TargetElement*> simulation_time_elements;
+        TriggerCounters counter_elements;
+        Constants constant_elements;
+    };
+    a_util::result::Result createProgram(const MapConfiguration& map_config,
+                                         const MapTarget& map_target,
+                                         SourceMap& sources,
+                                         Program& program);
+
     std::string _name;
     std::string _type_name;
-    TargetElementList _target_elements;
-    std::vector<TargetElement*> _simulation_time_elements;
-    TriggerCounters _counter_elements;
-    Constants _constant_elements;
+    std::string _type_description;
+    std::unique_ptr<Program> _program;
+    std::unique_ptr<Program> _update_program;
     uint64_t _counter;
     std::unique_ptr<ddl::codec::StaticCodec> _codec;
     MemoryBuffer _buffer;
@@ -174,6 +226,15 @@ public:
         _buffer_mutex.lock();
     }
 
+    /**
+     * Try to lock the buffer for a buffer read
+     * @return @c true if the buffer is locked, @c false if it is locked by another thread
+     */
+    inline bool tryAquireReadLock() const
+    {
+        return _buffer_mutex.try_lock();
+    }
+
     /// Unlock the buffer after a buffer read
     inline void releaseReadLock() const
     {
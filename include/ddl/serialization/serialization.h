@@ -37,12 +37,12 @@ template <typename DECODER, typename ENCODER>
 a_util::result::Result transform(const DECODER& decoder, ENCODER& encoder)
 {
     try {
-        forEachLeafElement(decoder.getElements(), [&encoder](const auto& element) {
+        for (const auto& leaf_index: decoder.getLeafIndices()) {
             uint64_t value_pointer; // this is the max possible size of a data type at the moment!
                                     // Usertypes are not allowed to be greater!
-            element.getRawValue(&value_pointer, sizeof(value_pointer));
-            encoder.setElementRawValue(element.getIndex(), &value_pointer, sizeof(value_pointer));
-        });
+            decoder.getElementRawValue(leaf_index, &value_pointer, sizeof(value_pointer));
+            encoder.setElementRawValue(leaf_index, &value_pointer, sizeof(value_pointer));
+        }
     }
     catch (const std::exception&) {
         return ERR_AUTIL_UNEXPECTED;
@@ -62,6 +62,21 @@ a_util::result::Result transformToBuffer(const codec::Decoder& decoder,
                                          a_util::memory::MemoryBuffer& buffer,
                                          bool zero = false);
 
+/**
+ * Tranforms the data from a given decoder into the opposite data representation.
+ * Allocates the buffer from a pool if it is too small, so the memory of released buffers is
+ * reused for cyclic transformations.
+ * @param[in] decoder The source decoder.
+ * @param[out] buffer The destination buffer object.
+ * @param[in] pool The pool to allocate the buffer from.
+ * @param[in] zero Whether or not to memzero the buffer before writing the elements to it.
+ * @return Standard result.
+ */
+a_util::result::Result transformToBuffer(const codec::Decoder& decoder,
+                                         a_util::memory::MemoryBuffer& buffer,
+                                         a_util::memory::MemoryBufferPool& pool,
+                                         bool zero = false);
+
 } // namespace codec
 } // namespace ddl
 
@@ -0,0 +1,313 @@
+/**
+ * @file
+ * Work stealing executor implementation
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "work_stealing_deque.h"
+
+#include <a_util/concurrency/executor.h>
+
+#include <cstdint>
+#include <deque>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace {
+
+struct PlatformSpecific {
+#if defined(__linux__)
+    static void setCurrentThreadName(const std::string& name)
+    {
+        // the kernel limits the name to 15 characters and the terminating null
+        pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+    }
+    static void pinCurrentThread(std::size_t index)
+    {
+        cpu_set_t available;
+        CPU_ZERO(&available);
+        if (sched_getaffinity(0, sizeof(available), &available) != 0 ||
+            CPU_COUNT(&available) == 0) {
+            return;
+        }
+        std::size_t nth = index % static_cast<std::size_t>(CPU_COUNT(&available));
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &available) && nth-- == 0) {
+                cpu_set_t pinned;
+                CPU_ZERO(&pinned);
+                CPU_SET(cpu, &pinned);
+                pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned);
+                return;
+            }
+        }
+    }
+#elif defined(_WIN32)
+    static void setCurrentThreadName(const std::string&)
+    {
+    }
+    static void pinCurrentThread(std::size_t index)
+    {
+        DWORD_PTR process_mask = 0, system_mask = 0;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask) ||
+            process_mask == 0) {
+            return;
+        }
+        std::size_t cpu_count = 0;
+        for (DWORD_PTR mask = process_mask; mask != 0; mask &= mask - 1) {
+            ++cpu_count;
+        }
+        std::size_t nth = index % cpu_count;
+        for (DWORD_PTR mask = process_mask; mask != 0; mask &= mask - 1) {
+            if (nth-- == 0) {
+                SetThreadAffinityMask(GetCurrentThread(), mask & ~(mask - 1));
+                return;
+            }
+        }
+    }
+#else
+    static void setCurrentThreadName(const std::string&)
+    {
+    }
+    static void pinCurrentThread(std::size_t)
+    {
+    }
+#endif
+};
+
+/// the executor whose worker runs on the current thread
+thread_local const void* current_executor = nullptr;
+/// the index of the worker running on the current thread
+thread_local std::size_t current_worker = 0;
+
+} // namespace
+
+namespace a_util {
+namespace concurrency {
+namespace detail {
+
+executor_continuations::executor_continuations(executor& owner)
+    : _executor(owner), _mutex(), _completed(false), _continuations()
+{
+}
+
+void executor_continuations::add(std::unique_ptr<executor_task> continuation)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_completed) {
+            _continuations.push_back(std::move(continuation));
+            return;
+        }
+    }
+    _executor.schedule(std::move(continuation), true);
+}
+
+void executor_continuations::complete()
+{
+    std::vector<std::unique_ptr<executor_task>> continuations;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _completed = true;
+        continuations.swap(_continuations);
+    }
+    for (auto& continuation: continuations) {
+        _executor.schedule(std::move(continuation), true);
+    }
+}
+
+executor& executor_continuations::get_executor() const
+{
+    return _executor;
+}
+
+} // namespace detail
+
+class executor::Implementation {
+public:
+    explicit Implementation(const executor_options& options)
+        : _max_queued(static_cast<std::int64_t>(options.max_queued_tasks))
+    {
+        std::size_t thread_count = options.thread_count;
+        if (thread_count == 0) {
+            thread_count = std::max(1u, std::thread::hardware_concurrency());
+        }
+        for (std::size_t index = 0; index < thread_count; ++index) {
+            _workers.emplace_back(new Worker());
+        }
+        for (std::size_t index = 0; index < thread_count; ++index) {
+            _workers[index]->thread = std::thread([this, index, options]() {
+                PlatformSpecific::setCurrentThreadName(options.thread_name +
+                                                       std::to_string(index));
+                if (options.pin_threads) {
+                    PlatformSpecific::pinCurrentThread(index);
+                }
+                run(index);
+            });
+        }
+    }
+
+    ~Implementation()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _work_available.notify_all();
+        _space_available.notify_all();
+        for (auto& worker: _workers) {
+            worker->thread.join();
+        }
+        // only tasks queued from other threads during destruction are left
+        for (detail::executor_task* task: _injected) {
+            delete task;
+        }
+    }
+
+    std::size_t getThreadCount() const
+    {
+        return _workers.size();
+    }
+
+    bool schedule(std::unique_ptr<detail::executor_task> task, bool wait_for_space)
+    {
+        if (current_executor == this) {
+            // the queued count is incremented after pushing, the taking worker might decrement
+            // before, so the count can be negative shortly
+            _workers[current_worker]->deque.push(task.release());
+            _queued.fetch_add(1);
+            if (_sleeping.load() > 0) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _work_available.notify_one();
+            }
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_max_queued > 0) {
+            if (!wait_for_space && _queued.load() >= _max_queued) {
+                return false;
+            }
+            ++_blocked;
+            _space_available.wait(lock, [this]() { return _stop || _queued.load() < _max_queued; });
+            --_blocked;
+        }
+        _injected.push_back(task.release());
+        _queued.fetch_add(1);
+        if (_sleeping.load() > 0) {
+            _work_available.notify_one();
+        }
+        return true;
+    }
+
+private:
+    struct Worker {
+        detail::WorkStealingDeque<detail::executor_task*> deque;
+        std::thread thread;
+    };
+
+    void run(std::size_t index)
+    {
+        current_executor = this;
+        current_worker = index;
+        for (;;) {
+            if (detail::executor_task* const task = take(index)) {
+                _queued.fetch_sub(1);
+                if (_blocked.load() > 0) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _space_available.notify_one();
+                }
+                try {
+                    task->run();
+                }
+                catch (...) {
+                    // exceptions of posted tasks are discarded, submitted tasks store them
+                }
+                delete task;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            // the sleeping count is incremented before checking the queued count, a scheduling
+            // thread increments the queued count before checking the sleeping count
+            ++_sleeping;
+            _work_available.wait(lock, [this]() { return _stop || _queued.load() > 0; });
+            --_sleeping;
+            if (_stop && _queued.load() <= 0) {
+                return;
+            }
+        }
+    }
+
+    detail::executor_task* take(std::size_t index)
+    {
+        if (detail::executor_task* const task = _workers[index]->deque.pop()) {
+            return task;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_injected.empty()) {
+                detail::executor_task* const task = _injected.front();
+                _injected.pop_front();
+                return task;
+            }
+        }
+        for (std::size_t offset = 1; offset < _workers.size(); ++offset) {
+            const std::size_t victim = (index + offset) % _workers.size();
+            if (detail::executor_task* const task = _workers[victim]->deque.steal()) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    const std::int64_t _max_queued;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    /// protects the injected tasks and the sleep of workers and blocked submitters
+    std::mutex _mutex;
+    std::deque<detail::executor_task*> _injected;
+    std::condition_variable _work_available;
+    std::condition_variable _space_available;
+    std::atomic<std::int64_t> _queued{0};
+    std::atomic<int> _sleeping{0};
+    std::atomic<int> _blocked{0};
+    bool _stop = false;
+};
+
+executor::executor() : executor(executor_options())
+{
+}
+
+executor::executor(const executor_options& options) : _impl(new Implementation(options))
+{
+}
+
+executor::~executor()
+{
+}
+
+std::size_t executor::thread_count() const
+{
+    return _impl->getThreadCount();
+}
+
+bool executor::schedule(std::unique_ptr<detail::executor_task> task, bool wait_for_space)
+{
+    return _impl->schedule(std::move(task), wait_for_space);
+}
+
+} // namespace concurrency
+} // namespace a_util
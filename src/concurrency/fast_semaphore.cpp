@@ -0,0 +1,120 @@
+/**
+ * @file
+ * Fast semaphore implementation
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "futex.h"
+
+#include <a_util/concurrency/fast_semaphore.h>
+
+namespace a_util {
+namespace concurrency {
+namespace {
+// the amount of counter loads before going to sleep, a notify often follows shortly
+constexpr int spin_count = 100;
+} // namespace
+
+void fast_semaphore::reset()
+{
+    std::int32_t count = _count.load(std::memory_order_relaxed);
+    while (count > 0 &&
+           !_count.compare_exchange_weak(
+               count, 0, std::memory_order_acquire, std::memory_order_relaxed)) {
+    }
+}
+
+void fast_semaphore::wakeOne()
+{
+    // the notifying thread made the waiter's decrement succeed, the wake up grants it to the
+    // next waiter taking it, regardless whether it already sleeps or not
+    _wakeups.fetch_add(1, std::memory_order_release);
+    detail::futexWakeOne(_wakeups);
+}
+
+bool fast_semaphore::spin()
+{
+    for (int spin = spin_count; spin > 0; --spin) {
+        // stop spinning on sleeping waiters, they will get the next notification before us
+        const std::int32_t count = _count.load(std::memory_order_relaxed);
+        if (count < 0) {
+            return false;
+        }
+        if (count > 0 && try_wait()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool fast_semaphore::tryConsumeWakeup()
+{
+    std::uint32_t wakeups = _wakeups.load(std::memory_order_relaxed);
+    while (wakeups > 0) {
+        if (_wakeups.compare_exchange_weak(
+                wakeups, wakeups - 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void fast_semaphore::waitContended()
+{
+    if (spin()) {
+        return;
+    }
+    // registers as sleeping waiter if the counter is still zero or negative
+    if (_count.fetch_sub(1, std::memory_order_acquire) > 0) {
+        return;
+    }
+    while (!tryConsumeWakeup()) {
+        detail::futexWait(_wakeups, 0);
+    }
+}
+
+bool fast_semaphore::waitForContended(std::chrono::nanoseconds timeout)
+{
+    if (timeout.count() == 0) {
+        return false;
+    }
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    if (spin()) {
+        return true;
+    }
+    if (_count.fetch_sub(1, std::memory_order_acquire) > 0) {
+        return true;
+    }
+    for (;;) {
+        if (tryConsumeWakeup()) {
+            return true;
+        }
+        const auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining.count() <= 0) {
+            break;
+        }
+        detail::futexWaitFor(_wakeups, 0, remaining);
+    }
+
+    // unregister as sleeping waiter, unless a notification already counted on us
+    std::int32_t count = _count.load(std::memory_order_relaxed);
+    while (count < 0) {
+        if (_count.compare_exchange_weak(
+                count, count + 1, std::memory_order_relaxed, std::memory_order_relaxed)) {
+            return false;
+        }
+    }
+    // the notifying thread is about to publish the wake up, it must not get lost
+    while (!tryConsumeWakeup()) {
+        detail::futexWait(_wakeups, 0);
+    }
+    return true;
+}
+
+} // namespace concurrency
+} // namespace a_util
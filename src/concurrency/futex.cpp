@@ -0,0 +1,160 @@
+/**
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "futex.h"
+
+#if defined(__linux__)
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#include <ctime>
+
+namespace {
+
+struct PlatformSpecific {
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                  "the futex syscall needs a plain 32 bit value");
+
+    static std::uint32_t* getAddress(const std::atomic<std::uint32_t>& futex)
+    {
+        return const_cast<std::uint32_t*>(reinterpret_cast<const std::uint32_t*>(&futex));
+    }
+    static inline void wait(const std::atomic<std::uint32_t>& futex,
+                            std::uint32_t expected,
+                            const struct timespec* timeout = nullptr)
+    {
+        // EAGAIN (value changed), EINTR and ETIMEDOUT are spurious wake ups for the caller
+        syscall(SYS_futex, getAddress(futex), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+    }
+    static inline void waitFor(const std::atomic<std::uint32_t>& futex,
+                               std::uint32_t expected,
+                               std::chrono::nanoseconds timeout)
+    {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        struct timespec relative;
+        relative.tv_sec = static_cast<time_t>(seconds.count());
+        relative.tv_nsec = static_cast<long>((timeout - seconds).count());
+        wait(futex, expected, &relative);
+    }
+    static inline bool wake(const std::atomic<std::uint32_t>& futex, int count)
+    {
+        return syscall(
+                   SYS_futex, getAddress(futex), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0) >
+               0;
+    }
+};
+
+} // namespace
+
+#else // other platforms
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace {
+
+/// a fixed set of condition variables shared by all waiting addresses with the same hash
+class ParkingLot {
+public:
+    static ParkingLot& getSlot(const std::atomic<std::uint32_t>& futex)
+    {
+        static ParkingLot slots[slot_count];
+        const std::size_t address = reinterpret_cast<std::size_t>(&futex);
+        return slots[(address / sizeof(std::uint32_t)) % slot_count];
+    }
+
+    void wait(const std::atomic<std::uint32_t>& futex, std::uint32_t expected)
+    {
+        // the value is checked with the mutex locked, a wake after the change locks the mutex
+        // before notifying, so the wake up can not get lost in between
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (futex.load(std::memory_order_acquire) == expected) {
+            _condition.wait(lock);
+        }
+    }
+
+    void waitFor(const std::atomic<std::uint32_t>& futex,
+                 std::uint32_t expected,
+                 std::chrono::nanoseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (futex.load(std::memory_order_acquire) == expected) {
+            _condition.wait_for(lock, timeout);
+        }
+    }
+
+    void wakeAll()
+    {
+        { std::lock_guard<std::mutex> lock(_mutex); }
+        // other addresses may share the slot, so all threads are woken
+        _condition.notify_all();
+    }
+
+private:
+    static constexpr std::size_t slot_count = 64;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+};
+
+struct PlatformSpecific {
+    static inline void wait(const std::atomic<std::uint32_t>& futex, std::uint32_t expected)
+    {
+        ParkingLot::getSlot(futex).wait(futex, expected);
+    }
+    static inline void waitFor(const std::atomic<std::uint32_t>& futex,
+                               std::uint32_t expected,
+                               std::chrono::nanoseconds timeout)
+    {
+        ParkingLot::getSlot(futex).waitFor(futex, expected, timeout);
+    }
+    static inline bool wake(const std::atomic<std::uint32_t>& futex, int)
+    {
+        ParkingLot::getSlot(futex).wakeAll();
+        return false;
+    }
+};
+
+} // namespace
+
+#endif // __linux__
+
+namespace a_util {
+namespace concurrency {
+namespace detail {
+
+void futexWait(const std::atomic<std::uint32_t>& futex, std::uint32_t expected)
+{
+    PlatformSpecific::wait(futex, expected);
+}
+
+void futexWaitFor(const std::atomic<std::uint32_t>& futex,
+                  std::uint32_t expected,
+                  std::chrono::nanoseconds timeout)
+{
+    if (timeout.count() > 0) {
+        PlatformSpecific::waitFor(futex, expected, timeout);
+    }
+}
+
+bool futexWakeOne(const std::atomic<std::uint32_t>& futex)
+{
+    return PlatformSpecific::wake(futex, 1);
+}
+
+void futexWakeAll(const std::atomic<std::uint32_t>& futex)
+{
+    PlatformSpecific::wake(futex, INT_MAX);
+}
+
+} // namespace detail
+} // namespace concurrency
+} // namespace a_util
@@ -0,0 +1,63 @@
+/**
+ * @file
+ * Waiting for and waking on an atomic 32 bit value, used to build the blocking concurrency
+ * primitives on top of a state word.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef A_UTIL_UTIL_CONCURRENCY_DETAIL_FUTEX_HEADER_INCLUDED
+#define A_UTIL_UTIL_CONCURRENCY_DETAIL_FUTEX_HEADER_INCLUDED
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace a_util {
+namespace concurrency {
+namespace detail {
+/**
+ * Blocks the calling thread as long as @c futex contains @c expected and no wake function is
+ * called for it. Spurious wake ups are possible, so the caller has to check its condition again.
+ * On Linux this is a futex wait, on other platforms the thread waits on one of a fixed set of
+ * condition variables chosen by the address of @c futex.
+ * @param[in] futex The value to wait on.
+ * @param[in] expected The value of @c futex to block on.
+ */
+void futexWait(const std::atomic<std::uint32_t>& futex, std::uint32_t expected);
+
+/**
+ * Like @ref futexWait, but blocks at most for @c timeout.
+ * @param[in] futex The value to wait on.
+ * @param[in] expected The value of @c futex to block on.
+ * @param[in] timeout The maximum time to block.
+ */
+void futexWaitFor(const std::atomic<std::uint32_t>& futex,
+                  std::uint32_t expected,
+                  std::chrono::nanoseconds timeout);
+
+/**
+ * Wakes one thread waiting on @c futex (see @ref futexWait).
+ * The value has to be changed before, otherwise the wake up might be lost.
+ * @param[in] futex The value threads are waiting on.
+ * @retval true A thread was woken.
+ * @retval false No thread was woken or it is unknown (all platforms except Linux).
+ */
+bool futexWakeOne(const std::atomic<std::uint32_t>& futex);
+
+/**
+ * Wakes all threads waiting on @c futex (see @ref futexWait).
+ * The value has to be changed before, otherwise the wake up might be lost.
+ * @param[in] futex The value threads are waiting on.
+ */
+void futexWakeAll(const std::atomic<std::uint32_t>& futex);
+
+} // namespace detail
+} // namespace concurrency
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_CONCURRENCY_DETAIL_FUTEX_HEADER_INCLUDED
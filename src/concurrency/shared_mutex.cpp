@@ -11,129 +11,280 @@
 
 #ifndef HAVE_SHARED_MUTEX
 
-#include <a_util/concurrency.h>
+#include "futex.h"
 
-#include <cstddef>
+#include <a_util/concurrency/shared_mutex.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
 
 namespace a_util {
 namespace concurrency {
-static const std::int32_t write_lock_active = 1u << 31;     // "-2^31"
-static const std::int32_t max_readers = ~write_lock_active; // "+2^31"
+namespace {
+// The state word contains the amount of readers in the lower 30 bits, a write lock is signaled by
+// all of these bits being set. The upper bits signal readers or writers sleeping in a futex wait.
+constexpr std::uint32_t read_locked = 1;
+constexpr std::uint32_t lock_mask = (1u << 30) - 1;
+constexpr std::uint32_t write_locked = lock_mask;
+constexpr std::uint32_t max_readers = lock_mask - 1;
+constexpr std::uint32_t readers_waiting = 1u << 30;
+constexpr std::uint32_t writers_waiting = 1u << 31;
+// the amount of state loads before going to sleep, since most locks are held only shortly
+constexpr int spin_count = 100;
+
+inline bool isUnlocked(std::uint32_t state)
+{
+    return (state & lock_mask) == 0;
+}
+
+inline bool isWriteLocked(std::uint32_t state)
+{
+    return (state & lock_mask) == write_locked;
+}
+
+inline bool hasReadersWaiting(std::uint32_t state)
+{
+    return (state & readers_waiting) != 0;
+}
+
+inline bool hasWritersWaiting(std::uint32_t state)
+{
+    return (state & writers_waiting) != 0;
+}
+
+/// new readers have to wait for waiting writers, this is what makes the mutex writer-preferring
+inline bool isReadLockable(std::uint32_t state)
+{
+    return (state & lock_mask) < max_readers && !hasReadersWaiting(state) &&
+           !hasWritersWaiting(state);
+}
+
+inline bool hasReachedMaxReaders(std::uint32_t state)
+{
+    return (state & lock_mask) == max_readers;
+}
+
+} // namespace
 
 struct shared_mutex::impl {
-    mutex mtx;
-    int32_t flag;
-    condition_variable cond1;
-    condition_variable cond2;
+    std::atomic<std::uint32_t> state{0};
+    /// incremented for every writer wake up, the writers wait on this instead of the state
+    std::atomic<std::uint32_t> writer_notify{0};
+
+    template <typename Condition>
+    std::uint32_t spinUntil(Condition condition) const
+    {
+        for (int spin = spin_count;; --spin) {
+            const std::uint32_t current = state.load(std::memory_order_relaxed);
+            if (spin == 0 || condition(current)) {
+                return current;
+            }
+        }
+    }
+
+    std::uint32_t spinRead() const
+    {
+        // stop spinning on waiting threads as well, they will not get the lock before us
+        return spinUntil([](std::uint32_t current) {
+            return !isWriteLocked(current) || hasReadersWaiting(current) ||
+                   hasWritersWaiting(current);
+        });
+    }
+
+    std::uint32_t spinWrite() const
+    {
+        return spinUntil([](std::uint32_t current) {
+            return isUnlocked(current) || hasWritersWaiting(current);
+        });
+    }
+
+    void lockSharedContended()
+    {
+        std::uint32_t current = spinRead();
+        for (;;) {
+            if (isReadLockable(current)) {
+                if (state.compare_exchange_weak(current,
+                                                current + read_locked,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+                    return;
+                }
+                continue;
+            }
+            if (hasReachedMaxReaders(current)) {
+                // (very improbable) all reader slots are taken, nobody would wake us up
+                std::this_thread::yield();
+                current = state.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (!hasReadersWaiting(current)) {
+                if (!state.compare_exchange_weak(current,
+                                                 current | readers_waiting,
+                                                 std::memory_order_relaxed,
+                                                 std::memory_order_relaxed)) {
+                    continue;
+                }
+            }
+            detail::futexWait(state, current | readers_waiting);
+            current = spinRead();
+        }
+    }
+
+    void lockContended()
+    {
+        std::uint32_t current = spinWrite();
+        // set after we slept once, other writers might still sleep and have to be woken later
+        std::uint32_t other_writers_waiting = 0;
+        for (;;) {
+            if (isUnlocked(current)) {
+                if (state.compare_exchange_weak(current,
+                                                current | write_locked | other_writers_waiting,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+                    return;
+                }
+                continue;
+            }
+            if (!hasWritersWaiting(current)) {
+                if (!state.compare_exchange_weak(current,
+                                                 current | writers_waiting,
+                                                 std::memory_order_relaxed,
+                                                 std::memory_order_relaxed)) {
+                    continue;
+                }
+            }
+            other_writers_waiting = writers_waiting;
+            // check the state again after reading the notification counter, an unlock in between
+            // increments the counter and the wait returns immediately
+            const std::uint32_t notify = writer_notify.load(std::memory_order_acquire);
+            current = state.load(std::memory_order_relaxed);
+            if (isUnlocked(current) || !hasWritersWaiting(current)) {
+                continue;
+            }
+            detail::futexWait(writer_notify, notify);
+            current = spinWrite();
+        }
+    }
+
+    bool wakeWriter()
+    {
+        writer_notify.fetch_add(1, std::memory_order_release);
+        return detail::futexWakeOne(writer_notify);
+    }
+
+    /// called with an unlocked state and waiting threads, prefers waking one writer
+    void wakeWriterOrReaders(std::uint32_t current)
+    {
+        if (current == writers_waiting) {
+            // the flag stays set for the woken writer, otherwise new readers could overtake it
+            if (wakeWriter()) {
+                return;
+            }
+            // no writer was sleeping (anymore) or it is unknown, a still waiting writer sets the
+            // flag again
+            if (state.compare_exchange_strong(
+                    current, 0, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        if (current == (readers_waiting | writers_waiting)) {
+            if (!state.compare_exchange_strong(current,
+                                               readers_waiting,
+                                               std::memory_order_relaxed,
+                                               std::memory_order_relaxed)) {
+                // somebody locked meanwhile and will do the wake up on unlock
+                return;
+            }
+            if (wakeWriter()) {
+                // the readers keep waiting for the writer to unlock
+                return;
+            }
+            // no writer was sleeping (anymore), so the readers get the lock
+            current = readers_waiting;
+        }
+        if (current == readers_waiting) {
+            if (state.compare_exchange_strong(
+                    current, 0, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                detail::futexWakeAll(state);
+            }
+        }
+    }
 };
 
 shared_mutex::shared_mutex() : p(new impl())
 {
-    p->flag = 0;
 }
 
 shared_mutex::~shared_mutex()
 {
-    // finalize any locking operations underway
-    unique_lock<mutex> _(p->mtx);
 }
 
 void shared_mutex::lock()
 {
-    unique_lock<mutex> mtx(p->mtx);
-
-    // wait if already write-locked
-    while (p->flag & write_lock_active) {
-        p->cond1.wait(mtx);
-    }
-
-    // set writer-bit
-    p->flag |= write_lock_active;
-
-    // wait for remaining reader-locks to unlock
-    while (p->flag & max_readers) {
-        p->cond2.wait(mtx);
+    std::uint32_t current = 0;
+    if (!p->state.compare_exchange_weak(
+            current, write_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+        p->lockContended();
     }
 }
 
 bool shared_mutex::try_lock()
 {
-    unique_lock<mutex> _(p->mtx);
-
-    // no need for bit-fiddling, simply check if no locks are active at all
-    if (p->flag == 0) {
-        p->flag = write_lock_active;
-        return true;
+    std::uint32_t current = p->state.load(std::memory_order_relaxed);
+    while (isUnlocked(current)) {
+        if (p->state.compare_exchange_weak(current,
+                                           current | write_locked,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+            return true;
+        }
     }
     return false;
 }
 
 void shared_mutex::unlock()
 {
-    unique_lock<mutex> _(p->mtx);
-    // simple, since its an exclusive lock
-    p->flag = 0;
-
-    // notify any new locks that may be awaiting the unlock
-    p->cond1.notify_all();
+    const std::uint32_t current =
+        p->state.fetch_sub(write_locked, std::memory_order_release) - write_locked;
+    if (hasReadersWaiting(current) || hasWritersWaiting(current)) {
+        p->wakeWriterOrReaders(current);
+    }
 }
 
 void shared_mutex::lock_shared()
 {
-    unique_lock<mutex> mtx(p->mtx);
-    // wait for any write-locks to unlock and (very improbable) while all reader slots are taken
-    while ((p->flag & write_lock_active) || (p->flag & max_readers) == max_readers) {
-        p->cond1.wait(mtx);
+    std::uint32_t current = p->state.load(std::memory_order_relaxed);
+    if (!isReadLockable(current) ||
+        !p->state.compare_exchange_weak(current,
+                                        current + read_locked,
+                                        std::memory_order_acquire,
+                                        std::memory_order_relaxed)) {
+        p->lockSharedContended();
     }
-
-    /// get new actual number of readers (without the write-lock bit)
-    int32_t readers = (p->flag & max_readers) + 1;
-
-    // set new reader count
-    p->flag &= ~max_readers;
-    p->flag |= readers;
 }
 
 bool shared_mutex::try_lock_shared()
 {
-    unique_lock<mutex> _(p->mtx);
-
-    // get current number of readers
-    int32_t readers = p->flag & max_readers;
-
-    // only lock if no write lock is active and there is a reader slot available
-    if (!(p->flag & write_lock_active) && readers != max_readers) {
-        // increment and set new reader count
-        readers++;
-        p->flag &= ~max_readers;
-        p->flag |= readers;
-        return true;
+    std::uint32_t current = p->state.load(std::memory_order_relaxed);
+    while (isReadLockable(current)) {
+        if (p->state.compare_exchange_weak(current,
+                                           current + read_locked,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+            return true;
+        }
     }
     return false;
 }
 
 void shared_mutex::unlock_shared()
 {
-    unique_lock<mutex> _(p->mtx);
-
-    // get, decrement & set new number of readers
-    int32_t readers = (p->flag & max_readers) - 1;
-    if (readers >= 0) {
-        p->flag &= ~max_readers;
-        p->flag |= readers;
-
-        if (p->flag & write_lock_active) {
-            // awake the waiting write-lock if we were the last reader
-            if (readers == 0) {
-                p->cond2.notify_one();
-            }
-        }
-        else {
-            // notify any waiting readers that there is a free slot now
-            if (readers == max_readers - 1) {
-                p->cond1.notify_one();
-            }
-        }
+    const std::uint32_t current =
+        p->state.fetch_sub(read_locked, std::memory_order_release) - read_locked;
+    // the last reader wakes a waiting writer, readers only wait while a writer waits or runs
+    if (isUnlocked(current) && hasWritersWaiting(current)) {
+        p->wakeWriterOrReaders(current);
     }
 }
 
@@ -0,0 +1,136 @@
+/**
+ * @file
+ * Lock-free work stealing deque of pointers, used by the executor.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef A_UTIL_UTIL_CONCURRENCY_DETAIL_WORK_STEALING_DEQUE_HEADER_INCLUDED
+#define A_UTIL_UTIL_CONCURRENCY_DETAIL_WORK_STEALING_DEQUE_HEADER_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace a_util {
+namespace concurrency {
+namespace detail {
+/**
+ * Chase-Lev deque with the memory orders of "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+ * Only the owning thread may push and pop at the bottom, any thread may steal from the top.
+ * Arrays replaced on growth are kept until destruction, since thieves might still read them.
+ * @tparam T The pointer type of the elements, a null pointer signals an empty deque.
+ */
+template <typename T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(std::int64_t capacity = 256)
+    {
+        _arrays.emplace_back(new Array(capacity));
+        _array.store(_arrays.back().get(), std::memory_order_relaxed);
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /// owner only
+    void push(T item)
+    {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = _top.load(std::memory_order_acquire);
+        Array* array = _array.load(std::memory_order_relaxed);
+        if (bottom - top > array->capacity - 1) {
+            array = grow(array, top, bottom);
+        }
+        array->put(bottom, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /// owner only, returns the most recently pushed item
+    T pop()
+    {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        Array* array = _array.load(std::memory_order_relaxed);
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = _top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T item = array->get(bottom);
+        if (top == bottom) {
+            // the last item, race against the thieves
+            if (!_top.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /// any thread, returns the least recently pushed item
+    T steal()
+    {
+        std::int64_t top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = _bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        T item = _array.load(std::memory_order_acquire)->get(top);
+        if (!_top.compare_exchange_strong(
+                top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+private:
+    struct Array {
+        explicit Array(std::int64_t size) : capacity(size), slots(new std::atomic<T>[size])
+        {
+        }
+        T get(std::int64_t index) const
+        {
+            return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+        }
+        void put(std::int64_t index, T item)
+        {
+            slots[index & (capacity - 1)].store(item, std::memory_order_relaxed);
+        }
+
+        const std::int64_t capacity; // power of 2
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    Array* grow(Array* array, std::int64_t top, std::int64_t bottom)
+    {
+        std::unique_ptr<Array> grown(new Array(array->capacity * 2));
+        for (std::int64_t index = top; index < bottom; ++index) {
+            grown->put(index, array->get(index));
+        }
+        _arrays.push_back(std::move(grown));
+        _array.store(_arrays.back().get(), std::memory_order_release);
+        return _arrays.back().get();
+    }
+
+    std::atomic<std::int64_t> _top{0};
+    std::atomic<std::int64_t> _bottom{0};
+    std::atomic<Array*> _array{nullptr};
+    /// owner only
+    std::vector<std::unique_ptr<Array>> _arrays;
+};
+
+} // namespace detail
+} // namespace concurrency
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_CONCURRENCY_DETAIL_WORK_STEALING_DEQUE_HEADER_INCLUDED
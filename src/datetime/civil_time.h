@@ -0,0 +1,127 @@
+/**
+ * @file
+ * Conversion between days since the unix time origin and dates of the proleptic gregorian calendar
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef A_UTIL_UTIL_DATETIME_DETAIL_CIVIL_TIME_HEADER_INCLUDED
+#define A_UTIL_UTIL_DATETIME_DETAIL_CIVIL_TIME_HEADER_INCLUDED
+
+#include <a_util/base/types.h>
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+
+namespace a_util {
+namespace datetime {
+namespace detail {
+/// Number of microseconds that have elapsed between julian day and unix time.
+constexpr timestamp_t timeDifferenceJulian2Unix = 210866803200000000LL;
+/// Microseconds per second
+constexpr timestamp_t usecs_per_second = 1000000;
+/// Seconds per day
+constexpr std::int64_t secs_per_day = 86400;
+
+/**
+ * Divide rounding towards negative infinity, so times before the origin map to the right day
+ * @param[in] dividend The dividend
+ * @param[in] divisor The divisor, has to be positive
+ * @return The quotient rounded down
+ */
+inline std::int64_t floorDivide(std::int64_t dividend, std::int64_t divisor)
+{
+    return (dividend >= 0 ? dividend : dividend - divisor + 1) / divisor;
+}
+
+/**
+ * Get the days since 1970-01-01 of a date (the algorithm of H. Hinnant, "chrono-Compatible
+ * Low-Level Date Algorithms")
+ * @param[in] year The year
+ * @param[in] month The month (1 - 12)
+ * @param[in] day The day of the month (1 - 31)
+ * @return The number of days since the unix time origin
+ */
+inline std::int64_t daysFromCivil(std::int64_t year, int month, int day)
+{
+    year -= month <= 2 ? 1 : 0;
+    const std::int64_t era = floorDivide(year, 400);
+    const std::int64_t year_of_era = year - era * 400;
+    const std::int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const std::int64_t day_of_era =
+        year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+/**
+ * Get the date of a day since 1970-01-01, inverse of @ref daysFromCivil
+ * @param[in] days The number of days since the unix time origin
+ * @param[out] year The year
+ * @param[out] month The month (1 - 12)
+ * @param[out] day The day of the month (1 - 31)
+ */
+inline void civilFromDays(std::int64_t days, int& year, int& month, int& day)
+{
+    days += 719468;
+    const std::int64_t era = floorDivide(days, 146097);
+    const std::int64_t day_of_era = days - era * 146097;
+    const std::int64_t year_of_era =
+        (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const std::int64_t day_of_year =
+        day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const std::int64_t shifted_month = (5 * day_of_year + 2) / 153;
+    day = static_cast<int>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+    month = static_cast<int>(shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+    year = static_cast<int>(year_of_era + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+/**
+ * Fill the ANSI time structure completely (including week and year day) without consulting the
+ * time zone database, the seconds are taken as they are.
+ * @param[in] seconds Seconds since 1970-01-01 00:00:00 of the time to break down
+ * @param[out] time_info The broken down time, @c tm_isdst is always 0
+ */
+inline void toTimeInfo(std::int64_t seconds, tm& time_info)
+{
+    const std::int64_t days = floorDivide(seconds, secs_per_day);
+    const std::int64_t second_of_day = seconds - days * secs_per_day;
+    int year = 0, month = 0, day = 0;
+    civilFromDays(days, year, month, day);
+
+    time_info = tm();
+    time_info.tm_year = year - 1900;
+    time_info.tm_mon = month - 1;
+    time_info.tm_mday = day;
+    time_info.tm_hour = static_cast<int>(second_of_day / 3600);
+    time_info.tm_min = static_cast<int>(second_of_day / 60 % 60);
+    time_info.tm_sec = static_cast<int>(second_of_day % 60);
+    // 1970-01-01 was a thursday
+    time_info.tm_wday = static_cast<int>(days - floorDivide(days + 4, 7) * 7 + 4);
+    time_info.tm_yday = static_cast<int>(days - daysFromCivil(year, 1, 1));
+}
+
+/**
+ * Check a strftime format string for codes which are not supported by @ref DateTime::format
+ * @param[in] format The format string
+ * @throw std::invalid_argument If the format string contains an unsupported code
+ */
+void checkFormat(const std::string& format);
+
+/**
+ * Render the ANSI time structure with @c strftime
+ * @param[in] time_info The broken down time
+ * @param[in] format The checked format string
+ * @return The rendered string
+ */
+std::string renderTimeInfo(const tm& time_info, const std::string& format);
+
+} // namespace detail
+} // namespace datetime
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_DATETIME_DETAIL_CIVIL_TIME_HEADER_INCLUDED
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * Fast clocks, cached UTC offset and timestamp formatting
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "civil_time.h"
+
+#include <a_util/datetime/clock.h>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+
+namespace a_util {
+namespace datetime {
+namespace {
+/**
+ * The minute (plus one) of the cached offset in the upper, the offset in seconds in the lower 32
+ * bits, 0 if no offset is cached. Packed into one word, the lookup needs no lock.
+ */
+std::atomic<std::uint64_t> cached_utc_offset{0};
+
+/// Reload the time zone information (@c TZ or the system setting) if it has been changed
+void reloadTimeZone()
+{
+#ifdef _WIN32
+    ::_tzset();
+#else
+    ::tzset();
+#endif // _WIN32
+}
+
+/// Ask the C library for the UTC offset in seconds, this takes the lock of the time zone database
+std::int64_t lookUpUtcOffset(std::int64_t seconds)
+{
+    const time_t time = static_cast<time_t>(seconds);
+    tm local_time;
+#ifdef _WIN32
+    if (::localtime_s(&local_time, &time) != 0) {
+        return 0;
+    }
+#else
+    if (::localtime_r(&time, &local_time) == nullptr) {
+        return 0;
+    }
+#endif // _WIN32
+
+    const std::int64_t local_days = detail::daysFromCivil(
+        local_time.tm_year + 1900, local_time.tm_mon + 1, local_time.tm_mday);
+    const std::int64_t local_seconds = local_days * detail::secs_per_day +
+                                       local_time.tm_hour * 3600 + local_time.tm_min * 60 +
+                                       local_time.tm_sec;
+    return local_seconds - seconds;
+}
+
+} // namespace
+
+timestamp_t getMonotonicMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+timestamp_t getRealtimeMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+timestamp_t getUtcOffset(timestamp_t unix_time)
+{
+    const std::int64_t seconds = detail::floorDivide(unix_time, detail::usecs_per_second);
+    const std::int64_t minute = detail::floorDivide(seconds, 60);
+    if (minute < 0 || minute >= 0xFFFFFFFFLL) {
+        return lookUpUtcOffset(seconds) * detail::usecs_per_second;
+    }
+
+    const std::uint64_t key = static_cast<std::uint64_t>(minute + 1) << 32;
+    const std::uint64_t cached = cached_utc_offset.load(std::memory_order_relaxed);
+    if ((cached & 0xFFFFFFFF00000000ULL) == key) {
+        const auto offset = static_cast<std::int32_t>(static_cast<std::uint32_t>(cached));
+        return offset * detail::usecs_per_second;
+    }
+
+    reloadTimeZone();
+    const std::int64_t offset = lookUpUtcOffset(seconds);
+    cached_utc_offset.store(key | static_cast<std::uint32_t>(static_cast<std::int32_t>(offset)),
+                            std::memory_order_relaxed);
+    return offset * detail::usecs_per_second;
+}
+
+void refreshTimeZone()
+{
+    reloadTimeZone();
+    cached_utc_offset.store(0, std::memory_order_relaxed);
+}
+
+timestamp_t getCurrentLocalTimestamp(TimestampReference timestampReference)
+{
+    const timestamp_t now = getRealtimeMicroseconds();
+    const timestamp_t local_time = now + getUtcOffset(now);
+    return timestampReference == TimestampReference::MicroSecondsSinceJulianDateOrigin ?
+               local_time + detail::timeDifferenceJulian2Unix :
+               local_time;
+}
+
+TimestampFormatter::TimestampFormatter(const std::string& format_str,
+                                       TimestampReference timestampReference)
+    : _format(format_str),
+      _unix_origin(timestampReference == TimestampReference::MicroSecondsSinceJulianDateOrigin ?
+                       detail::timeDifferenceJulian2Unix :
+                       0),
+      _rendered(false),
+      _rendered_second(0)
+{
+    detail::checkFormat(_format);
+}
+
+const std::string& TimestampFormatter::format(timestamp_t timestamp)
+{
+    const std::int64_t second =
+        detail::floorDivide(timestamp - _unix_origin, detail::usecs_per_second);
+    if (!_rendered || second != _rendered_second) {
+        tm time_info;
+        detail::toTimeInfo(second, time_info);
+        _text = _format.empty() ? std::string() : detail::renderTimeInfo(time_info, _format);
+        _rendered_second = second;
+        _rendered = true;
+    }
+    return _text;
+}
+
+} // namespace datetime
+} // namespace a_util
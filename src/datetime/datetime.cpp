@@ -14,9 +14,10 @@
 #include <Windows.h>
 #endif // _WIN32
 
+#include "civil_time.h"
+
 #include <a_util/datetime.h>
 #include <a_util/memory/memory.h>
-#include <a_util/memory/memorybuffer.h>
 #include <a_util/regex.h>
 #include <a_util/strings/strings_convert_decl.h>
 #include <a_util/strings/strings_functions.h>
@@ -24,21 +25,48 @@
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstring>
 #include <ctime>
 #include <map>
 #include <stdexcept>
 
-#ifndef _WIN32
-#include <sys/time.h>
-#endif // !_WIN32
-
 namespace a_util {
 namespace datetime {
 namespace detail {
-namespace {
-/// Number of microseconds that have elapsed between julian day and unix time.
-const timestamp_t timeDifferenceJulian2Unix = 210866803200000000LL;
+void checkFormat(const std::string& format)
+{
+    // Check the format of the string. If any unsupported character preceeded
+    // by % was found throw an error
+#if defined(__STRICT_ANSI__) && defined(__QNX__)
+    static const char supported_codes[] = "aAbBcdHIjmMpSUwWxXyY%";
+#else
+    static const char supported_codes[] = "aAbBcdHIjmMpSUwWxXyY%#";
+#endif
+    for (std::size_t pos = format.find('%'); pos != std::string::npos && pos + 1 < format.size();
+         pos = format.find('%', pos + 1)) {
+        if (format[pos + 1] == '\0' || std::strchr(supported_codes, format[pos + 1]) == nullptr) {
+            throw std::invalid_argument((std::string("Invalid format string: ") + format).c_str());
+        }
+    }
+}
 
+std::string renderTimeInfo(const tm& time_info, const std::string& format)
+{
+    // strftime returns 0 if the buffer is too small, most results fit into the stack buffer
+    char buffer[256];
+    std::size_t char_count = strftime(buffer, sizeof(buffer), format.c_str(), &time_info);
+    if (char_count > 0) {
+        return std::string(buffer, char_count);
+    }
+
+    // no format code expands to more than 128 characters, the result might be empty as well
+    std::string date_time(format.size() * 128 + sizeof(buffer), '\0');
+    char_count = strftime(&date_time[0], date_time.size(), format.c_str(), &time_info);
+    date_time.resize(char_count);
+    return date_time;
+}
+
+namespace {
 static const timestamp_t usecs_per_day = static_cast<timestamp_t>(86400000000LL);
 static const std::string digit_chars = "0123456789";
 
@@ -48,18 +76,7 @@ static std::string FormatTimeInfo(tm time_info, const std::string& format)
         return strings::empty_string;
     }
 
-    // Check the format of the string. If any unsupported character preceeded
-    // by % was found return an error string and assert in debug mode
-#if defined(__STRICT_ANSI__) && defined(__QNX__)
-    regex::RegularExpression regex("\\%[^aAbBcdHIjmMpSUwWxXyY%]");
-#else
-    regex::RegularExpression regex("\\%[^aAbBcdHIjmMpSUwWxXyY%#]");
-#endif
-    int consumed = 0;
-
-    if (regex.match(format, regex::RegularExpression::AT_Unanchored, consumed)) {
-        throw std::invalid_argument((std::string("Invalid format string: ") + format).c_str());
-    }
+    checkFormat(format);
 
     time_info.tm_year -= 1900;
     time_info.tm_mon -= 1;
@@ -71,23 +88,22 @@ static std::string FormatTimeInfo(tm time_info, const std::string& format)
     mktime(&time_info);
 #endif
 
-    std::string date_time;
-    size_t buffer_size = format.size();
-    size_t char_count = 0;
-
-    while (char_count == 0) {
-        buffer_size += 512; // append buffer for date/time macros
+    return renderTimeInfo(time_info, format);
+}
 
-        memory::MemoryBuffer buffer(buffer_size);
-        char_count = strftime((char*)buffer.getPtr(), buffer_size, format.c_str(), &time_info);
-        if (char_count > 0) {
-            date_time = (const char*)buffer.getPtr();
-        }
+#ifndef _WIN32
+/// Break down the current time without taking the lock of the time zone database
+void getCurrentTimeInfo(bool local, tm& time_info, int& microsecond)
+{
+    timestamp_t now = getRealtimeMicroseconds();
+    if (local) {
+        now += getUtcOffset(now);
     }
-
-    date_time.erase(char_count);
-    return date_time;
+    const std::int64_t seconds = floorDivide(now, usecs_per_second);
+    toTimeInfo(seconds, time_info);
+    microsecond = static_cast<int>(now - seconds * usecs_per_second);
 }
+#endif // !_WIN32
 
 int ParseMonth(const char*& it, const char* end)
 {
@@ -397,10 +413,9 @@ Date getCurrentLocalDate()
     date.setMonth(system_time.wMonth);
     date.setDay(system_time.wDay);
 #else
-    struct timeval current_time;
-    ::gettimeofday(&current_time, nullptr);
     struct tm system_time;
-    ::localtime_r(&current_time.tv_sec, &system_time);
+    int microsecond = 0;
+    detail::getCurrentTimeInfo(true, system_time, microsecond);
 
     date.setYear(system_time.tm_year + 1900);
     date.setMonth(system_time.tm_mon + 1);
@@ -422,10 +437,9 @@ Date getCurrentSystemDate()
     date.setMonth(system_time.wMonth);
     date.setDay(system_time.wDay);
 #else
-    struct timeval currrent_time;
-    ::gettimeofday(&currrent_time, nullptr);
     struct tm system_time;
-    ::gmtime_r(&currrent_time.tv_sec, &system_time);
+    int microsecond = 0;
+    detail::getCurrentTimeInfo(false, system_time, microsecond);
 
     date.setYear(system_time.tm_year + 1900);
     date.setMonth(system_time.tm_mon + 1);
@@ -586,15 +600,14 @@ Time getCurrentLocalTime()
     time.setSecond(system_time.wSecond);
     time.setMicrosecond(system_time.wMilliseconds * 1000);
 #else
-    struct timeval current_time;
-    ::gettimeofday(&current_time, nullptr);
     struct tm system_time;
-    ::localtime_r(&current_time.tv_sec, &system_time);
+    int microsecond = 0;
+    detail::getCurrentTimeInfo(true, system_time, microsecond);
 
     time.setHour(system_time.tm_hour);
     time.setMinute(system_time.tm_min);
     time.setSecond(system_time.tm_sec);
-    time.setMicrosecond(current_time.tv_usec);
+    time.setMicrosecond(microsecond);
 #endif // _WIN32
 
     return time;
@@ -613,15 +626,14 @@ Time getCurrentSystemTime()
     time.setSecond(system_time.wSecond);
     time.setMicrosecond(system_time.wMilliseconds * 1000);
 #else
-    struct timeval current_time;
-    ::gettimeofday(&current_time, nullptr);
     struct tm system_time;
-    ::gmtime_r(&current_time.tv_sec, &system_time);
+    int microsecond = 0;
+    detail::getCurrentTimeInfo(false, system_time, microsecond);
 
     time.setHour(system_time.tm_hour);
     time.setMinute(system_time.tm_min);
     time.setSecond(system_time.tm_sec);
-    time.setMicrosecond(current_time.tv_usec);
+    time.setMicrosecond(microsecond);
 #endif // _WIN32
 
     return time;
@@ -774,15 +786,14 @@ DateTime getCurrentLocalDateTime()
     date_time.setMonth(system_time.wMonth);
     date_time.setDay(system_time.wDay);
 #else
-    struct timeval current_time;
-    ::gettimeofday(&current_time, nullptr);
     struct tm system_time;
-    ::localtime_r(&current_time.tv_sec, &system_time);
+    int microsecond = 0;
+    detail::getCurrentTimeInfo(true, system_time, microsecond);
 
     date_time.setHour(system_time.tm_hour);
     date_time.setMinute(system_time.tm_min);
     date_time.setSecond(system_time.tm_sec);
-    date_time.setMicrosecond(current_time.tv_usec);
+    date_time.setMicrosecond(microsecond);
     date_time.setYear(system_time.tm_year + 1900);
     date_time.setMonth(system_time.tm_mon + 1);
     date_time.setDay(system_time.tm_mday);
@@ -807,15 +818,14 @@ DateTime getCurrentSystemDateTime()
     date_time.setMonth(system_time.wMonth);
     date_time.setDay(system_time.wDay);
 #else
-    struct timeval current_time;
-    ::gettimeofday(&current_time, nullptr);
     struct tm system_time;
-    ::gmtime_r(&current_time.tv_sec, &system_time);
+    int microsecond = 0;
+    detail::getCurrentTimeInfo(false, system_time, microsecond);
 
     date_time.setHour(system_time.tm_hour);
     date_time.setMinute(system_time.tm_min);
     date_time.setSecond(system_time.tm_sec);
-    date_time.setMicrosecond(current_time.tv_usec);
+    date_time.setMicrosecond(microsecond);
     date_time.setYear(system_time.tm_year + 1900);
     date_time.setMonth(system_time.tm_mon + 1);
     date_time.setDay(system_time.tm_mday);
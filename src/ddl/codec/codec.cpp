@@ -120,6 +120,11 @@ const Decoder::Elements& Decoder::getElements() const
     return _first_element.getChildElements();
 }
 
+const std::vector<CodecIndex>& Decoder::getLeafIndices() const
+{
+    return getOrCreateLeafIndices(*_codec_access, getElements());
+}
+
 size_t Decoder::getBufferSize() const
 {
     return _codec_access->getBufferSize(getRepresentation());
@@ -268,6 +273,11 @@ void* Codec::getElementAddress(const CodecIndex& index)
 
 void Codec::resetValues(bool zero_values)
 {
+    // dynamic structs have no default value image
+    if (resetWithDefaultValueImage(
+            _codec_access, getData(), getDataSize(), getRepresentation(), zero_values)) {
+        return;
+    }
     forEachLeafElement(getElements(),
                        [&zero_values](Codec::Element& element) { element.reset(zero_values); });
 }
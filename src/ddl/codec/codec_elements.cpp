@@ -16,6 +16,9 @@
 #include <ddl/legacy_error_macros.h>
 #include <ddl/utilities/std_to_string.h>
 
+#include <atomic>
+#include <cstring>
+
 namespace ddl {
 namespace codec {
 
@@ -1293,6 +1296,10 @@ CodecIndex StructAccess::resolve(const NamedCodecIndex& named_index) const
 void StructAccess::resolveDynamic(ArraySizeResolverFunction array_resolver)
 {
     _resolved_dynamics = true;
+    if (_is_dynamic) {
+        // the leaf elements depend on the array sizes, the copied cache is not valid anymore
+        _leaf_indices = std::make_shared<LeafIndices>();
+    }
     try {
         if (_init_result) {
             _single_codec_access_element.resolveDynamics(
@@ -1527,5 +1534,112 @@ a_util::result::Result StructAccess::isBinarySubset(const StructAccess& other) c
     return _single_codec_access_element.isBinarySubset(other._single_codec_access_element, false);
 }
 
+namespace {
+// FNV-1a
+constexpr uint64_t fingerprint_offset_basis = 14695981039346656037ULL;
+constexpr uint64_t fingerprint_prime = 1099511628211ULL;
+
+void addToFingerprint(uint64_t& fingerprint, uint64_t value)
+{
+    for (size_t byte_index = 0; byte_index < sizeof(value); ++byte_index) {
+        fingerprint ^= (value >> (byte_index * 8)) & 0xFF;
+        fingerprint *= fingerprint_prime;
+    }
+}
+} // namespace
+
+dd::BinaryLayout StructAccess::calculateBinaryLayout() const
+{
+    const auto layouts = getAllStaticLayouts(_single_codec_access_element, false);
+    dd::BinaryLayout binary_layout;
+    binary_layout.leaves.reserve(layouts.size() * 4);
+    for (const auto& current_layout: layouts) {
+        const auto& layout = current_layout.first;
+        binary_layout.leaves.push_back(static_cast<uint64_t>(layout.type_info->getType()));
+        binary_layout.leaves.push_back(layout.deserialized.bit_offset);
+        binary_layout.leaves.push_back(layout.deserialized.type_bit_size_aligned);
+        binary_layout.leaves.push_back(layout.deserialized.type_bit_size);
+    }
+    binary_layout.fingerprint = fingerprint_offset_basis;
+    addToFingerprint(binary_layout.fingerprint, binary_layout.leaves.size());
+    for (const auto value: binary_layout.leaves) {
+        addToFingerprint(binary_layout.fingerprint, value);
+    }
+    return binary_layout;
+}
+
+DefaultValueImage::DefaultValueImage(std::vector<uint8_t> image_on_zeros,
+                                     const std::vector<uint8_t>& image_on_ones)
+    : _image(std::move(image_on_zeros)), _min_data_size(0)
+{
+    for (size_t offset = 0; offset < _image.size() && offset < image_on_ones.size(); ++offset) {
+        const auto mask = static_cast<uint8_t>(~(_image[offset] ^ image_on_ones[offset]));
+        if (mask == 0x00) {
+            continue;
+        }
+        _min_data_size = offset + 1;
+        if (mask != 0xFF) {
+            _masked_bytes.push_back({offset, mask});
+        }
+        else if (!_byte_ranges.empty() &&
+                 _byte_ranges.back().offset + _byte_ranges.back().size == offset) {
+            ++_byte_ranges.back().size;
+        }
+        else {
+            _byte_ranges.push_back({offset, 1});
+        }
+    }
+}
+
+bool DefaultValueImage::apply(void* data, size_t data_size) const
+{
+    if (data_size < _min_data_size) {
+        return false;
+    }
+    auto bytes = static_cast<uint8_t*>(data);
+    for (const auto& byte_range: _byte_ranges) {
+        std::memcpy(bytes + byte_range.offset, _image.data() + byte_range.offset, byte_range.size);
+    }
+    for (const auto& masked_byte: _masked_bytes) {
+        bytes[masked_byte.offset] =
+            static_cast<uint8_t>((bytes[masked_byte.offset] & ~masked_byte.mask) |
+                                 (_image[masked_byte.offset] & masked_byte.mask));
+    }
+    return true;
+}
+
+std::shared_ptr<const DefaultValueImage> StructAccess::getDefaultValueImage(
+    DataRepresentation representation, bool zero_values) const
+{
+    return std::atomic_load(&_default_value_images->images[representation == deserialized ? 1 : 0]
+                                                          [zero_values ? 1 : 0]);
+}
+
+void StructAccess::setDefaultValueImage(DataRepresentation representation,
+                                        bool zero_values,
+                                        std::shared_ptr<const DefaultValueImage> image) const
+{
+    std::atomic_store(&_default_value_images->images[representation == deserialized ? 1 : 0]
+                                                    [zero_values ? 1 : 0],
+                      std::move(image));
+}
+
+std::shared_ptr<const std::vector<CodecIndex>> StructAccess::getLeafIndices() const
+{
+    return std::atomic_load(&_leaf_indices->indices);
+}
+
+std::shared_ptr<const std::vector<CodecIndex>> StructAccess::setLeafIndices(
+    std::shared_ptr<const std::vector<CodecIndex>> leaf_indices) const
+{
+    // references to the cached codec indices are handed out, so they are never replaced
+    std::shared_ptr<const std::vector<CodecIndex>> cached_leaf_indices;
+    if (std::atomic_compare_exchange_strong(
+            &_leaf_indices->indices, &cached_leaf_indices, leaf_indices)) {
+        return leaf_indices;
+    }
+    return cached_leaf_indices;
+}
+
 } // namespace codec
 } // namespace ddl
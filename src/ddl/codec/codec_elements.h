@@ -15,13 +15,17 @@
 #include "named_codec_index.h"
 
 #include <a_util/result/result_type_decl.h>
+#include <ddl/codec/codec_iterator.h>
 #include <ddl/codec/data_representation.h>
 #include <ddl/dd/dd.h>
 #include <ddl/dd/dd_common_types.h>
 #include <ddl/dd/dd_struct_access.h>
+#include <ddl/dd/dd_typeinfomodel.h>
 
 #include <functional>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace ddl {
 namespace codec {
@@ -212,6 +216,54 @@ private:
     bool _is_dynamic = false;
 };
 
+/**
+ * @internal
+ * This class is for internal use only.
+ * Precalculated image of the values written by StaticCodec::resetValues for a static struct in one
+ * data representation. Only the bytes (and bits) of elements which are reset are written: complete
+ * bytes are copied range by range, bytes shared with other elements (i.e. serialized bit fields)
+ * are copied with a mask.
+ */
+class DefaultValueImage {
+public:
+    /**
+     * CTOR, creates an image which is never applied (i.e. if the image can not be created).
+     */
+    DefaultValueImage() = default;
+
+    /**
+     * CTOR
+     * The written bits have the same value in both buffers, all other bits differ.
+     * @param[in] image_on_zeros The buffer initialized with 0x00 and reset afterwards
+     * @param[in] image_on_ones The buffer initialized with 0xFF and reset afterwards
+     */
+    DefaultValueImage(std::vector<uint8_t> image_on_zeros,
+                      const std::vector<uint8_t>& image_on_ones);
+
+    /**
+     * Writes the image into the data.
+     * @param[in] data The data to reset
+     * @param[in] data_size The size of the data
+     * @retval true the data was reset
+     * @retval false the data is too small for the image or the image is empty, nothing was written
+     */
+    bool apply(void* data, size_t data_size) const;
+
+private:
+    struct ByteRange {
+        size_t offset;
+        size_t size;
+    };
+    struct MaskedByte {
+        size_t offset;
+        uint8_t mask;
+    };
+    std::vector<uint8_t> _image;
+    std::vector<ByteRange> _byte_ranges;
+    std::vector<MaskedByte> _masked_bytes;
+    size_t _min_data_size = static_cast<size_t>(-1);
+};
+
 /**
  * @internal
  * This class is for internal use only.
@@ -259,6 +311,43 @@ public:
 
     a_util::result::Result isBinaryEqual(const StructAccess& other) const;
     a_util::result::Result isBinarySubset(const StructAccess& other) const;
+    /**
+     * Collects the static leaf layouts, exactly the values that isBinaryEqual compares, and
+     * hashes them. Equal layouts of static structs mean binary equality.
+     */
+    dd::BinaryLayout calculateBinaryLayout() const;
+    /**
+     * Gets the cached default value image for resetting the static struct. The cache is shared by
+     * all copies of this StructAccess (the codecs of one CodecFactory).
+     * @param[in] representation The data representation
+     * @param[in] zero_values Whether elements without constant or default value are reset to 0
+     * @return The image, or nullptr if it is not created yet
+     */
+    std::shared_ptr<const DefaultValueImage> getDefaultValueImage(
+        DataRepresentation representation, bool zero_values) const;
+    /**
+     * Sets the cached default value image for resetting the static struct.
+     * @param[in] representation The data representation
+     * @param[in] zero_values Whether elements without constant or default value are reset to 0
+     * @param[in] image The image to cache
+     */
+    void setDefaultValueImage(DataRepresentation representation,
+                              bool zero_values,
+                              std::shared_ptr<const DefaultValueImage> image) const;
+    /**
+     * Gets the cached codec indices of all leaf elements in the order of forEachLeafElement.
+     * The cache is shared by all copies of this StructAccess until the dynamic elements are
+     * resolved.
+     * @return The codec indices, or nullptr if they are not created yet
+     */
+    std::shared_ptr<const std::vector<CodecIndex>> getLeafIndices() const;
+    /**
+     * Sets the cached codec indices of all leaf elements if they are not set yet.
+     * @param[in] leaf_indices The codec indices to cache
+     * @return The cached codec indices, these are not changed anymore
+     */
+    std::shared_ptr<const std::vector<CodecIndex>> setLeafIndices(
+        std::shared_ptr<const std::vector<CodecIndex>> leaf_indices) const;
 
 private:
     void resolveDynamicStructSize();
@@ -279,8 +368,42 @@ private:
     TypeSize _static_struct_size;
     TypeSize _dynamic_struct_size;
     bool _resolved_dynamics = false;
+
+    struct DefaultValueImages {
+        // [representation][zero_values]
+        std::shared_ptr<const DefaultValueImage> images[2][2];
+    };
+    std::shared_ptr<DefaultValueImages> _default_value_images =
+        std::make_shared<DefaultValueImages>();
+    struct LeafIndices {
+        std::shared_ptr<const std::vector<CodecIndex>> indices;
+    };
+    std::shared_ptr<LeafIndices> _leaf_indices = std::make_shared<LeafIndices>();
 };
 
+/**
+ * Gets the cached codec indices of all leaf elements or creates them by iterating the elements.
+ * @param[in] codec_access The struct access which holds the cache.
+ * @param[in] elements The elements of the codec, decoder or factory using \p codec_access.
+ * @return The codec indices, valid as long as \p codec_access exists.
+ */
+template <typename ElementsType>
+const std::vector<CodecIndex>& getOrCreateLeafIndices(const StructAccess& codec_access,
+                                                      const ElementsType& elements)
+{
+    auto leaf_indices = codec_access.getLeafIndices();
+    if (!leaf_indices) {
+        std::vector<CodecIndex> indices;
+        indices.reserve(codec_access.getLeafIndexCount());
+        forEachLeafElement(elements, [&indices](const auto& element) {
+            indices.push_back(element.getIndex());
+        });
+        leaf_indices = codec_access.setLeafIndices(
+            std::make_shared<const std::vector<CodecIndex>>(std::move(indices)));
+    }
+    return *leaf_indices;
+}
+
 } // namespace codec
 } // namespace ddl
 
@@ -132,6 +132,18 @@ Codec CodecFactory::makeCodecFor(void* data, size_t data_size, DataRepresentatio
     return Codec(_codec_access, data, data_size, rep);
 }
 
+CodecProjection CodecFactory::makeProjection(const std::vector<std::string>& element_names,
+                                             DataRepresentation rep) const
+{
+    return CodecProjection(_codec_access, element_names, {}, rep);
+}
+
+CodecProjection CodecFactory::makeProjection(const std::vector<CodecIndex>& codec_indices,
+                                             DataRepresentation rep) const
+{
+    return CodecProjection(_codec_access, {}, codec_indices, rep);
+}
+
 CodecFactory::Element CodecFactory::getElement(const std::string& full_name) const
 {
     auto index = _codec_access->resolve(full_name);
@@ -150,6 +162,11 @@ const CodecFactory::Elements& CodecFactory::getElements() const
     return _first_element.getChildElements();
 }
 
+const std::vector<CodecIndex>& CodecFactory::getLeafIndices() const
+{
+    return getOrCreateLeafIndices(*_codec_access, getElements());
+}
+
 size_t CodecFactory::getElementChildCount(const CodecIndex& codec_index) const
 {
     return _codec_access->getElementChildCount(codec_index, true);
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * Implementation of the CodecFactoryCache.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <ddl/codec/codec_factory_cache.h>
+
+#include <functional>
+
+namespace ddl {
+namespace codec {
+
+constexpr size_t CodecFactoryCache::default_max_size;
+
+bool CodecFactoryCache::Key::operator==(const Key& other) const
+{
+    return dd_string_hash == other.dd_string_hash && struct_name == other.struct_name;
+}
+
+size_t CodecFactoryCache::KeyHash::operator()(const Key& key) const
+{
+    return std::hash<std::string>()(key.struct_name) ^ (key.dd_string_hash << 1);
+}
+
+CodecFactoryCache::CodecFactoryCache(size_t max_size) : _max_size(max_size)
+{
+}
+
+CodecFactoryCache& CodecFactoryCache::getGlobalCache()
+{
+    static CodecFactoryCache global_cache;
+    return global_cache;
+}
+
+CodecFactory CodecFactoryCache::getFactory(const std::string& struct_name,
+                                           const std::string& dd_string)
+{
+    Key key{struct_name, std::hash<std::string>()(dd_string)};
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto found = _index.find(key);
+        if (found != _index.end() && found->second->dd_string == dd_string) {
+            _entries.splice(_entries.begin(), _entries, found->second);
+            return found->second->factory;
+        }
+    }
+
+    // parse outside of the lock, other threads may use the cache meanwhile
+    CodecFactory factory(struct_name, dd_string);
+    if (!factory.isValid()) {
+        return factory;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_max_size == 0) {
+        return factory;
+    }
+    const auto found = _index.find(key);
+    if (found != _index.end()) {
+        // created by another thread meanwhile or a hash collision, the last one wins
+        _entries.erase(found->second);
+        _index.erase(found);
+    }
+    shrinkTo(_max_size - 1);
+    _entries.push_front({key, dd_string, factory});
+    _index.emplace(std::move(key), _entries.begin());
+    return factory;
+}
+
+size_t CodecFactoryCache::getSize() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+size_t CodecFactoryCache::getMaxSize() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _max_size;
+}
+
+void CodecFactoryCache::setMaxSize(size_t max_size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_size = max_size;
+    shrinkTo(_max_size);
+}
+
+void CodecFactoryCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _index.clear();
+    _entries.clear();
+}
+
+void CodecFactoryCache::shrinkTo(size_t size)
+{
+    while (_entries.size() > size) {
+        _index.erase(_entries.back().key);
+        _entries.pop_back();
+    }
+}
+
+} // namespace codec
+} // namespace ddl
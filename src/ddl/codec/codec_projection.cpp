@@ -0,0 +1,284 @@
+/**
+ * @file
+ * Implementation of the CodecProjection.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "codec_elements.h"
+#include "leaf_gather.h"
+
+#include <ddl/codec/codec_projection.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace ddl {
+namespace codec {
+
+namespace {
+
+template <typename T>
+size_t toArraySize(const uint64_t& value)
+{
+    T typed_value;
+    std::memcpy(&typed_value, &value, sizeof(T));
+    return static_cast<size_t>(typed_value);
+}
+
+bool isWithinData(const LeafLayout& leaf_layout, size_t data_size)
+{
+    return leaf_layout.byte_pos * size_t(8) + leaf_layout.bit_pos + leaf_layout.bit_size <=
+           data_size * 8;
+}
+
+/**
+ * Reads the value of an array size element.
+ * @throw std::runtime_error if the element is not within the data.
+ */
+size_t readArraySize(const LeafLayout& leaf_layout, const void* data, size_t data_size)
+{
+    if (!isWithinData(leaf_layout, data_size)) {
+        throw std::runtime_error("the array size element is behind the data size");
+    }
+    uint64_t value = 0;
+    gatherLeafValues(leaf_layout, data, data_size, 1, 0, &value);
+    switch (leaf_layout.element_type) {
+    case LeafElementType::let_bool:
+        return toArraySize<bool>(value);
+    case LeafElementType::let_int8:
+        return toArraySize<int8_t>(value);
+    case LeafElementType::let_uint8:
+        return toArraySize<uint8_t>(value);
+    case LeafElementType::let_int16:
+        return toArraySize<int16_t>(value);
+    case LeafElementType::let_uint16:
+        return toArraySize<uint16_t>(value);
+    case LeafElementType::let_int32:
+        return toArraySize<int32_t>(value);
+    case LeafElementType::let_uint32:
+        return toArraySize<uint32_t>(value);
+    case LeafElementType::let_int64:
+        return toArraySize<int64_t>(value);
+    case LeafElementType::let_uint64:
+        return toArraySize<uint64_t>(value);
+    case LeafElementType::let_float:
+        return toArraySize<float>(value);
+    case LeafElementType::let_double:
+        return toArraySize<double>(value);
+    default:
+        break;
+    }
+    throw std::runtime_error("invalid type");
+}
+
+/**
+ * Replaces all array positions within the element name with 0.
+ * The array sizes of dynamic arrays are unknown without data, only the first array element is
+ * resolvable to retrieve the type of the element.
+ */
+std::string toFirstArrayElementName(const std::string& element_name)
+{
+    std::string first_element_name;
+    first_element_name.reserve(element_name.size());
+    bool within_array_pos = false;
+    for (const auto character: element_name) {
+        if (within_array_pos) {
+            if (character != ']') {
+                continue;
+            }
+            first_element_name += '0';
+            within_array_pos = false;
+        }
+        else if (character == '[') {
+            within_array_pos = true;
+        }
+        first_element_name += character;
+    }
+    return first_element_name;
+}
+
+} // namespace
+
+/**
+ * The positions of the selected elements for one combination of array sizes.
+ */
+struct CodecProjection::DynamicLayout {
+    /// the array size elements in the order of resolving
+    std::vector<LeafLayout> array_size_layouts;
+    /// the array sizes the positions are resolved for
+    std::vector<size_t> array_sizes;
+    /// the positions of the selected elements
+    std::vector<LeafLayout> leaf_layouts;
+    /// the size of the data with these array sizes
+    size_t data_size = {};
+
+    bool hasSameArraySizes(const void* data, size_t data_size) const
+    {
+        // the position of an array size element only depends on the array sizes before, so they
+        // are valid as long as the values before are equal
+        for (size_t array_size_pos = 0; array_size_pos < array_sizes.size(); ++array_size_pos) {
+            if (readArraySize(array_size_layouts[array_size_pos], data, data_size) !=
+                array_sizes[array_size_pos]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+CodecProjection::CodecProjection(std::shared_ptr<const StructAccess> codec_access,
+                                 const std::vector<std::string>& element_names,
+                                 const std::vector<CodecIndex>& codec_indices,
+                                 DataRepresentation representation)
+    : _codec_access(std::move(codec_access)), _representation(representation)
+{
+    const auto result = _codec_access->getInitResult();
+    if (!result) {
+        throw std::runtime_error(result.getDescription());
+    }
+    _elements.reserve(element_names.size() + codec_indices.size());
+    for (const auto& element_name: element_names) {
+        _elements.push_back({element_name,
+                             _codec_access->resolve(_codec_access->isDynamic() ?
+                                                        toFirstArrayElementName(element_name) :
+                                                        element_name),
+                             {},
+                             {}});
+    }
+    for (const auto& codec_index: codec_indices) {
+        _elements.push_back({{}, codec_index, {}, {}});
+        _codec_access->resolve(_elements.back().codec_index, false);
+    }
+
+    size_t output_alignment = 1;
+    for (auto& element: _elements) {
+        // this checks the type and the size of the element, the positions of dynamic structs are
+        // resolved with the data
+        LeafCodecIndex::convertToLeafLayout</*throw_error=*/true>(
+            element.codec_index, element.leaf_layout, _representation);
+        const auto value_size = getLeafValueSize(element.leaf_layout);
+        element.output_offset = (_output_size + value_size - 1) / value_size * value_size;
+        _output_size = element.output_offset + value_size;
+        output_alignment = (std::max)(output_alignment, value_size);
+    }
+    _output_size = (_output_size + output_alignment - 1) / output_alignment * output_alignment;
+    _data_size = _codec_access->getStaticBufferSize(_representation);
+}
+
+DataRepresentation CodecProjection::getRepresentation() const noexcept
+{
+    return _representation;
+}
+
+size_t CodecProjection::getElementCount() const noexcept
+{
+    return _elements.size();
+}
+
+ElementType CodecProjection::getElementType(size_t element) const
+{
+    if (element >= _elements.size()) {
+        throw std::runtime_error("element " + std::to_string(element) + " does not exist");
+    }
+    return _elements[element].codec_index.getType();
+}
+
+size_t CodecProjection::getElementOffset(size_t element) const
+{
+    if (element >= _elements.size()) {
+        throw std::runtime_error("element " + std::to_string(element) + " does not exist");
+    }
+    return _elements[element].output_offset;
+}
+
+size_t CodecProjection::getOutputSize() const noexcept
+{
+    return _output_size;
+}
+
+void CodecProjection::extract(const void* data,
+                              size_t data_size,
+                              void* output,
+                              size_t output_size) const
+{
+    if (output_size < _output_size) {
+        throw std::runtime_error("the output size " + std::to_string(output_size) +
+                                 " is smaller than " + std::to_string(_output_size));
+    }
+    const auto output_bytes = static_cast<uint8_t*>(output);
+    if (!_codec_access->isDynamic()) {
+        if (data_size < _data_size) {
+            throw std::runtime_error("the data size " + std::to_string(data_size) +
+                                     " is smaller than " + std::to_string(_data_size));
+        }
+        for (const auto& element: _elements) {
+            gatherLeafValues(
+                element.leaf_layout, data, data_size, 1, 0, output_bytes + element.output_offset);
+        }
+        return;
+    }
+
+    auto dynamic_layout = std::atomic_load(&_dynamic_layout);
+    if (!dynamic_layout || !dynamic_layout->hasSameArraySizes(data, data_size)) {
+        dynamic_layout = resolveDynamicLayout(data, data_size);
+        std::atomic_store(&_dynamic_layout, dynamic_layout);
+    }
+    if (data_size < dynamic_layout->data_size) {
+        throw std::runtime_error("the data size " + std::to_string(data_size) +
+                                 " is smaller than " + std::to_string(dynamic_layout->data_size));
+    }
+    for (size_t element = 0; element < _elements.size(); ++element) {
+        gatherLeafValues(dynamic_layout->leaf_layouts[element],
+                         data,
+                         data_size,
+                         1,
+                         0,
+                         output_bytes + _elements[element].output_offset);
+    }
+}
+
+std::shared_ptr<const CodecProjection::DynamicLayout> CodecProjection::resolveDynamicLayout(
+    const void* data, size_t data_size) const
+{
+    // this is the same as creating a Decoder, but the array sizes are recorded
+    auto dynamic_layout = std::make_shared<DynamicLayout>();
+    auto resolved_codec_access = _codec_access->makeResolvedCodecAccess();
+    resolved_codec_access->resolveDynamic([&](const NamedCodecIndex& index) -> size_t {
+        LeafLayout array_size_layout;
+        LeafCodecIndex::convertToLeafLayout</*throw_error=*/true>(
+            resolved_codec_access->resolve(index), array_size_layout, _representation);
+        const auto array_size = readArraySize(array_size_layout, data, data_size);
+        dynamic_layout->array_size_layouts.push_back(array_size_layout);
+        dynamic_layout->array_sizes.push_back(array_size);
+        return array_size;
+    });
+
+    dynamic_layout->data_size = resolved_codec_access->getBufferSize(_representation);
+    dynamic_layout->leaf_layouts.resize(_elements.size());
+    for (size_t element = 0; element < _elements.size(); ++element) {
+        auto codec_index = _elements[element].codec_index;
+        if (_elements[element].name.empty()) {
+            resolved_codec_access->resolve(codec_index, true);
+        }
+        else {
+            codec_index = resolved_codec_access->resolve(_elements[element].name);
+        }
+        LeafCodecIndex::convertToLeafLayout</*throw_error=*/true>(
+            codec_index, dynamic_layout->leaf_layouts[element], _representation);
+        // the codec resolves array positions behind the array sizes of the data as well
+        if (!isWithinData(dynamic_layout->leaf_layouts[element], dynamic_layout->data_size)) {
+            throw std::runtime_error("the element " + std::to_string(element) +
+                                     " does not exist with the array sizes of the data");
+        }
+    }
+    return dynamic_layout;
+}
+
+} // namespace codec
+} // namespace ddl
@@ -0,0 +1,166 @@
+/**
+ * @file
+ * Implementation of the ColumnarDecoder.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "codec_elements.h"
+#include "leaf_gather.h"
+
+#include <ddl/codec/columnar_decoder.h>
+
+namespace ddl {
+namespace codec {
+
+namespace {
+
+std::vector<CodecIndex> getCodecIndices(const CodecFactory& factory,
+                                        const std::vector<std::string>& leaf_names)
+{
+    std::vector<CodecIndex> leaf_indices;
+    leaf_indices.reserve(leaf_names.size());
+    for (const auto& leaf_name: leaf_names) {
+        leaf_indices.push_back(factory.getElement(leaf_name).getIndex());
+    }
+    return leaf_indices;
+}
+
+#define MAKE_COLUMN_VALUES_CASE_TYPE(__leaf_element_type, __data_type)                             \
+    case LeafElementType::__leaf_element_type:                                                     \
+        return std::make_unique<detail::ColumnValues<__data_type>>();
+
+/// the values are kept in their own type, so the columns are properly aligned
+std::unique_ptr<detail::ColumnValuesBase> makeColumnValues(const LeafLayout& leaf_layout)
+{
+    switch (leaf_layout.element_type) {
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_bool, bool)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_int8, int8_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_uint8, uint8_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_int16, int16_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_uint16, uint16_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_int32, int32_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_uint32, uint32_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_int64, int64_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_uint64, uint64_t)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_float, float)
+        MAKE_COLUMN_VALUES_CASE_TYPE(let_double, double)
+    default:
+        break;
+    }
+    throw std::runtime_error("invalid type");
+}
+
+#undef MAKE_COLUMN_VALUES_CASE_TYPE
+
+} // namespace
+
+ColumnarDecoder::ColumnarDecoder(const CodecFactory& factory, DataRepresentation rep)
+    : ColumnarDecoder(factory, getCodecIndices(factory), rep)
+{
+}
+
+ColumnarDecoder::ColumnarDecoder(const CodecFactory& factory,
+                                 const std::vector<std::string>& leaf_names,
+                                 DataRepresentation rep)
+    : ColumnarDecoder(factory, getCodecIndices(factory, leaf_names), rep)
+{
+}
+
+ColumnarDecoder::ColumnarDecoder(const CodecFactory& factory,
+                                 const std::vector<CodecIndex>& leaf_indices,
+                                 DataRepresentation rep)
+    : _representation(rep)
+{
+    const auto result = factory.isValid();
+    if (!result) {
+        throw std::runtime_error(result.getDescription());
+    }
+    if (factory._codec_access->isDynamic()) {
+        throw std::runtime_error("samples of dynamic structs can not be decoded into columns");
+    }
+    _sample_size = factory.getStaticBufferSize(rep);
+    _columns.reserve(leaf_indices.size());
+    for (const auto& leaf_index: leaf_indices) {
+        addColumn(factory, leaf_index);
+    }
+}
+
+void ColumnarDecoder::addColumn(const CodecFactory& factory, const CodecIndex& leaf_index)
+{
+    const auto element = factory.getElement(leaf_index);
+    Column column;
+    column.name = element.getFullName();
+    LeafCodecIndex::convertToLeafLayout</*throw_error=*/true>(
+        element.getIndex(), column.leaf_layout, _representation);
+    column.values = makeColumnValues(column.leaf_layout);
+    _columns.push_back(std::move(column));
+}
+
+DataRepresentation ColumnarDecoder::getRepresentation() const noexcept
+{
+    return _representation;
+}
+
+size_t ColumnarDecoder::getSampleSize() const noexcept
+{
+    return _sample_size;
+}
+
+size_t ColumnarDecoder::getColumnCount() const noexcept
+{
+    return _columns.size();
+}
+
+const std::string& ColumnarDecoder::getColumnName(size_t column) const
+{
+    if (column >= _columns.size()) {
+        throw std::runtime_error("column " + std::to_string(column) + " does not exist");
+    }
+    return _columns[column].name;
+}
+
+ElementType ColumnarDecoder::getColumnType(size_t column) const
+{
+    if (column >= _columns.size()) {
+        throw std::runtime_error("column " + std::to_string(column) + " does not exist");
+    }
+    return static_cast<ElementType>(_columns[column].leaf_layout.element_type);
+}
+
+size_t ColumnarDecoder::decode(const void* samples, size_t samples_size, size_t stride)
+{
+    if (stride == 0) {
+        stride = _sample_size;
+    }
+    if (stride < _sample_size) {
+        throw std::runtime_error("the stride " + std::to_string(stride) +
+                                 " is smaller than the sample size " +
+                                 std::to_string(_sample_size));
+    }
+    // the last sample does not need the whole stride
+    _sample_count = (samples_size >= _sample_size && stride != 0) ?
+                        (samples_size - _sample_size) / stride + 1 :
+                        0;
+    for (auto& column: _columns) {
+        gatherLeafValues(column.leaf_layout,
+                         samples,
+                         samples_size,
+                         _sample_count,
+                         stride,
+                         column.values->reserve(_sample_count));
+    }
+    return _sample_count;
+}
+
+size_t ColumnarDecoder::getSampleCount() const noexcept
+{
+    return _sample_count;
+}
+
+} // namespace codec
+} // namespace ddl
@@ -13,9 +13,13 @@
 #define DDL_PREVIEW_ELEMENT_SETTER_PRIVATE_CLASS_HEADER
 
 #include <ddl/codec/codec_index.h>
+#include <ddl/codec/data_representation.h>
+
+#include <memory>
 
 namespace ddl {
 namespace codec {
+class StructAccess;
 
 template <typename T, bool no_throw = true>
 bool setEnumValue(T& codec, const CodecIndex& codec_index, const std::string& enum_value_name)
@@ -32,6 +36,23 @@ bool setEnumValue(T& codec, const CodecIndex& codec_index, const std::string& en
     return true;
 }
 
+/**
+ * Resets the data with the default value image of a static struct. The image is created with the
+ * first reset of a codec of the same CodecFactory.
+ * @param[in] codec_access The struct access of the codec
+ * @param[in] data The data to reset
+ * @param[in] data_size The size of the data
+ * @param[in] representation The data representation
+ * @param[in] zero_values set the value to 0 if no constant or default value set in data definition
+ * @retval true the data was reset
+ * @retval false the struct is dynamic or the data is too small, reset element by element
+ */
+bool resetWithDefaultValueImage(const std::shared_ptr<const StructAccess>& codec_access,
+                                void* data,
+                                size_t data_size,
+                                DataRepresentation representation,
+                                bool zero_values);
+
 } // namespace codec
 } // namespace ddl
 
@@ -0,0 +1,243 @@
+/**
+ * @file
+ * Implementation of the private leaf value gather functions.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "leaf_gather.h"
+
+#include <ddl/codec/bitserializer.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace ddl {
+namespace codec {
+
+namespace {
+
+/**
+ * Copies the value at \p byte_pos of each sample into the column.
+ * The size of the copy is known at compile time, so the loop is a simple (vectorizable) gather.
+ */
+template <typename T>
+void gatherBytes(
+    const uint8_t* samples, size_t sample_count, size_t stride, size_t byte_pos, uint8_t* column)
+{
+    const uint8_t* value = samples + byte_pos;
+    for (size_t sample = 0; sample < sample_count; ++sample, value += stride) {
+        std::memcpy(column + sample * sizeof(T), value, sizeof(T));
+    }
+}
+
+template <>
+void gatherBytes<bool>(
+    const uint8_t* samples, size_t sample_count, size_t stride, size_t byte_pos, uint8_t* column)
+{
+    // any other value than 0 is true, this is the only valid representation of a bool value
+    const uint8_t* value = samples + byte_pos;
+    for (size_t sample = 0; sample < sample_count; ++sample, value += stride) {
+        column[sample] = (*value != 0) ? 1 : 0;
+    }
+}
+
+inline uint16_t swapBytes(uint16_t value)
+{
+    return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+inline uint32_t swapBytes(uint32_t value)
+{
+    return ((value & 0xFF000000u) >> 24) | ((value & 0x00FF0000u) >> 8) |
+           ((value & 0x0000FF00u) << 8) | ((value & 0x000000FFu) << 24);
+}
+
+inline uint64_t swapBytes(uint64_t value)
+{
+    return (static_cast<uint64_t>(swapBytes(static_cast<uint32_t>(value))) << 32) |
+           swapBytes(static_cast<uint32_t>(value >> 32));
+}
+
+/**
+ * Swaps the byte order of all values within the column.
+ * The loop is written with shifts only, so the compiler is able to vectorize it.
+ */
+template <typename UnsignedT>
+void swapColumn(uint8_t* column, size_t sample_count)
+{
+    for (size_t sample = 0; sample < sample_count; ++sample) {
+        UnsignedT value;
+        std::memcpy(&value, column + sample * sizeof(UnsignedT), sizeof(UnsignedT));
+        value = swapBytes(value);
+        std::memcpy(column + sample * sizeof(UnsignedT), &value, sizeof(UnsignedT));
+    }
+}
+
+void swapColumn(uint8_t* column, size_t sample_count, size_t value_size)
+{
+    switch (value_size) {
+    case 2:
+        swapColumn<uint16_t>(column, sample_count);
+        break;
+    case 4:
+        swapColumn<uint32_t>(column, sample_count);
+        break;
+    case 8:
+        swapColumn<uint64_t>(column, sample_count);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Reads the bits of the value of each sample into the column.
+ */
+template <typename T>
+void gatherBits(const uint8_t* samples,
+                size_t samples_size,
+                size_t sample_count,
+                size_t stride,
+                size_t bit_offset,
+                size_t bit_size,
+                a_util::memory::Endianess byte_order,
+                uint8_t* column)
+{
+    a_util::memory::BitSerializer bit_reader(const_cast<uint8_t*>(samples), samples_size);
+    for (size_t sample = 0; sample < sample_count; ++sample) {
+        T value{};
+        const auto res =
+            bit_reader.read<T>(sample * stride * 8 + bit_offset, bit_size, &value, byte_order);
+        if (!res) {
+            throw std::runtime_error(res.getDescription());
+        }
+        std::memcpy(column + sample * sizeof(T), &value, sizeof(T));
+    }
+}
+
+template <>
+void gatherBits<bool>(const uint8_t* samples,
+                      size_t samples_size,
+                      size_t sample_count,
+                      size_t stride,
+                      size_t bit_offset,
+                      size_t bit_size,
+                      a_util::memory::Endianess byte_order,
+                      uint8_t* column)
+{
+    gatherBits<uint8_t>(
+        samples, samples_size, sample_count, stride, bit_offset, bit_size, byte_order, column);
+    for (size_t sample = 0; sample < sample_count; ++sample) {
+        column[sample] = (column[sample] != 0) ? 1 : 0;
+    }
+}
+
+template <typename T>
+void gatherValues(const LeafLayout& leaf_layout,
+                  bool bits,
+                  const uint8_t* samples,
+                  size_t samples_size,
+                  size_t sample_count,
+                  size_t stride,
+                  uint8_t* column)
+{
+    if (bits) {
+        const a_util::memory::Endianess byte_order =
+            ((leaf_layout.data_flags &
+              static_cast<uint8_t>(LeafDataRepresentation::serialized_be)) ==
+             static_cast<uint8_t>(LeafDataRepresentation::serialized_be)) ?
+                a_util::memory::bit_big_endian :
+                a_util::memory::bit_little_endian;
+        gatherBits<T>(samples,
+                      samples_size,
+                      sample_count,
+                      stride,
+                      leaf_layout.byte_pos * size_t(8) + leaf_layout.bit_pos,
+                      leaf_layout.bit_size,
+                      byte_order,
+                      column);
+    }
+    else {
+        gatherBytes<T>(samples, sample_count, stride, leaf_layout.byte_pos, column);
+    }
+}
+
+} // namespace
+
+size_t getLeafValueSize(const LeafLayout& leaf_layout)
+{
+    switch (leaf_layout.element_type) {
+    case LeafElementType::let_bool:
+    case LeafElementType::let_int8:
+    case LeafElementType::let_uint8:
+        return 1;
+    case LeafElementType::let_int16:
+    case LeafElementType::let_uint16:
+        return 2;
+    case LeafElementType::let_int32:
+    case LeafElementType::let_uint32:
+    case LeafElementType::let_float:
+        return 4;
+    case LeafElementType::let_int64:
+    case LeafElementType::let_uint64:
+    case LeafElementType::let_double:
+        return 8;
+    default:
+        break;
+    }
+    throw std::runtime_error("invalid type");
+}
+
+#define GATHER_CASE_TYPE(__leaf_element_type, __data_type)                                         \
+    case LeafElementType::__leaf_element_type: {                                                   \
+        gatherValues<__data_type>(                                                                 \
+            leaf_layout, bits, bytes, samples_size, sample_count, stride, column);                 \
+        break;                                                                                     \
+    }
+
+void gatherLeafValues(const LeafLayout& leaf_layout,
+                      const void* samples,
+                      size_t samples_size,
+                      size_t sample_count,
+                      size_t stride,
+                      void* values)
+{
+    const auto value_size = getLeafValueSize(leaf_layout);
+    const bool serialized =
+        (leaf_layout.data_flags & static_cast<uint8_t>(LeafDataRepresentation::serialized)) ==
+        static_cast<uint8_t>(LeafDataRepresentation::serialized);
+    const bool byte_aligned = leaf_layout.bit_pos == 0 && leaf_layout.bit_size == value_size * 8;
+    // the LeafLayout is deserialized also for serialized values in platform byte order at a byte
+    // position, single bytes do not have a byte order
+    const bool bits = serialized && !byte_aligned;
+    const bool swapped = serialized && byte_aligned && value_size > 1;
+
+    const auto bytes = static_cast<const uint8_t*>(samples);
+    const auto column = static_cast<uint8_t*>(values);
+    switch (leaf_layout.element_type) {
+        GATHER_CASE_TYPE(let_bool, bool)
+        GATHER_CASE_TYPE(let_int8, int8_t)
+        GATHER_CASE_TYPE(let_uint8, uint8_t)
+        GATHER_CASE_TYPE(let_int16, int16_t)
+        GATHER_CASE_TYPE(let_uint16, uint16_t)
+        GATHER_CASE_TYPE(let_int32, int32_t)
+        GATHER_CASE_TYPE(let_uint32, uint32_t)
+        GATHER_CASE_TYPE(let_int64, int64_t)
+        GATHER_CASE_TYPE(let_uint64, uint64_t)
+        GATHER_CASE_TYPE(let_float, float)
+        GATHER_CASE_TYPE(let_double, double)
+    default:
+        break;
+    }
+    if (swapped) {
+        swapColumn(column, sample_count, value_size);
+    }
+}
+
+} // namespace codec
+} // namespace ddl
@@ -0,0 +1,56 @@
+/**
+ * @file
+ * Implementation of the private leaf value gather functions.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef DDL_LEAF_GATHER_PRIVATE_HEADER
+#define DDL_LEAF_GATHER_PRIVATE_HEADER
+
+#include <ddl/codec/leaf_value_access.h>
+
+#include <cstddef>
+
+namespace ddl {
+namespace codec {
+
+/**
+ * Gets the size of the value of the leaf in its own type.
+ * @param[in] leaf_layout The leaf layout.
+ * @return The size in bytes (sizeof of the type).
+ * @throw std::runtime_error if the type is not a standard type.
+ */
+size_t getLeafValueSize(const LeafLayout& leaf_layout);
+
+/**
+ * Gathers the values of one leaf of consecutive samples into an array of values in the type of the
+ * leaf (a column).
+ * \li values at byte positions in platform byte order are gathered with a fixed size copy
+ * \li values at byte positions in the other byte order are gathered and byte swapped afterwards
+ * \li serialized bit fields are read bit by bit
+ * bool values are normalized to 0 and 1.
+ * @param[in] leaf_layout The leaf layout within one sample.
+ * @param[in] samples The data of the first sample.
+ * @param[in] samples_size The size of all samples in bytes.
+ * @param[in] sample_count The amount of samples to gather, the caller must make sure all samples
+ *                         are within \p samples_size.
+ * @param[in] stride The distance of the samples in bytes.
+ * @param[out] values The values, \p sample_count * @ref getLeafValueSize bytes.
+ * @throw std::runtime_error if the type is not a standard type.
+ */
+void gatherLeafValues(const LeafLayout& leaf_layout,
+                      const void* samples,
+                      size_t samples_size,
+                      size_t sample_count,
+                      size_t stride,
+                      void* values);
+
+} // namespace codec
+} // namespace ddl
+
+#endif // DDL_LEAF_GATHER_PRIVATE_HEADER
@@ -0,0 +1,267 @@
+/**
+ * @file
+ * Implementation of the SampleDiff.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "codec_elements.h"
+
+#include <ddl/codec/bitserializer.h>
+#include <ddl/codec/sample_diff.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ddl {
+namespace codec {
+
+namespace {
+
+/// a byte range is closed at this size, so a change only needs the comparison of a few leaves
+constexpr size_t max_byte_range_size = 64;
+
+size_t getByteSize(size_t bit_size)
+{
+    return (bit_size + 7) / 8;
+}
+
+/**
+ * Reads the bits of a bit field.
+ * @throw std::runtime_error if the bit field is not within the data.
+ */
+uint64_t readBitField(const void* data, size_t data_size, size_t bit_offset, size_t bit_size)
+{
+    a_util::memory::BitSerializer bit_reader(const_cast<void*>(data), data_size);
+    uint64_t value = 0;
+    const auto result =
+        bit_reader.read<uint64_t>(bit_offset, bit_size, &value, a_util::memory::bit_little_endian);
+    if (!result) {
+        throw std::runtime_error(result.getDescription());
+    }
+    return value;
+}
+
+/**
+ * Writes the bits of a bit field.
+ * @throw std::runtime_error if the bit field is not within the data.
+ */
+void writeBitField(void* data, size_t data_size, size_t bit_offset, size_t bit_size, uint64_t value)
+{
+    a_util::memory::BitSerializer bit_writer(data, data_size);
+    const auto result =
+        bit_writer.write<uint64_t>(bit_offset, bit_size, value, a_util::memory::bit_little_endian);
+    if (!result) {
+        throw std::runtime_error(result.getDescription());
+    }
+}
+
+} // namespace
+
+SampleDiff::SampleDiff(const CodecFactory& factory, DataRepresentation rep) : _representation(rep)
+{
+    const auto result = factory.isValid();
+    if (!result) {
+        throw std::runtime_error(result.getDescription());
+    }
+    if (factory._codec_access->isDynamic()) {
+        throw std::runtime_error("samples of dynamic structs can not be compared");
+    }
+    _sample_size = factory.getStaticBufferSize(rep);
+
+    for (const auto& codec_index: getCodecIndices(factory)) {
+        const auto& layout = codec_index.getLayout();
+        const auto bit_offset = (rep == deserialized) ? layout.deserialized.bit_offset :
+                                                        layout.serialized.bit_offset;
+        const auto bit_size = (rep == deserialized) ? layout.deserialized.type_bit_size :
+                                                      layout.serialized.type_bit_size_used;
+        if (bit_offset % 8 == 0 && bit_size % 8 == 0) {
+            _byte_leaves.push_back(_leaves.size());
+        }
+        else {
+            _bit_field_leaves.push_back(_leaves.size());
+        }
+        _leaves.push_back({codec_index, bit_offset, bit_size});
+    }
+
+    // the leaves are sorted by position within deserialized data, but the byte positions of
+    // serialized data may be in any order
+    std::stable_sort(_byte_leaves.begin(), _byte_leaves.end(), [this](size_t left, size_t right) {
+        return _leaves[left].bit_offset < _leaves[right].bit_offset;
+    });
+    for (size_t sorted_leaf = 0; sorted_leaf < _byte_leaves.size(); ++sorted_leaf) {
+        const auto& leaf = _leaves[_byte_leaves[sorted_leaf]];
+        const auto byte_pos = leaf.bit_offset / 8;
+        const auto byte_size = leaf.bit_size / 8;
+        if (!_byte_ranges.empty() &&
+            _byte_ranges.back().byte_pos + _byte_ranges.back().byte_size == byte_pos &&
+            _byte_ranges.back().byte_size < max_byte_range_size) {
+            _byte_ranges.back().byte_size += byte_size;
+            ++_byte_ranges.back().leaf_count;
+        }
+        else {
+            _byte_ranges.push_back({byte_pos, byte_size, sorted_leaf, 1});
+        }
+    }
+}
+
+DataRepresentation SampleDiff::getRepresentation() const noexcept
+{
+    return _representation;
+}
+
+size_t SampleDiff::getSampleSize() const noexcept
+{
+    return _sample_size;
+}
+
+size_t SampleDiff::getLeafCount() const noexcept
+{
+    return _leaves.size();
+}
+
+const CodecIndex& SampleDiff::getLeafCodecIndex(size_t leaf) const
+{
+    if (leaf >= _leaves.size()) {
+        throw std::runtime_error("leaf " + std::to_string(leaf) + " does not exist");
+    }
+    return _leaves[leaf].codec_index;
+}
+
+void SampleDiff::checkSampleSizes(size_t previous_size, size_t current_size) const
+{
+    if (previous_size < _sample_size || current_size < _sample_size) {
+        throw std::runtime_error("the sample size is smaller than " + std::to_string(_sample_size));
+    }
+}
+
+size_t SampleDiff::diff(const void* previous,
+                        size_t previous_size,
+                        const void* current,
+                        size_t current_size,
+                        std::vector<size_t>& changed_leaves) const
+{
+    checkSampleSizes(previous_size, current_size);
+    changed_leaves.clear();
+    const auto previous_bytes = static_cast<const uint8_t*>(previous);
+    const auto current_bytes = static_cast<const uint8_t*>(current);
+    for (const auto& byte_range: _byte_ranges) {
+        if (std::memcmp(previous_bytes + byte_range.byte_pos,
+                        current_bytes + byte_range.byte_pos,
+                        byte_range.byte_size) == 0) {
+            continue;
+        }
+        if (byte_range.leaf_count == 1) {
+            changed_leaves.push_back(_byte_leaves[byte_range.first_leaf]);
+            continue;
+        }
+        for (size_t sorted_leaf = byte_range.first_leaf;
+             sorted_leaf < byte_range.first_leaf + byte_range.leaf_count;
+             ++sorted_leaf) {
+            const auto& leaf = _leaves[_byte_leaves[sorted_leaf]];
+            const auto byte_pos = leaf.bit_offset / 8;
+            if (std::memcmp(previous_bytes + byte_pos,
+                            current_bytes + byte_pos,
+                            leaf.bit_size / 8) != 0) {
+                changed_leaves.push_back(_byte_leaves[sorted_leaf]);
+            }
+        }
+    }
+    for (const auto bit_field_leaf: _bit_field_leaves) {
+        const auto& leaf = _leaves[bit_field_leaf];
+        if (readBitField(previous, previous_size, leaf.bit_offset, leaf.bit_size) !=
+            readBitField(current, current_size, leaf.bit_offset, leaf.bit_size)) {
+            changed_leaves.push_back(bit_field_leaf);
+        }
+    }
+    std::sort(changed_leaves.begin(), changed_leaves.end());
+    return changed_leaves.size();
+}
+
+std::vector<size_t> SampleDiff::diff(const void* previous,
+                                     size_t previous_size,
+                                     const void* current,
+                                     size_t current_size) const
+{
+    std::vector<size_t> changed_leaves;
+    diff(previous, previous_size, current, current_size, changed_leaves);
+    return changed_leaves;
+}
+
+size_t SampleDiff::encodeDelta(const void* previous,
+                               size_t previous_size,
+                               const void* current,
+                               size_t current_size,
+                               std::vector<uint8_t>& delta) const
+{
+    const auto changed_leaves = diff(previous, previous_size, current, current_size);
+
+    delta.clear();
+    const auto current_bytes = static_cast<const uint8_t*>(current);
+    for (const auto changed_leaf: changed_leaves) {
+        const auto& leaf = _leaves[changed_leaf];
+        const auto leaf_index = static_cast<uint32_t>(changed_leaf);
+        const auto delta_pos = delta.size();
+        delta.resize(delta_pos + sizeof(leaf_index) + getByteSize(leaf.bit_size));
+        std::memcpy(&delta[delta_pos], &leaf_index, sizeof(leaf_index));
+        uint8_t* value = &delta[delta_pos + sizeof(leaf_index)];
+        if (leaf.bit_offset % 8 == 0 && leaf.bit_size % 8 == 0) {
+            std::memcpy(value, current_bytes + leaf.bit_offset / 8, leaf.bit_size / 8);
+        }
+        else {
+            auto bits = readBitField(current, current_size, leaf.bit_offset, leaf.bit_size);
+            for (size_t byte = 0; byte < getByteSize(leaf.bit_size); ++byte, bits >>= 8) {
+                value[byte] = static_cast<uint8_t>(bits & 0xFF);
+            }
+        }
+    }
+    return changed_leaves.size();
+}
+
+void SampleDiff::applyDelta(const void* delta,
+                            size_t delta_size,
+                            void* data,
+                            size_t data_size) const
+{
+    if (data_size < _sample_size) {
+        throw std::runtime_error("the sample size is smaller than " + std::to_string(_sample_size));
+    }
+    const auto delta_bytes = static_cast<const uint8_t*>(delta);
+    const auto data_bytes = static_cast<uint8_t*>(data);
+    size_t delta_pos = 0;
+    while (delta_pos < delta_size) {
+        uint32_t leaf_index;
+        if (delta_size - delta_pos < sizeof(leaf_index)) {
+            throw std::runtime_error("the delta is truncated");
+        }
+        std::memcpy(&leaf_index, delta_bytes + delta_pos, sizeof(leaf_index));
+        delta_pos += sizeof(leaf_index);
+        if (leaf_index >= _leaves.size()) {
+            throw std::runtime_error("leaf " + std::to_string(leaf_index) + " does not exist");
+        }
+        const auto& leaf = _leaves[leaf_index];
+        const auto byte_size = getByteSize(leaf.bit_size);
+        if (delta_size - delta_pos < byte_size) {
+            throw std::runtime_error("the delta is truncated");
+        }
+        const uint8_t* value = delta_bytes + delta_pos;
+        if (leaf.bit_offset % 8 == 0 && leaf.bit_size % 8 == 0) {
+            std::memcpy(data_bytes + leaf.bit_offset / 8, value, byte_size);
+        }
+        else {
+            uint64_t bits = 0;
+            for (size_t byte = byte_size; byte > 0; --byte) {
+                bits = (bits << 8) | value[byte - 1];
+            }
+            writeBitField(data, data_size, leaf.bit_offset, leaf.bit_size, bits);
+        }
+        delta_pos += byte_size;
+    }
+}
+
+} // namespace codec
+} // namespace ddl
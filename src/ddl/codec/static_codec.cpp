@@ -101,6 +101,11 @@ const StaticDecoder::Elements& StaticDecoder::getElements() const
     return _first_element.getChildElements();
 }
 
+const std::vector<CodecIndex>& StaticDecoder::getLeafIndices() const
+{
+    return getOrCreateLeafIndices(*_codec_access, getElements());
+}
+
 size_t StaticDecoder::getElementChildCount(const CodecIndex& codec_index) const
 {
     return _codec_access->getElementChildCount(codec_index, false);
@@ -396,6 +401,10 @@ void* StaticCodec::getElementAddress(const CodecIndex& index)
 
 void StaticCodec::resetValues(bool zero_values)
 {
+    if (resetWithDefaultValueImage(
+            _codec_access, getData(), getDataSize(), getRepresentation(), zero_values)) {
+        return;
+    }
     forEachLeafElement(getElements(), [&zero_values](StaticCodec::Element& element) {
         element.reset(zero_values);
     });
@@ -408,5 +417,41 @@ void* StaticCodec::getData() noexcept
     return const_cast<void*>(_data);
 }
 
+bool resetWithDefaultValueImage(const std::shared_ptr<const StructAccess>& codec_access,
+                                void* data,
+                                size_t data_size,
+                                DataRepresentation representation,
+                                bool zero_values)
+{
+    if (codec_access->isDynamic() || !codec_access->getInitResult()) {
+        return false;
+    }
+    auto default_value_image = codec_access->getDefaultValueImage(representation, zero_values);
+    if (!default_value_image) {
+        // reset a buffer filled with 0 and a buffer filled with 1 element by element to find out
+        // which bits are written
+        const auto buffer_size = codec_access->getStaticBufferSize(representation);
+        std::vector<uint8_t> image_on_zeros(buffer_size, 0x00);
+        std::vector<uint8_t> image_on_ones(buffer_size, 0xFF);
+        try {
+            for (auto image: {&image_on_zeros, &image_on_ones}) {
+                StaticCodec codec(codec_access, image->data(), image->size(), representation);
+                forEachLeafElement(codec.getElements(),
+                                   [&zero_values](StaticCodec::Element& element) {
+                                       element.reset(zero_values);
+                                   });
+            }
+            default_value_image = std::make_shared<const DefaultValueImage>(
+                std::move(image_on_zeros), image_on_ones);
+        }
+        catch (const std::exception&) {
+            // the reset element by element will report the error
+            default_value_image = std::make_shared<const DefaultValueImage>();
+        }
+        codec_access->setDefaultValueImage(representation, zero_values, default_value_image);
+    }
+    return default_value_image->apply(data, data_size);
+}
+
 } // namespace codec
 } // namespace ddl
@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../utilities/dd_arena.h"
+
 #include <a_util/xml.h>
 #include <ddl/datamodel/datamodel_datadefinition.h>
 
@@ -33,7 +35,7 @@ DataDefinition::DataDefinition(const dd::Version& ddl_version)
       ModelSubject<StreamMetaType>(),
       ModelSubject<Stream>(),
       InfoMap(),
-      _header(std::make_shared<Header>(ddl_version)),
+      _header(utility::makeShared<Header>(ddl_version)),
       _base_units(this, "datamodel::DataDefinition::BaseUnit"),
       _unit_prefixes(this, "datamodel::DataDefinition::UnitPrefixes"),
       _units(this, "datamodel::DataDefinition::Units"),
@@ -62,7 +64,7 @@ DataDefinition::DataDefinition(const DataDefinition& other)
       ModelSubject<StreamMetaType>(),
       ModelSubject<Stream>(),
       InfoMap(),
-      _header(std::make_shared<Header>(*other._header.get())),
+      _header(utility::makeShared<Header>(*other._header.get())),
       _base_units(other._base_units),
       _unit_prefixes(other._unit_prefixes),
       _units(other._units),
@@ -85,7 +87,7 @@ DataDefinition::DataDefinition(const DataDefinition& other)
 
 DataDefinition& DataDefinition::operator=(const DataDefinition& other)
 {
-    _header = std::make_shared<Header>(*other._header.get());
+    _header = utility::makeShared<Header>(*other._header.get());
     _base_units = other._base_units;
     _unit_prefixes = other._unit_prefixes;
     _units = other._units;
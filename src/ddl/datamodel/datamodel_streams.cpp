@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../utilities/dd_arena.h"
+
 #include <ddl/datamodel/datamodel_streams.h>
 #include <ddl/dd/dd_infomodel_type.h>
 
@@ -114,7 +116,7 @@ Stream::Stream(const Stream& other)
       InfoMap(),
       _structs(this, "Stream::Struct")
 {
-    setInfo<NamedContainerInfoStream>(std::make_shared<NamedContainerInfoStream>());
+    setInfo<NamedContainerInfoStream>(utility::makeShared<NamedContainerInfoStream>());
     operator=(other);
 }
 
@@ -133,7 +135,7 @@ Stream::Stream(Stream&& other)
       InfoMap(),
       _structs(this, "Stream::Struct")
 {
-    setInfo<NamedContainerInfoStream>(std::make_shared<NamedContainerInfoStream>());
+    setInfo<NamedContainerInfoStream>(utility::makeShared<NamedContainerInfoStream>());
     std::swap(_name, other._name);
     std::swap(_stream_type_name, other._stream_type_name);
     std::swap(_description, other._description);
@@ -163,7 +165,7 @@ Stream::Stream(const std::string& name,
       _description(description),
       _structs(this, "Stream::Struct")
 {
-    setInfo<NamedContainerInfoStream>(std::make_shared<NamedContainerInfoStream>());
+    setInfo<NamedContainerInfoStream>(utility::makeShared<NamedContainerInfoStream>());
     for (const auto& stream_struct: structs) {
         getStructs().add(stream_struct);
     }
@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../utilities/dd_arena.h"
+
 #include <ddl/datamodel/datamodel_types.h>
 #include <ddl/dd/dd_infomodel_type.h>
 #include <ddl/utilities/std_to_string.h>
@@ -33,7 +35,7 @@ void copyTypeInfoModel(InfoMap& this_info_map, const InfoMap& other_info)
 {
     const auto type_info = other_info.getInfo<dd::TypeInfo>();
     if (type_info) {
-        this_info_map.template setInfo<dd::TypeInfo>(std::make_shared<dd::TypeInfo>(*type_info));
+        this_info_map.template setInfo<dd::TypeInfo>(utility::makeShared<dd::TypeInfo>(*type_info));
     }
 }
 
@@ -42,7 +44,7 @@ void moveTypeInfoModel(InfoMap& this_info_map, InfoMap&& other_info)
     auto type_info = other_info.getInfo<dd::TypeInfo>();
     if (type_info) {
         this_info_map.template setInfo<dd::TypeInfo>(
-            std::make_shared<dd::TypeInfo>(std::move(*type_info)));
+            utility::makeShared<dd::TypeInfo>(std::move(*type_info)));
     }
 }
 
@@ -51,7 +53,7 @@ void copyElementTypeInfo(InfoMap& this_info_map, const InfoMap& other_info)
     const auto element_type_info = other_info.getInfo<dd::ElementTypeInfo>();
     if (element_type_info) {
         this_info_map.template setInfo<dd::ElementTypeInfo>(
-            std::make_shared<dd::ElementTypeInfo>(*element_type_info));
+            utility::makeShared<dd::ElementTypeInfo>(*element_type_info));
     }
 }
 } // namespace
@@ -831,7 +833,7 @@ StructType::StructType(const std::string& name,
       _alignment(alignment),
       _elements(this, "datamodel::StructType::Elements")
 {
-    setInfo<NamedContainerInfoStructType>(std::make_shared<NamedContainerInfoStructType>());
+    setInfo<NamedContainerInfoStructType>(utility::makeShared<NamedContainerInfoStructType>());
     for (auto& ref_elem: elements) {
         getElements().add(ref_elem);
     }
@@ -871,7 +873,7 @@ StructType::StructType(const StructType& other)
       _ddl_version(other._ddl_version),
       _elements(other._elements)
 {
-    setInfo<NamedContainerInfoStructType>(std::make_shared<NamedContainerInfoStructType>());
+    setInfo<NamedContainerInfoStructType>(utility::makeShared<NamedContainerInfoStructType>());
     auto named_list = getNamedItemList();
     auto other_element_it = other._elements.begin();
     for (auto& value: _elements) {
@@ -896,7 +898,7 @@ StructType::StructType(StructType&& other)
       _ddl_version(std::move(other._ddl_version)),
       _elements(std::move(other._elements))
 {
-    setInfo<NamedContainerInfoStructType>(std::make_shared<NamedContainerInfoStructType>());
+    setInfo<NamedContainerInfoStructType>(utility::makeShared<NamedContainerInfoStructType>());
     _elements.setValidator(this);
 }
 
@@ -9,12 +9,16 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "xml_ddfromxml_reader.h"
+#include "xml_ddtoxml_writer.h"
+
 #include <a_util/xml.h>
 #include <ddl/datamodel/xml_datamodel.h>
 #include <ddl/datamodel/xml_ddfromxml_factory.h>
 #include <ddl/datamodel/xml_ddtoxml_factory.h>
 
 #include <exception>
+#include <fstream>
 #include <utility>
 
 namespace ddl {
@@ -32,15 +36,11 @@ DataDefinition fromXMLString(const std::string& xml_string,
     // parse the DataDefinition
     // the most important thing of performant reading is: We validate and re-calculate internals at
     // the very end!! this will just read and fill in the datamodel
-    a_util::xml::DOM dd_string;
-
-    if (dd_string.fromString(xml_string)) {
-        a_util::xml::DOMElement root = dd_string.getRoot();
-        new_dd = dd::DDFromXMLFactory<a_util::xml::DOMElement>::createDD(
-            root, dd_language_version, strict);
-    }
-    else {
-        throw dd::Error("readFromXMLString", {"..."}, dd_string.getLastError());
+    // the XML is read in one pass without creating a DOM
+    std::string xml_buffer = xml_string;
+    std::string xml_error;
+    if (!detail::readXML(xml_buffer, dd_language_version, strict, new_dd, xml_error)) {
+        throw dd::Error("readFromXMLString", {"..."}, xml_error);
     }
 
     return new_dd;
@@ -48,15 +48,15 @@ DataDefinition fromXMLString(const std::string& xml_string,
 
 std::string toXMLString(const dd::datamodel::DataDefinition& dd)
 {
-    a_util::xml::DOM dom;
-    dom.fromString("<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>\n"
-                   "<ddl:ddl xmlns:ddl=\"ddl\"> \n"
-                   "</ddl:ddl>");
-
-    a_util::xml::DOMElement root = dom.getRoot();
-    dd::DDToXMLFactory<a_util::xml::DOMElement>::createNode(root, dd);
+    // the writer creates the same output as the DOM created by DDToXMLFactory, but in one pass
+    std::string xml_string;
+    detail::writeXML(dd, xml_string);
+    return xml_string;
+}
 
-    return dom.toString();
+void toXMLStream(const dd::datamodel::DataDefinition& dd, std::ostream& xml_stream)
+{
+    detail::writeXML(dd, xml_stream);
 }
 
 // static reading
@@ -66,8 +66,22 @@ DataDefinition fromXMLFile(const std::string& xml_filepath, bool strict)
     // parse the DataDefinition
     // the most important thing of performant reading is: We validate and re-calculate internals at
     // the very end!! this will just read and fill in the datamodel
-    a_util::xml::DOM ddl_file;
+    std::string xml_buffer;
+    std::string xml_error;
+    if (!detail::readXMLFile(xml_filepath, xml_buffer, xml_error)) {
+        throw dd::Error("readFromFile", {xml_filepath}, xml_error);
+    }
+    if (detail::convertXMLFileToUTF8(xml_buffer)) {
+        // we use the version from the file
+        if (!detail::readXML(
+                xml_buffer, dd::Version::ddl_version_notset, strict, new_ddl, xml_error)) {
+            throw dd::Error("readFromFile", {xml_filepath}, xml_error);
+        }
+        return new_ddl;
+    }
 
+    // UTF-16 and UTF-32 encoded files are only supported by the DOM
+    a_util::xml::DOM ddl_file;
     if (ddl_file.load(xml_filepath)) {
         a_util::xml::DOMElement root = ddl_file.getRoot();
         // we use the version from the file
@@ -101,9 +115,14 @@ void saveXMLFile(const a_util::xml::DOM& dom, const std::string& xml_filepath)
 
 void toXMLFile(const dd::datamodel::DataDefinition& ddl, const std::string& xml_filepath)
 {
-    a_util::xml::DOM dom;
-    prepareXMLFile(ddl, dom);
-    saveXMLFile(dom, xml_filepath);
+    std::ofstream xml_file(xml_filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (xml_file) {
+        detail::writeXML(ddl, xml_file);
+        xml_file.close();
+    }
+    if (!xml_file) {
+        throw dd::Error("writeToFile", {"xml_filepath"}, "Failed to save dom to file");
+    }
 }
 
 void toXMLFile(const dd::datamodel::DataDefinition& ddl,
@@ -0,0 +1,1110 @@
+/**
+ * @file
+ * OO DataDefinition Redesign
+ *
+ * Copyright @ 2021 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "xml_ddfromxml_reader.h"
+
+#include <ddl/datamodel/xml_ddfromxml_factory.h>
+
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <utility>
+
+namespace ddl {
+namespace dd {
+namespace datamodel {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Non owning string within the XML buffer.
+ */
+struct XMLString {
+    const char* data = nullptr;
+    size_t size = 0;
+
+    bool operator==(const char* other) const
+    {
+        return std::strncmp(data, other, size) == 0 && other[size] == '\0';
+    }
+    bool operator==(const XMLString& other) const
+    {
+        return size == other.size && std::memcmp(data, other.data, size) == 0;
+    }
+    std::string toString() const
+    {
+        return std::string(data, size);
+    }
+};
+
+/**
+ * @brief Error of the XML syntax, the descriptions are the same as the DOM uses.
+ */
+struct XMLSyntaxError {
+    const char* description;
+};
+
+/**
+ * @brief Pull parser tokenizing a XML buffer in place.
+ * Attribute values and text are unescaped within the buffer, all returned strings point into the
+ * buffer. The whitespace and end of line handling is the same as the DOM uses (pugixml default
+ * parse options): whitespace only text is skipped, \\r\\n is converted to \\n in text and tabs and
+ * line breaks are converted to spaces in attribute values.
+ */
+class XMLPullParser {
+public:
+    enum class Token { start_element, end_element, text, end_of_document };
+
+    struct Attribute {
+        XMLString name;
+        XMLString value;
+    };
+
+    XMLPullParser(char* begin, char* end) : _current(begin), _end(end)
+    {
+        // skip the UTF-8 BOM
+        if (_end - _current >= 3 && _current[0] == '\xef' && _current[1] == '\xbb' &&
+            _current[2] == '\xbf') {
+            _current += 3;
+        }
+    }
+
+    /**
+     * @brief Reads the next token.
+     * @throws XMLSyntaxError if the XML is not well formed
+     */
+    Token next()
+    {
+        if (_empty_element_end_pending) {
+            _empty_element_end_pending = false;
+            _name = _open_elements.back();
+            _open_elements.pop_back();
+            return Token::end_element;
+        }
+        while (_current != _end) {
+            if (*_current != '<') {
+                if (parseText()) {
+                    return Token::text;
+                }
+                continue;
+            }
+            ++_current;
+            if (_current == _end) {
+                throw XMLSyntaxError{"Could not determine tag type"};
+            }
+            switch (*_current) {
+            case '?':
+                skipProcessingInstruction();
+                break;
+            case '!':
+                if (parseExclamation()) {
+                    return Token::text;
+                }
+                break;
+            case '/':
+                parseEndElement();
+                return Token::end_element;
+            default:
+                parseStartElement();
+                return Token::start_element;
+            }
+        }
+        if (!_open_elements.empty()) {
+            throw XMLSyntaxError{"Start-end tags mismatch"};
+        }
+        if (!_element_found) {
+            throw XMLSyntaxError{"No document element found"};
+        }
+        return Token::end_of_document;
+    }
+
+    /// name of the element of the last start_element or end_element token
+    const XMLString& getName() const
+    {
+        return _name;
+    }
+
+    /// attributes of the element of the last start_element token
+    const std::vector<Attribute>& getAttributes() const
+    {
+        return _attributes;
+    }
+
+    /// content of the last text token
+    const XMLString& getText() const
+    {
+        return _text;
+    }
+
+    /// count of the open elements (including the element of the last start_element token)
+    size_t getDepth() const
+    {
+        return _open_elements.size();
+    }
+
+    /// name of the open element at the given depth (1 is the root element)
+    const XMLString& getOpenElementName(size_t depth) const
+    {
+        return _open_elements[depth - 1];
+    }
+
+private:
+    static bool isSpace(char character)
+    {
+        return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+    }
+
+    static bool isStartSymbol(char character)
+    {
+        return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+               character == '_' || character == ':' || static_cast<unsigned char>(character) >= 128;
+    }
+
+    static bool isSymbol(char character)
+    {
+        return isStartSymbol(character) || (character >= '0' && character <= '9') ||
+               character == '-' || character == '.';
+    }
+
+    void skipSpaces()
+    {
+        while (_current != _end && isSpace(*_current)) {
+            ++_current;
+        }
+    }
+
+    bool startsWith(const char* prefix) const
+    {
+        const size_t size = std::strlen(prefix);
+        return static_cast<size_t>(_end - _current) >= size &&
+               std::memcmp(_current, prefix, size) == 0;
+    }
+
+    char* find(const char* pattern) const
+    {
+        const size_t size = std::strlen(pattern);
+        for (char* position = _current; static_cast<size_t>(_end - position) >= size; ++position) {
+            position = static_cast<char*>(std::memchr(position, pattern[0], _end - position));
+            if (position == nullptr || static_cast<size_t>(_end - position) < size) {
+                break;
+            }
+            if (std::memcmp(position, pattern, size) == 0) {
+                return position;
+            }
+        }
+        return nullptr;
+    }
+
+    XMLString parseName()
+    {
+        XMLString name;
+        name.data = _current;
+        if (_current == _end || !isStartSymbol(*_current)) {
+            return name;
+        }
+        while (_current != _end && isSymbol(*_current)) {
+            ++_current;
+        }
+        name.size = static_cast<size_t>(_current - name.data);
+        return name;
+    }
+
+    /**
+     * Unescapes the predefined entities and the character references like the DOM does.
+     * Unknown or malformed references stay as they are.
+     * @return the size of the unescaped escape sequence written to \p target
+     */
+    static size_t unescape(const char*& source, const char* source_end, char* target)
+    {
+        const char* reference = source + 1;
+        const auto matches = [&](const char* entity) {
+            const size_t size = std::strlen(entity);
+            return static_cast<size_t>(source_end - reference) >= size &&
+                   std::memcmp(reference, entity, size) == 0;
+        };
+        if (reference != source_end && *reference == '#') {
+            ++reference;
+            const bool is_hex = reference != source_end && *reference == 'x';
+            if (is_hex) {
+                ++reference;
+            }
+            uint32_t code_point = 0;
+            const char* digit = reference;
+            for (; digit != source_end && *digit != ';'; ++digit) {
+                const char character = *digit;
+                if (character >= '0' && character <= '9') {
+                    code_point = code_point * (is_hex ? 16 : 10) + (character - '0');
+                }
+                else if (is_hex && (character | ' ') >= 'a' && (character | ' ') <= 'f') {
+                    code_point = code_point * 16 + ((character | ' ') - 'a' + 10);
+                }
+                else {
+                    break;
+                }
+            }
+            if (digit == source_end || *digit != ';' || digit == reference) {
+                target[0] = '&';
+                ++source;
+                return 1;
+            }
+            source = digit + 1;
+            return writeUTF8(code_point, target);
+        }
+        static const std::pair<const char*, char> entities[] = {
+            {"lt;", '<'}, {"gt;", '>'}, {"amp;", '&'}, {"apos;", '\''}, {"quot;", '"'}};
+        for (const auto& entity: entities) {
+            if (matches(entity.first)) {
+                source = reference + std::strlen(entity.first);
+                target[0] = entity.second;
+                return 1;
+            }
+        }
+        target[0] = '&';
+        ++source;
+        return 1;
+    }
+
+    static size_t writeUTF8(uint32_t code_point, char* target)
+    {
+        if (code_point < 0x80) {
+            target[0] = static_cast<char>(code_point);
+            return 1;
+        }
+        if (code_point < 0x800) {
+            target[0] = static_cast<char>(0xC0 | (code_point >> 6));
+            target[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 2;
+        }
+        if (code_point < 0x10000) {
+            target[0] = static_cast<char>(0xE0 | (code_point >> 12));
+            target[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            target[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+            return 3;
+        }
+        target[0] = static_cast<char>(0xF0 | (code_point >> 18));
+        target[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        target[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        target[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 4;
+    }
+
+    /**
+     * Converts the content in place, the converted content is never longer than the original.
+     */
+    static XMLString convert(char* begin, char* end, bool is_attribute, bool unescape_references)
+    {
+        char* target = begin;
+        const char* source = begin;
+        while (source != end) {
+            const char character = *source;
+            if (character == '&' && unescape_references) {
+                target += unescape(source, end, target);
+            }
+            else if (character == '\r') {
+                ++source;
+                if (source != end && *source == '\n') {
+                    ++source;
+                }
+                *target++ = is_attribute ? ' ' : '\n';
+            }
+            else {
+                *target++ = (is_attribute && (character == '\n' || character == '\t')) ?
+                                ' ' :
+                                character;
+                ++source;
+            }
+        }
+        return {begin, static_cast<size_t>(target - begin)};
+    }
+
+    bool parseText()
+    {
+        char* text_begin = _current;
+        auto text_end = static_cast<char*>(std::memchr(_current, '<', _end - _current));
+        if (text_end == nullptr) {
+            text_end = _end;
+        }
+        _current = text_end;
+        // text on document level and whitespace only text is skipped
+        if (_open_elements.empty()) {
+            return false;
+        }
+        bool is_whitespace = true;
+        for (const char* position = text_begin; position != text_end; ++position) {
+            if (!isSpace(*position)) {
+                is_whitespace = false;
+                break;
+            }
+        }
+        if (is_whitespace) {
+            return false;
+        }
+        _text = convert(text_begin, text_end, false, true);
+        return true;
+    }
+
+    void skipProcessingInstruction()
+    {
+        ++_current;
+        if (_current == _end || !isStartSymbol(*_current)) {
+            throw XMLSyntaxError{"Error parsing document declaration/processing instruction"};
+        }
+        char* instruction_end = find("?>");
+        if (instruction_end == nullptr) {
+            throw XMLSyntaxError{"Error parsing document declaration/processing instruction"};
+        }
+        _current = instruction_end + 2;
+    }
+
+    bool parseExclamation()
+    {
+        ++_current;
+        if (startsWith("--")) {
+            _current += 2;
+            char* comment_end = find("-->");
+            if (comment_end == nullptr) {
+                throw XMLSyntaxError{"Error parsing comment"};
+            }
+            _current = comment_end + 3;
+            return false;
+        }
+        if (startsWith("[CDATA[")) {
+            _current += 7;
+            char* cdata_begin = _current;
+            char* cdata_end = find("]]>");
+            if (cdata_end == nullptr) {
+                throw XMLSyntaxError{"Error parsing CDATA section"};
+            }
+            _current = cdata_end + 3;
+            if (_open_elements.empty()) {
+                return false;
+            }
+            _text = convert(cdata_begin, cdata_end, false, false);
+            return true;
+        }
+        if (startsWith("DOCTYPE")) {
+            size_t bracket_depth = 0;
+            for (; _current != _end; ++_current) {
+                const char character = *_current;
+                if (character == '"' || character == '\'') {
+                    auto quote_end =
+                        static_cast<char*>(std::memchr(_current + 1, character, _end - _current - 1));
+                    if (quote_end == nullptr) {
+                        break;
+                    }
+                    _current = quote_end;
+                }
+                else if (character == '[') {
+                    ++bracket_depth;
+                }
+                else if (character == ']' && bracket_depth > 0) {
+                    --bracket_depth;
+                }
+                else if (character == '>' && bracket_depth == 0) {
+                    ++_current;
+                    return false;
+                }
+            }
+            throw XMLSyntaxError{"Error parsing document type declaration"};
+        }
+        if (startsWith("-")) {
+            throw XMLSyntaxError{"Error parsing comment"};
+        }
+        throw XMLSyntaxError{"Could not determine tag type"};
+    }
+
+    void parseEndElement()
+    {
+        ++_current;
+        _name = parseName();
+        if (_open_elements.empty() || !(_name == _open_elements.back())) {
+            throw XMLSyntaxError{"Start-end tags mismatch"};
+        }
+        skipSpaces();
+        if (_current == _end || *_current != '>') {
+            throw XMLSyntaxError{"Error parsing end element tag"};
+        }
+        ++_current;
+        _open_elements.pop_back();
+    }
+
+    void parseStartElement()
+    {
+        _name = parseName();
+        if (_name.size == 0) {
+            throw XMLSyntaxError{_current == _end || isSpace(*_current) ?
+                                     "Could not determine tag type" :
+                                     "Error parsing start element tag"};
+        }
+        _attributes.clear();
+        for (;;) {
+            const char* before_spaces = _current;
+            skipSpaces();
+            if (_current == _end) {
+                throw XMLSyntaxError{"Error parsing start element tag"};
+            }
+            if (*_current == '>') {
+                ++_current;
+                break;
+            }
+            if (*_current == '/') {
+                ++_current;
+                if (_current == _end || *_current != '>') {
+                    throw XMLSyntaxError{"Error parsing start element tag"};
+                }
+                ++_current;
+                _empty_element_end_pending = true;
+                break;
+            }
+            if (before_spaces == _current) {
+                throw XMLSyntaxError{"Error parsing start element tag"};
+            }
+            parseAttribute();
+        }
+        _open_elements.push_back(_name);
+        _element_found = true;
+    }
+
+    void parseAttribute()
+    {
+        Attribute attribute;
+        attribute.name = parseName();
+        if (attribute.name.size == 0) {
+            throw XMLSyntaxError{"Error parsing start element tag"};
+        }
+        skipSpaces();
+        if (_current == _end || *_current != '=') {
+            throw XMLSyntaxError{"Error parsing element attribute"};
+        }
+        ++_current;
+        skipSpaces();
+        if (_current == _end || (*_current != '"' && *_current != '\'')) {
+            throw XMLSyntaxError{"Error parsing element attribute"};
+        }
+        const char quote = *_current++;
+        char* value_begin = _current;
+        auto value_end = static_cast<char*>(std::memchr(_current, quote, _end - _current));
+        if (value_end == nullptr) {
+            throw XMLSyntaxError{"Error parsing element attribute"};
+        }
+        _current = value_end + 1;
+        attribute.value = convert(value_begin, value_end, true, true);
+        _attributes.push_back(attribute);
+    }
+
+    char* _current;
+    char* _end;
+    XMLString _name;
+    XMLString _text;
+    std::vector<Attribute> _attributes;
+    std::vector<XMLString> _open_elements;
+    bool _empty_element_end_pending = false;
+    bool _element_found = false;
+};
+
+/**
+ * @brief Compact tree of one XML element and its sub elements.
+ * Holds all information of the XML needed by the DDFromXMLFactory.
+ */
+class XMLSubTree {
+public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    struct Element {
+        XMLString name;
+        XMLString data;
+        bool has_data = false;
+        size_t first_attribute = 0;
+        size_t attribute_count = 0;
+        size_t first_child = npos;
+        size_t last_child = npos;
+        size_t next_sibling = npos;
+    };
+
+    void clear()
+    {
+        _elements.clear();
+        _attributes.clear();
+    }
+
+    size_t addElement(size_t parent_index,
+                      const XMLString& name,
+                      const std::vector<XMLPullParser::Attribute>& attributes)
+    {
+        Element element;
+        element.name = name;
+        element.first_attribute = _attributes.size();
+        element.attribute_count = attributes.size();
+        _attributes.insert(_attributes.end(), attributes.begin(), attributes.end());
+        const size_t element_index = _elements.size();
+        _elements.push_back(element);
+        if (parent_index != npos) {
+            auto& parent = _elements[parent_index];
+            if (parent.last_child == npos) {
+                parent.first_child = element_index;
+            }
+            else {
+                _elements[parent.last_child].next_sibling = element_index;
+            }
+            parent.last_child = element_index;
+        }
+        return element_index;
+    }
+
+    void addData(size_t element_index, const XMLString& data)
+    {
+        // like the DOM we use the first text within the element
+        auto& element = _elements[element_index];
+        if (!element.has_data) {
+            element.data = data;
+            element.has_data = true;
+        }
+    }
+
+    const Element& getElement(size_t element_index) const
+    {
+        return _elements[element_index];
+    }
+
+    const XMLPullParser::Attribute& getAttribute(size_t attribute_index) const
+    {
+        return _attributes[attribute_index];
+    }
+
+private:
+    std::vector<Element> _elements;
+    std::vector<XMLPullParser::Attribute> _attributes;
+};
+
+/**
+ * @brief Element of the XMLSubTree which follows the DOM_NODE_TYPE concept of the
+ * DDFromXMLFactory.
+ */
+class XMLSubTreeNode {
+public:
+    XMLSubTreeNode() = default;
+    XMLSubTreeNode(const XMLSubTree& tree, size_t element_index)
+        : _tree(&tree), _element_index(element_index)
+    {
+    }
+
+    std::string getAttribute(const char* name) const
+    {
+        const auto& element = _tree->getElement(_element_index);
+        for (size_t attribute_index = element.first_attribute;
+             attribute_index < element.first_attribute + element.attribute_count;
+             ++attribute_index) {
+            const auto& attribute = _tree->getAttribute(attribute_index);
+            if (attribute.name == name) {
+                return attribute.value.toString();
+            }
+        }
+        return {};
+    }
+
+    std::string getData() const
+    {
+        return _tree->getElement(_element_index).data.toString();
+    }
+
+    std::string getName() const
+    {
+        return _tree->getElement(_element_index).name.toString();
+    }
+
+    bool findNode(const std::string& name, XMLSubTreeNode& node) const
+    {
+        for (size_t child_index = _tree->getElement(_element_index).first_child;
+             child_index != XMLSubTree::npos;
+             child_index = _tree->getElement(child_index).next_sibling) {
+            if (_tree->getElement(child_index).name == name.c_str()) {
+                node = XMLSubTreeNode(*_tree, child_index);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool findNodes(const std::string& name, std::list<XMLSubTreeNode>& nodes) const
+    {
+        nodes.clear();
+        for (size_t child_index = _tree->getElement(_element_index).first_child;
+             child_index != XMLSubTree::npos;
+             child_index = _tree->getElement(child_index).next_sibling) {
+            if (_tree->getElement(child_index).name == name.c_str()) {
+                nodes.emplace_back(*_tree, child_index);
+            }
+        }
+        return !nodes.empty();
+    }
+
+private:
+    const XMLSubTree* _tree = nullptr;
+    size_t _element_index = 0;
+};
+
+using Factory = DDFromXMLFactory<XMLSubTreeNode>;
+
+/**
+ * @brief Reads the datamodel from the token stream of the XMLPullParser.
+ * Only the item (header, unit, datatype, struct ...) which is currently read is kept as
+ * XMLSubTree. Items depending on the DDL version of the header are kept until the header is read.
+ */
+class DDFromXMLStreamReader {
+public:
+    /**
+     * @param collect_problems set to true to collect the problems of all items (like
+     *                         ddl::detail::fromXMLElement), otherwise the first error is thrown
+     *                         (like DDFromXMLFactory::createDD)
+     */
+    DDFromXMLStreamReader(const Version& ddl_language_version, bool strict, bool collect_problems)
+        : _ddl_language_version(ddl_language_version),
+          _strict(strict),
+          _collect_problems(collect_problems),
+          _dd(collect_problems && ddl_language_version == Version(0, 0) ?
+                  Version::getLatestVersion() :
+                  ddl_language_version)
+    {
+    }
+
+    /**
+     * @throws XMLSyntaxError if the XML is not well formed
+     * @throws dd::Error if no problem list is used and an item can not be created
+     */
+    void read(XMLPullParser& parser)
+    {
+        for (;;) {
+            switch (parser.next()) {
+            case XMLPullParser::Token::start_element:
+                onStartElement(parser);
+                break;
+            case XMLPullParser::Token::end_element:
+                onEndElement(parser);
+                break;
+            case XMLPullParser::Token::text:
+                if (_item_kind != ItemKind::none) {
+                    _item.addData(_item_path.back(), parser.getText());
+                }
+                break;
+            case XMLPullParser::Token::end_of_document:
+                // no header within the XML
+                createPendingItems();
+                if (_first_error) {
+                    std::rethrow_exception(_first_error);
+                }
+                return;
+            }
+        }
+    }
+
+    bool hasProblems() const
+    {
+        return !_problems.empty();
+    }
+
+    const std::vector<Problem>& getProblems() const
+    {
+        return _problems;
+    }
+
+    DataDefinition& getDataDefinition()
+    {
+        return _dd;
+    }
+
+private:
+    enum class ItemKind {
+        none,
+        header,
+        base_unit,
+        unit_prefix,
+        unit,
+        data_type,
+        enum_type,
+        struct_type,
+        stream_meta_type,
+        stream
+    };
+
+    ItemKind getItemKind(const XMLPullParser& parser)
+    {
+        const size_t depth = parser.getDepth();
+        const auto& name = parser.getName();
+        if (depth == 1) {
+            ++_root_count;
+            // special read for definition of struct tag only <struct>
+            return (_root_count == 1 && name == "struct") ? ItemKind::struct_type : ItemKind::none;
+        }
+        const auto& parent_name = parser.getOpenElementName(depth - 1);
+        if (depth == 2 && _root_count == 1 && !_header_found && name == "header") {
+            return ItemKind::header;
+        }
+        if (parent_name == "units") {
+            if (name == "baseunit") {
+                return ItemKind::base_unit;
+            }
+            if (name == "prefixes") {
+                return ItemKind::unit_prefix;
+            }
+            if (name == "unit") {
+                return ItemKind::unit;
+            }
+        }
+        else if (parent_name == "datatypes" && name == "datatype") {
+            return ItemKind::data_type;
+        }
+        else if (parent_name == "enums" && name == "enum") {
+            return ItemKind::enum_type;
+        }
+        else if (parent_name == "structs" && name == "struct") {
+            return ItemKind::struct_type;
+        }
+        else if (parent_name == "streammetatypes" && name == "streammetatype") {
+            return ItemKind::stream_meta_type;
+        }
+        else if (parent_name == "streams" && name == "stream") {
+            return ItemKind::stream;
+        }
+        return ItemKind::none;
+    }
+
+    void onStartElement(const XMLPullParser& parser)
+    {
+        if (_item_kind == ItemKind::none) {
+            _item_kind = getItemKind(parser);
+            if (_item_kind == ItemKind::none) {
+                return;
+            }
+            _item_depth = parser.getDepth();
+            _item.clear();
+            _item_path.clear();
+            _item_path.push_back(
+                _item.addElement(XMLSubTree::npos, parser.getName(), parser.getAttributes()));
+        }
+        else {
+            _item_path.push_back(
+                _item.addElement(_item_path.back(), parser.getName(), parser.getAttributes()));
+        }
+    }
+
+    void onEndElement(const XMLPullParser& parser)
+    {
+        if (_item_kind == ItemKind::none) {
+            return;
+        }
+        _item_path.pop_back();
+        // the depth does not contain the closed element anymore
+        if (parser.getDepth() + 1 == _item_depth) {
+            const auto item_kind = _item_kind;
+            _item_kind = ItemKind::none;
+            if (item_kind == ItemKind::header) {
+                _header_found = true;
+                createHeader();
+                createPendingItems();
+            }
+            else if (!_header_found && (item_kind == ItemKind::data_type ||
+                                        item_kind == ItemKind::struct_type ||
+                                        item_kind == ItemKind::stream_meta_type)) {
+                // these items depend on the DDL version of the header
+                _pending_items.emplace_back(item_kind, _item);
+            }
+            else {
+                createItem(item_kind, _item);
+            }
+        }
+    }
+
+    void createHeader()
+    {
+        if (_stop_creating) {
+            return;
+        }
+        const XMLSubTreeNode header_node(_item, 0);
+        if (!_collect_problems) {
+            createItemOrRememberError([&]() { _dd.setHeader(Factory::createHeader(header_node)); });
+            return;
+        }
+        try {
+            _dd.setHeader(Factory::createHeader(header_node));
+        }
+        // we catch only dd errors
+        catch (const dd::Error& dd_error) {
+            // we need to break opening at all! Without a header we do not know the version i.e.
+            _problems.clear();
+            _problems.push_back({"xml - header", dd_error.what()});
+            _stop_creating = true;
+        }
+    }
+
+    void createPendingItems()
+    {
+        for (const auto& pending_item: _pending_items) {
+            createItem(pending_item.first, pending_item.second);
+        }
+        _pending_items.clear();
+    }
+
+    /**
+     * if we have no header within the XML we need to "guess" the DataDefinition language version
+     */
+    Version getFileVersion() const
+    {
+        return _header_found ? _dd.getVersion() : _ddl_language_version;
+    }
+
+    template <typename CreateFunction>
+    void createItemOrRememberError(CreateFunction create_item)
+    {
+        try {
+            create_item();
+        }
+        catch (...) {
+            // the XML is read to the end, syntax errors are reported first
+            _first_error = std::current_exception();
+            _stop_creating = true;
+        }
+    }
+
+    template <typename CreateFunction>
+    void createItem(const char* item_name, CreateFunction create_item)
+    {
+        if (!_collect_problems) {
+            createItemOrRememberError(create_item);
+            return;
+        }
+        try {
+            create_item();
+        }
+        // we catch only dd errors
+        catch (const dd::Error& dd_error) {
+            _problems.push_back({item_name, dd_error.what()});
+        }
+    }
+
+    void createItem(ItemKind item_kind, const XMLSubTree& item)
+    {
+        if (_stop_creating) {
+            return;
+        }
+        const XMLSubTreeNode node(item, 0);
+        switch (item_kind) {
+        case ItemKind::base_unit:
+            createItem("xml - baseunit",
+                       [&]() { _dd.getBaseUnits().emplace(Factory::createBaseUnit(node)); });
+            break;
+        case ItemKind::unit_prefix:
+            createItem("xml - prefix",
+                       [&]() { _dd.getUnitPrefixes().emplace(Factory::createUnitPrefix(node)); });
+            break;
+        case ItemKind::unit:
+            createItem("xml - unit", [&]() { _dd.getUnits().emplace(Factory::createUnit(node)); });
+            break;
+        case ItemKind::data_type:
+            createItem("xml - datatype", [&]() {
+                _dd.getDataTypes().emplace(
+                    Factory::createDataType(node, getFileVersion(), _strict));
+            });
+            break;
+        case ItemKind::enum_type:
+            createItem("xml - enum",
+                       [&]() { _dd.getEnumTypes().emplace(Factory::createEnumType(node)); });
+            break;
+        case ItemKind::struct_type:
+            createItem("xml - struct", [&]() {
+                _dd.getStructTypes().emplace(
+                    Factory::createStructType(node, getFileVersion(), _strict));
+            });
+            break;
+        case ItemKind::stream_meta_type: {
+            const auto file_version = getFileVersion();
+            if (file_version >= Version(4, 0) || !_strict ||
+                (_collect_problems && file_version == Version(0, 0))) {
+                createItem("xml - streammetatype", [&]() {
+                    _dd.getStreamMetaTypes().emplace(Factory::createStreamMetaType(node));
+                });
+            }
+            break;
+        }
+        case ItemKind::stream:
+            createItem("xml - stream",
+                       [&]() { _dd.getStreams().emplace(Factory::createStream(node)); });
+            break;
+        default:
+            break;
+        }
+    }
+
+    const Version _ddl_language_version;
+    const bool _strict;
+    const bool _collect_problems;
+    DataDefinition _dd;
+    std::vector<Problem> _problems;
+    std::exception_ptr _first_error;
+    bool _stop_creating = false;
+    bool _header_found = false;
+    size_t _root_count = 0;
+
+    ItemKind _item_kind = ItemKind::none;
+    size_t _item_depth = 0;
+    XMLSubTree _item;
+    std::vector<size_t> _item_path;
+    std::vector<std::pair<ItemKind, XMLSubTree>> _pending_items;
+};
+
+bool readXML(std::string& xml_buffer,
+             DDFromXMLStreamReader& reader,
+             std::string& xml_error)
+{
+    // like the DOM does for strings, the XML ends at the first 0 character
+    const size_t xml_size = std::strlen(xml_buffer.c_str());
+    XMLPullParser parser(&xml_buffer[0], &xml_buffer[0] + xml_size);
+    try {
+        reader.read(parser);
+    }
+    catch (const XMLSyntaxError& syntax_error) {
+        xml_error = syntax_error.description;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool readXMLFile(const std::string& xml_filepath, std::string& xml_buffer, std::string& xml_error)
+{
+    std::ifstream xml_file(xml_filepath, std::ios::in | std::ios::binary);
+    if (!xml_file) {
+        xml_error = "File was not found";
+        return false;
+    }
+    xml_file.seekg(0, std::ios::end);
+    const auto file_size = xml_file.tellg();
+    xml_file.seekg(0, std::ios::beg);
+    if (file_size < 0) {
+        xml_error = "Error reading from file/stream";
+        return false;
+    }
+    xml_buffer.resize(static_cast<size_t>(file_size));
+    if (!xml_buffer.empty() && !xml_file.read(&xml_buffer[0], file_size)) {
+        xml_error = "Error reading from file/stream";
+        return false;
+    }
+    return true;
+}
+
+bool convertXMLFileToUTF8(std::string& xml_buffer)
+{
+    // the same detection as the DOM does
+    if (xml_buffer.size() < 4) {
+        return true;
+    }
+    const auto* data = reinterpret_cast<const unsigned char*>(xml_buffer.data());
+    if (data[0] == 0 || data[1] == 0 || (data[0] == 0xfe && data[1] == 0xff) ||
+        (data[0] == 0xff && data[1] == 0xfe)) {
+        // UTF-16 or UTF-32
+        return false;
+    }
+    if (std::memcmp(data, "<?xml", 5) != 0 ||
+        !(data[5] == ' ' || data[5] == '\t' || data[5] == '\r' || data[5] == '\n')) {
+        return true;
+    }
+    const size_t declaration_end = xml_buffer.find('?', 5);
+    const size_t encoding_pos = xml_buffer.find("encoding", 5);
+    if (encoding_pos == std::string::npos || encoding_pos > declaration_end) {
+        return true;
+    }
+    size_t value_pos = encoding_pos + 8;
+    while (value_pos < xml_buffer.size() && std::strchr(" \t\r\n=", xml_buffer[value_pos])) {
+        ++value_pos;
+    }
+    if (value_pos >= xml_buffer.size() ||
+        (xml_buffer[value_pos] != '"' && xml_buffer[value_pos] != '\'')) {
+        return true;
+    }
+    const size_t value_end = xml_buffer.find(xml_buffer[value_pos], value_pos + 1);
+    if (value_end == std::string::npos) {
+        return true;
+    }
+    std::string encoding = xml_buffer.substr(value_pos + 1, value_end - value_pos - 1);
+    for (auto& character: encoding) {
+        if (character >= 'A' && character <= 'Z') {
+            character = static_cast<char>(character - 'A' + 'a');
+        }
+    }
+    if (encoding != "iso-8859-1" && encoding != "latin1") {
+        return true;
+    }
+    size_t non_ascii_count = 0;
+    for (const char character: xml_buffer) {
+        if (static_cast<unsigned char>(character) >= 0x80) {
+            ++non_ascii_count;
+        }
+    }
+    if (non_ascii_count == 0) {
+        return true;
+    }
+    std::string utf8_buffer;
+    utf8_buffer.reserve(xml_buffer.size() + non_ascii_count);
+    for (const char character: xml_buffer) {
+        const auto code_point = static_cast<unsigned char>(character);
+        if (code_point < 0x80) {
+            utf8_buffer.push_back(character);
+        }
+        else {
+            utf8_buffer.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+            utf8_buffer.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+    }
+    xml_buffer.swap(utf8_buffer);
+    return true;
+}
+
+bool readXML(std::string& xml_buffer,
+             const Version& ddl_language_version,
+             bool strict,
+             DataDefinition& dd,
+             std::string& xml_error)
+{
+    DDFromXMLStreamReader reader(ddl_language_version, strict, false);
+    if (!readXML(xml_buffer, reader, xml_error)) {
+        return false;
+    }
+    dd = std::move(reader.getDataDefinition());
+    return true;
+}
+
+bool readXML(std::string& xml_buffer,
+             const Version& ddl_language_version,
+             bool strict,
+             DataDefinition& dd,
+             std::vector<Problem>& problem_list,
+             std::string& xml_error)
+{
+    DDFromXMLStreamReader reader(ddl_language_version, strict, true);
+    if (!readXML(xml_buffer, reader, xml_error)) {
+        return false;
+    }
+    if (reader.hasProblems()) {
+        problem_list.insert(
+            problem_list.end(), reader.getProblems().begin(), reader.getProblems().end());
+        return false;
+    }
+    dd = std::move(reader.getDataDefinition());
+    return true;
+}
+
+} // namespace detail
+} // namespace datamodel
+} // namespace dd
+} // namespace ddl
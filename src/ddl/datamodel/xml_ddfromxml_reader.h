@@ -0,0 +1,97 @@
+/**
+ * @file
+ * OO DataDefinition Redesign
+ *
+ * Copyright @ 2021 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef DD_DD_FROM_XML_READER_H_INCLUDED
+#define DD_DD_FROM_XML_READER_H_INCLUDED
+
+#include <ddl/datamodel/datamodel_datadefinition.h>
+#include <ddl/dd/dd_error.h>
+
+#include <string>
+#include <vector>
+
+namespace ddl {
+namespace dd {
+namespace datamodel {
+namespace detail {
+
+/**
+ * @brief Reads the content of a file into \p xml_buffer (binary, unchanged).
+ *
+ * @param xml_filepath the file to read
+ * @param xml_buffer the buffer to read the content to
+ * @param xml_error the error description if the file can not be read
+ * @retval true the file was read
+ * @retval false the file was not found or could not be read, see \p xml_error
+ */
+bool readXMLFile(const std::string& xml_filepath, std::string& xml_buffer, std::string& xml_error);
+
+/**
+ * @brief Prepares the content of a XML file for @ref readXML.
+ * A declared ISO-8859-1 (latin1) encoding is converted to UTF-8 (like the DOM will do while
+ * loading a file).
+ *
+ * @param xml_buffer the file content to convert in place
+ * @retval true the buffer is UTF-8 encoded now
+ * @retval false the buffer is UTF-16 or UTF-32 encoded, this is only supported by the DOM
+ */
+bool convertXMLFileToUTF8(std::string& xml_buffer);
+
+/**
+ * @brief Reads the DD datamodel in one pass from a XML buffer without creating a DOM.
+ * The XML is tokenized in place, only the subtree of the currently read item (i.e. one struct)
+ * is kept in a compact form to create the datamodel item with @ref DDFromXMLFactory. The rules
+ * which items are read (and for which DDL version) are the same as in
+ * @ref DDFromXMLFactory::createDD.
+ *
+ * @param xml_buffer the UTF-8 encoded XML, it will be modified while reading
+ * @param ddl_language_version the language version to use if no header is in the defintion
+ * @param strict set to true to load the datamodel exactly like defined
+ * @param dd the created datamodel
+ * @param xml_error the error description if the XML is not well formed
+ * @retval true the datamodel was read
+ * @retval false the XML is not well formed, see \p xml_error
+ * @throws dd::Error if the first item of the datamodel can not be created.
+ */
+bool readXML(std::string& xml_buffer,
+             const Version& ddl_language_version,
+             bool strict,
+             DataDefinition& dd,
+             std::string& xml_error);
+
+/**
+ * @brief Reads the DD datamodel in one pass from a XML buffer without creating a DOM.
+ * Like @ref readXML, but all items are read and the problems are collected into
+ * \p problem_list (like ddl::DDString::fromXMLString and ddl::DDFile::fromXMLFile do).
+ *
+ * @param xml_buffer the UTF-8 encoded XML, it will be modified while reading
+ * @param ddl_language_version the language version to use if no header is in the defintion
+ * @param strict set to true to load the datamodel exactly like defined
+ * @param dd the created datamodel, only set if no problems occured
+ * @param problem_list the problems while creating the items of the datamodel
+ * @param xml_error the error description if the XML is not well formed
+ * @retval true the datamodel was read
+ * @retval false the XML is not well formed (see \p xml_error) or the datamodel was not read
+ *               without problems (see \p problem_list)
+ */
+bool readXML(std::string& xml_buffer,
+             const Version& ddl_language_version,
+             bool strict,
+             DataDefinition& dd,
+             std::vector<Problem>& problem_list,
+             std::string& xml_error);
+
+} // namespace detail
+} // namespace datamodel
+} // namespace dd
+} // namespace ddl
+
+#endif // DD_DD_FROM_XML_READER_H_INCLUDED
@@ -0,0 +1,297 @@
+/**
+ * @file
+ * OO DataDefinition Redesign
+ *
+ * Copyright @ 2021 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "xml_ddtoxml_writer.h"
+
+#include <ddl/datamodel/xml_ddtoxml_factory.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace ddl {
+namespace dd {
+namespace datamodel {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Output of the XML writer.
+ * Collects the XML in a string and passes it to the stream (if any) in chunks.
+ */
+class XMLOutput {
+public:
+    XMLOutput(std::string& buffer, std::ostream* stream) : _buffer(buffer), _stream(stream)
+    {
+        if (_stream) {
+            _buffer.reserve(flush_threshold);
+        }
+    }
+
+    ~XMLOutput()
+    {
+        flush();
+    }
+
+    void write(const char* data, size_t size)
+    {
+        _buffer.append(data, size);
+        if (_stream && _buffer.size() >= flush_threshold) {
+            flush();
+        }
+    }
+
+    void write(const char* data)
+    {
+        write(data, std::strlen(data));
+    }
+
+    void write(char character)
+    {
+        _buffer.push_back(character);
+    }
+
+    void flush()
+    {
+        if (_stream && !_buffer.empty()) {
+            _stream->write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+            _buffer.clear();
+        }
+    }
+
+private:
+    static constexpr size_t flush_threshold = 64 * 1024;
+    std::string& _buffer;
+    std::ostream* _stream;
+};
+
+class XMLStreamWriter;
+
+/**
+ * @brief Node of the one pass XML writer, follows the concept of the DOM_NODE_TYPE of
+ * @ref DDToXMLFactory.
+ * A node only refers to its position within the document, the XML is written while the nodes are
+ * created. The start tag is completed with the creation of the first child or the data.
+ */
+class XMLStreamNode {
+public:
+    XMLStreamNode() = default;
+    XMLStreamNode(XMLStreamWriter& writer, size_t depth) : _writer(&writer), _depth(depth)
+    {
+    }
+
+    void setAttribute(const std::string& name, const std::string& value);
+    XMLStreamNode createChild(const std::string& name);
+    void setData(const std::string& data);
+
+private:
+    XMLStreamWriter* _writer = nullptr;
+    size_t _depth = 0;
+};
+
+/**
+ * @brief One pass XML writer for the DD datamodel.
+ * The nodes are created with @ref DDToXMLFactory like the nodes of the DOM. The formatting and
+ * escaping follows the DOM serialization of a_util::xml::DOM (pugixml with 4 spaces indentation),
+ * so the output is byte-identical to the serialized DOM.
+ */
+class XMLStreamWriter {
+public:
+    explicit XMLStreamWriter(XMLOutput& output) : _output(output)
+    {
+    }
+
+    void writeDocument(const DataDefinition& dd)
+    {
+        // the DOM will always write this declaration (the declaration of the template
+        // "<?xml version="1.0" encoding="iso-8859-1" standalone="no"?>" is not parsed)
+        _output.write("<?xml version=\"1.0\"?>\n");
+        XMLStreamNode root = createChild(0, "ddl:ddl");
+        root.setAttribute("xmlns:ddl", "ddl");
+        DDToXMLFactory<XMLStreamNode>::createNode(root, dd);
+        closeElements(0);
+        _output.write('\n');
+    }
+
+    XMLStreamNode createChild(size_t depth, const std::string& name)
+    {
+        // the previous siblings and their children are complete
+        closeElements(depth);
+        if (_start_tag_open) {
+            _output.write('>');
+        }
+        if (!_open_elements.empty()) {
+            _output.write('\n');
+            writeIndentation(_open_elements.size());
+        }
+        _output.write('<');
+        _output.write(name.data(), name.size());
+        _open_elements.push_back(name);
+        _start_tag_open = true;
+        _has_data = false;
+        return XMLStreamNode(*this, depth + 1);
+    }
+
+    void setAttribute(size_t depth, const std::string& name, const std::string& value)
+    {
+        if (depth != _open_elements.size() || !_start_tag_open) {
+            throw std::logic_error("the attribute '" + name +
+                                   "' is set after the start tag was written");
+        }
+        _output.write(' ');
+        _output.write(name.data(), name.size());
+        _output.write("=\"", 2);
+        writeEscaped(value, true);
+        _output.write('"');
+    }
+
+    void setData(size_t depth, const std::string& data)
+    {
+        if (depth != _open_elements.size() || !_start_tag_open) {
+            throw std::logic_error("the data of '" + _open_elements.back() +
+                                   "' is set after the start tag was written");
+        }
+        _output.write('>');
+        _start_tag_open = false;
+        writeEscaped(data, false);
+        _has_data = true;
+    }
+
+private:
+    void closeElements(size_t depth)
+    {
+        while (_open_elements.size() > depth) {
+            const std::string& name = _open_elements.back();
+            if (_start_tag_open) {
+                _output.write(" />", 3);
+                _start_tag_open = false;
+            }
+            else {
+                if (!_has_data) {
+                    _output.write('\n');
+                    writeIndentation(_open_elements.size() - 1);
+                }
+                _output.write("</", 2);
+                _output.write(name.data(), name.size());
+                _output.write('>');
+            }
+            _has_data = false;
+            _open_elements.pop_back();
+        }
+    }
+
+    void writeIndentation(size_t depth)
+    {
+        // XML line indendation used in a_util::xml::DOM::toString/save
+        static const char indentation[] = "                                ";
+        static constexpr size_t indentation_size = sizeof(indentation) - 1;
+        size_t remaining = depth * 4;
+        while (remaining > indentation_size) {
+            _output.write(indentation, indentation_size);
+            remaining -= indentation_size;
+        }
+        _output.write(indentation, remaining);
+    }
+
+    /**
+     * Escapes the same characters as the DOM does (pugixml):
+     * \li data: & < > and all control characters except \\t, \\r and \\n
+     * \li attributes: & < > " and all control characters except \\t
+     * The value ends at the first 0 character (like the c string the DOM stores).
+     */
+    void writeEscaped(const std::string& value, bool is_attribute)
+    {
+        const char* current = value.c_str();
+        const char* unescaped_begin = current;
+        for (;; ++current) {
+            const auto character = static_cast<unsigned char>(*current);
+            if (character >= 32 && character != '&' && character != '<' && character != '>' &&
+                character != '"') {
+                continue;
+            }
+            if (character == '"' && !is_attribute) {
+                continue;
+            }
+            if (character == '\t' ||
+                (!is_attribute && (character == '\r' || character == '\n'))) {
+                continue;
+            }
+            _output.write(unescaped_begin, static_cast<size_t>(current - unescaped_begin));
+            unescaped_begin = current + 1;
+            switch (character) {
+            case 0:
+                return;
+            case '&':
+                _output.write("&amp;", 5);
+                break;
+            case '<':
+                _output.write("&lt;", 4);
+                break;
+            case '>':
+                _output.write("&gt;", 4);
+                break;
+            case '"':
+                _output.write("&quot;", 6);
+                break;
+            default: {
+                const char escaped[] = {'&',
+                                        '#',
+                                        static_cast<char>('0' + character / 10),
+                                        static_cast<char>('0' + character % 10),
+                                        ';'};
+                _output.write(escaped, sizeof(escaped));
+            }
+            }
+        }
+    }
+
+    XMLOutput& _output;
+    /// the names of the elements from the root to the current element
+    std::vector<std::string> _open_elements;
+    bool _start_tag_open = false;
+    bool _has_data = false;
+};
+
+void XMLStreamNode::setAttribute(const std::string& name, const std::string& value)
+{
+    _writer->setAttribute(_depth, name, value);
+}
+
+XMLStreamNode XMLStreamNode::createChild(const std::string& name)
+{
+    return _writer->createChild(_depth, name);
+}
+
+void XMLStreamNode::setData(const std::string& data)
+{
+    _writer->setData(_depth, data);
+}
+
+} // namespace
+
+void writeXML(const DataDefinition& dd, std::string& xml_buffer)
+{
+    XMLOutput output(xml_buffer, nullptr);
+    XMLStreamWriter(output).writeDocument(dd);
+}
+
+void writeXML(const DataDefinition& dd, std::ostream& xml_stream)
+{
+    std::string xml_buffer;
+    XMLOutput output(xml_buffer, &xml_stream);
+    XMLStreamWriter(output).writeDocument(dd);
+}
+
+} // namespace detail
+} // namespace datamodel
+} // namespace dd
+} // namespace ddl
@@ -0,0 +1,49 @@
+/**
+ * @file
+ * OO DataDefinition Redesign
+ *
+ * Copyright @ 2021 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef DD_DD_TO_XML_WRITER_H_INCLUDED
+#define DD_DD_TO_XML_WRITER_H_INCLUDED
+
+#include <ddl/datamodel/datamodel_datadefinition.h>
+
+#include <ostream>
+#include <string>
+
+namespace ddl {
+namespace dd {
+namespace datamodel {
+namespace detail {
+
+/**
+ * @brief Writes the XML of the DD datamodel in one pass into the given string (appending).
+ * The nodes are created with @ref DDToXMLFactory and written immediately, the output is the same
+ * as serializing the a_util::xml::DOM created by it, but no DOM is built up.
+ *
+ * @param dd the Data Defintion to write
+ * @param xml_buffer the string to append the xml to
+ */
+void writeXML(const DataDefinition& dd, std::string& xml_buffer);
+
+/**
+ * @brief Writes the XML of the DD datamodel in one pass into the given stream.
+ * The XML is written in chunks, so the whole XML is never kept in memory.
+ *
+ * @param dd the Data Defintion to write
+ * @param xml_stream the stream to write the xml to
+ */
+void writeXML(const DataDefinition& dd, std::ostream& xml_stream);
+
+} // namespace detail
+} // namespace datamodel
+} // namespace dd
+} // namespace ddl
+
+#endif // DD_DD_TO_XML_WRITER_H_INCLUDED
@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../utilities/dd_arena.h"
+
 #include <ddl/dd/dd.h>
 #include <ddl/dd/dd_predefined_datatypes.h>
 #include <ddl/dd/dd_typeinfomodel.h>
@@ -26,7 +28,7 @@ DataDefinition::DataDefinition() : DataDefinition(Version::getLatestVersion())
 
 DataDefinition::DataDefinition(Version ddl_version)
 {
-    setModel(std::make_shared<datamodel::DataDefinition>(ddl_version));
+    setModel(utility::makeShared<datamodel::DataDefinition>(ddl_version));
 }
 
 DataDefinition::DataDefinition(const std::shared_ptr<datamodel::DataDefinition>& datamodel)
@@ -36,7 +38,7 @@ DataDefinition::DataDefinition(const std::shared_ptr<datamodel::DataDefinition>&
 
 DataDefinition::DataDefinition(const DataDefinition& other)
 {
-    setModel(std::make_shared<datamodel::DataDefinition>(*other.getModel()));
+    setModel(utility::makeShared<datamodel::DataDefinition>(*other.getModel()));
     _last_known_ddl_version = other._last_known_ddl_version;
 }
 
@@ -50,7 +52,7 @@ DataDefinition::DataDefinition(DataDefinition&& other)
 
 DataDefinition& DataDefinition::operator=(const DataDefinition& other)
 {
-    setModel(std::make_shared<datamodel::DataDefinition>(*other.getModel()));
+    setModel(utility::makeShared<datamodel::DataDefinition>(*other.getModel()));
     _last_known_ddl_version = other._last_known_ddl_version;
     return *this;
 }
@@ -79,7 +81,8 @@ void DataDefinition::setModel(const std::shared_ptr<datamodel::DataDefinition>&
         if (info == nullptr) {
             // we need to create our validation service
             // the validation service is for loose coupling for renaming and validation info
-            _datamodel->setInfo<ValidationServiceInfo>(std::make_shared<ValidationServiceInfo>());
+            _datamodel->setInfo<ValidationServiceInfo>(
+                utility::makeShared<ValidationServiceInfo>());
         }
         _last_known_ddl_version = _datamodel->getVersion();
         validate();
@@ -321,7 +324,7 @@ void getOrCreateValidationLevelFor(std::shared_ptr<T>& type_val,
     auto info = type_val->template getInfo<ValidationInfo>();
     if (info == nullptr) {
         // for recursion detection we need to create it first, then update!
-        type_val->template setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+        type_val->template setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>());
         info = type_val->template getInfo<ValidationInfo>();
         info->update(*type_val, parent_ddl);
     }
@@ -398,7 +401,7 @@ void DataDefinition::calculatePositions(const std::string& type_name,
                 auto type_info = ref_types.second->getInfo<TypeInfo>();
                 if (type_info == nullptr) {
                     // we need that order because of possible recursions!
-                    ref_types.second->setInfo(std::make_shared<TypeInfo>());
+                    ref_types.second->setInfo(utility::makeShared<TypeInfo>());
                     type_info = ref_types.second->getInfo<TypeInfo>();
                     type_info->update(*(ref_types.second), *_datamodel);
                 }
@@ -415,7 +418,7 @@ void DataDefinition::calculatePositions(const std::string& type_name,
                 auto type_info = ref_types.second->getInfo<TypeInfo>();
                 if (type_info == nullptr) {
                     // we need that order because of possible recursions!
-                    ref_types.second->setInfo(std::make_shared<TypeInfo>());
+                    ref_types.second->setInfo(utility::makeShared<TypeInfo>());
                     type_info = ref_types.second->getInfo<TypeInfo>();
                     type_info->update(*(ref_types.second), *_datamodel);
                 }
@@ -432,7 +435,7 @@ void DataDefinition::calculatePositions(const std::string& type_name,
                 auto type_info = ref_types.second->getInfo<TypeInfo>();
                 if (type_info == nullptr) {
                     // we need that order because of possible recursions!
-                    ref_types.second->setInfo(std::make_shared<TypeInfo>());
+                    ref_types.second->setInfo(utility::makeShared<TypeInfo>());
                     type_info = ref_types.second->getInfo<TypeInfo>();
                     type_info->update(
                         *(ref_types.second), *_datamodel, TypeInfo::UpdateType::force_all);
@@ -453,7 +456,7 @@ void DataDefinition::calculatePositions(const std::string& type_name,
             auto type_info = struct_type->getInfo<TypeInfo>();
             if (type_info == nullptr) {
                 // we need that order because of possible recursion!
-                struct_type->setInfo(std::make_shared<TypeInfo>());
+                struct_type->setInfo(utility::makeShared<TypeInfo>());
                 type_info = struct_type->getInfo<TypeInfo>();
                 type_info->update(*(struct_type), *_datamodel, TypeInfo::UpdateType::force_all);
             }
@@ -468,7 +471,7 @@ void DataDefinition::calculatePositions(const std::string& type_name,
             auto type_info = enum_type->getInfo<TypeInfo>();
             if (type_info == nullptr) {
                 // we need that order because of possible recursion!
-                enum_type->setInfo(std::make_shared<TypeInfo>());
+                enum_type->setInfo(utility::makeShared<TypeInfo>());
                 type_info = enum_type->getInfo<TypeInfo>();
                 type_info->update(*(enum_type), *_datamodel);
             }
@@ -541,7 +544,7 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
 {
     if (event_code == datamodel::ModelEventCode::item_added) {
         changed_subject.setInfo<ValidationInfo>(
-            std::make_shared<ValidationInfo>(changed_subject, *_datamodel));
+            utility::makeShared<ValidationInfo>(changed_subject, *_datamodel));
     }
     else if (event_code == datamodel::ModelEventCode::subitem_added ||
              event_code == datamodel::ModelEventCode::subitem_removed) {
@@ -603,6 +606,45 @@ void updateInfoAllEnums(const std::vector<std::string>& enum_names,
         }
     }
 }
+
+void updateInfoAllStreams(const std::vector<std::string>& stream_names,
+                          datamodel::DataDefinition& parent_dd)
+{
+    for (const auto& current_stream_name: stream_names) {
+        auto stream = parent_dd.getStreams().access(current_stream_name);
+        if (stream) {
+            auto stream_info = stream->getInfo<ValidationInfo>();
+            if (stream_info) {
+                stream_info->update(*stream, parent_dd);
+            }
+        }
+    }
+}
+
+void updateInfoAllDependencies(const ValidationServiceInfo::InvalidatedTypes& dependencies,
+                               bool with_type_info,
+                               datamodel::DataDefinition& parent_dd)
+{
+    // enum types first, the struct types may use their type info
+    updateInfoAllEnums(dependencies._enum_type_names, parent_dd);
+    updateInfoAllStructs(dependencies._struct_type_names, with_type_info, parent_dd);
+    updateInfoAllStreams(dependencies._stream_names, parent_dd);
+}
+
+void updateInfoAllDependentsOf(const datamodel::StructType& struct_type,
+                               datamodel::DataDefinition& parent_dd)
+{
+    auto valid_info_service = parent_dd.getInfo<ValidationServiceInfo>();
+    // switch off if this change comes from the Validation service while renaming
+    // the validation service will take care of this by itself
+    if (valid_info_service->validationNeeded()) {
+        // only the dependency cone is visited, this is cheap if nobody uses the struct type
+        ValidationServiceInfo::InvalidatedTypes dependencies;
+        valid_info_service->forceRevalidationOfTypeDependencies(
+            struct_type.getName(), struct_type.getTypeOfType(), parent_dd, dependencies);
+        updateInfoAllDependencies(dependencies, true, parent_dd);
+    }
+}
 } // namespace
 
 void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
@@ -614,10 +656,10 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
         auto existing_type_info = changed_subject.getInfo<TypeInfo>();
         if (!existing_type_info) {
             changed_subject.setInfo<TypeInfo>(
-                std::make_shared<TypeInfo>(changed_subject, *_datamodel));
+                utility::makeShared<TypeInfo>(changed_subject, *_datamodel));
         }
         changed_subject.setInfo<ValidationInfo>(
-            std::make_shared<ValidationInfo>(changed_subject, *_datamodel));
+            utility::makeShared<ValidationInfo>(changed_subject, *_datamodel));
         _datamodel->getInfo<ValidationServiceInfo>()->renamed(
             changed_subject, changed_subject.getName(), *_datamodel);
     }
@@ -645,8 +687,7 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
                     changed_subject.getTypeOfType(),
                     *_datamodel,
                     dependencies);
-                updateInfoAllStructs(dependencies._struct_type_names, true, *_datamodel);
-                updateInfoAllEnums(dependencies._enum_type_names, *_datamodel);
+                updateInfoAllDependencies(dependencies, true, *_datamodel);
             }
         }
     }
@@ -669,10 +710,10 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
         auto existing_type_info = changed_subject.getInfo<TypeInfo>();
         if (!existing_type_info) {
             changed_subject.setInfo<TypeInfo>(
-                std::make_shared<TypeInfo>(changed_subject, *_datamodel));
+                utility::makeShared<TypeInfo>(changed_subject, *_datamodel));
         }
         changed_subject.setInfo<ValidationInfo>(
-            std::make_shared<ValidationInfo>(changed_subject, *_datamodel));
+            utility::makeShared<ValidationInfo>(changed_subject, *_datamodel));
         _datamodel->getInfo<ValidationServiceInfo>()->renamed(
             changed_subject, changed_subject.getName(), *_datamodel);
     }
@@ -694,10 +735,10 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
                 auto info = changed_subject.getInfo<ValidationInfo>();
                 info->forceRevalidation();
                 info->update(changed_subject, *_datamodel);
-                updateInfoAllStructs(dependencies._struct_type_names, true, *_datamodel);
                 if (info->isValid(ValidationInfo::ValidationLevel::good_enough)) {
                     changed_subject.getInfo<TypeInfo>()->update(changed_subject, *_datamodel);
                 }
+                updateInfoAllDependencies(dependencies, true, *_datamodel);
             }
         }
     }
@@ -720,14 +761,14 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
     case datamodel::ModelEventCode::item_added: {
         // struct may have recursion, thats why we have no CTOR on that, first we set it, then we
         // update it
-        changed_subject.setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+        changed_subject.setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>());
         changed_subject.getInfo<ValidationInfo>()->update(changed_subject, *_datamodel);
         // struct may have recursion, thats why we have no CTOR on that, first we set it, then we
         // update it
         // check if a valid typeinfo was copied
         auto existing_type_info = changed_subject.getInfo<TypeInfo>();
         if (!existing_type_info) {
-            changed_subject.setInfo<TypeInfo>(std::make_shared<TypeInfo>());
+            changed_subject.setInfo<TypeInfo>(utility::makeShared<TypeInfo>());
             changed_subject.getInfo<TypeInfo>()->update(changed_subject, *_datamodel);
         }
         else {
@@ -766,7 +807,7 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
                 changed_subject.getInfo<TypeInfo>()->update(
                     changed_subject, *_datamodel, TypeInfo::UpdateType::force_all);
             }
-            updateInfoAllStructs(dependencies._struct_type_names, update_type_info, *_datamodel);
+            updateInfoAllDependencies(dependencies, update_type_info, *_datamodel);
         }
 
     } break;
@@ -788,7 +829,7 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
             info->update(changed_subject, *_datamodel);
             changed_subject.getInfo<TypeInfo>()->update(
                 changed_subject, *_datamodel, TypeInfo::UpdateType::force_all);
-            updateInfoAllStructs(dependencies._struct_type_names, true, *_datamodel);
+            updateInfoAllDependencies(dependencies, true, *_datamodel);
         }
     } break;
     case datamodel::ModelEventCode::subitem_removed:
@@ -805,6 +846,8 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
                 valid_info->forceRevalidation();
                 valid_info->update(changed_subject, *_datamodel);
             }
+            // the size of the struct changed, so all users must recalculate their positions
+            updateInfoAllDependentsOf(changed_subject, *_datamodel);
         }
         break;
     case datamodel::ModelEventCode::item_renamed:
@@ -829,6 +872,8 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
             valid_info->update(changed_subject, *_datamodel, valid_update_type);
             changed_subject.getInfo<TypeInfo>()->update(
                 changed_subject, *_datamodel, type_update_type);
+            // the size of the struct changed, so all users must recalculate their positions
+            updateInfoAllDependentsOf(changed_subject, *_datamodel);
         }
         break;
     case datamodel::ModelEventCode::subitem_renamed:
@@ -841,7 +886,7 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
                                   const std::string& additional_info)
 {
     if (event_code == datamodel::ModelEventCode::item_added) {
-        changed_subject.setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+        changed_subject.setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>());
         changed_subject.getInfo<ValidationInfo>()->update(changed_subject, *_datamodel);
         _datamodel->getInfo<ValidationServiceInfo>()->renamed(
             changed_subject, changed_subject.getName(), *_datamodel);
@@ -877,7 +922,7 @@ void DataDefinition::modelChanged(datamodel::ModelEventCode event_code,
 {
     if (event_code == datamodel::ModelEventCode::item_added) {
         changed_subject.setInfo<ValidationInfo>(
-            std::make_shared<ValidationInfo>(changed_subject, *_datamodel));
+            utility::makeShared<ValidationInfo>(changed_subject, *_datamodel));
     }
     else if (event_code == datamodel::ModelEventCode::item_changed) {
         // validation and typeinfo depends only on the data_type_name, nothing more!
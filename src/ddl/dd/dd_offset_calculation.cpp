@@ -9,6 +9,7 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../utilities/dd_arena.h"
 #include "dd_offset_calculation.h"
 
 #include <ddl/dd/dd_typeinfomodel.h>
@@ -85,7 +86,7 @@ const TypeInfo* getOrCreateTypeInfo(const datamodel::StructType::Element& curren
         auto info = elem_type_return._data_type->getInfo<TypeInfo>();
         if (info == nullptr) {
             elem_type_return._data_type->setInfo<TypeInfo>(
-                std::make_shared<TypeInfo>(*elem_type_return._data_type, ddl));
+                utility::makeShared<TypeInfo>(*elem_type_return._data_type, ddl));
             info = elem_type_return._data_type->getInfo<TypeInfo>();
         }
         return info;
@@ -95,7 +96,7 @@ const TypeInfo* getOrCreateTypeInfo(const datamodel::StructType::Element& curren
         auto info = elem_type_return._enum_type->getInfo<TypeInfo>();
         if (info == nullptr) {
             elem_type_return._enum_type->setInfo<TypeInfo>(
-                std::make_shared<TypeInfo>(*elem_type_return._enum_type, ddl));
+                utility::makeShared<TypeInfo>(*elem_type_return._enum_type, ddl));
             info = elem_type_return._enum_type->getInfo<TypeInfo>();
         }
         // we set also the data type here!
@@ -108,7 +109,7 @@ const TypeInfo* getOrCreateTypeInfo(const datamodel::StructType::Element& curren
         auto info = elem_type_return._struct_type->getInfo<TypeInfo>();
         if (info == nullptr) {
             // we need that order because of possible recursions
-            elem_type_return._struct_type->setInfo<TypeInfo>(std::make_shared<TypeInfo>());
+            elem_type_return._struct_type->setInfo<TypeInfo>(utility::makeShared<TypeInfo>());
             info = elem_type_return._struct_type->getInfo<TypeInfo>();
             info->update(*elem_type_return._struct_type, ddl);
         }
@@ -14,6 +14,7 @@
 #include <ddl/dd/dd_predefined_datatypes.h>
 #include <ddl/dd/dd_typeinfomodel.h>
 
+#include <atomic>
 #include <iterator>
 
 namespace ddl {
@@ -146,6 +147,8 @@ void TypeInfo::update(datamodel::StructType& struct_type,
                       datamodel::DataDefinition& parent_dd,
                       UpdateType update_type)
 {
+    // every update may change the layout
+    std::atomic_store(&_binary_layout, {});
     if (_already_discovering) {
         _is_valid = false;
         throw Error("TypeInfo::update", {struct_type.getName()}, "Recursive use of this type!");
@@ -256,6 +259,23 @@ void TypeInfo::update(datamodel::StructType& struct_type,
     _already_discovering = false;
 }
 
+std::shared_ptr<const BinaryLayout> TypeInfo::getBinaryLayout(const Version& ddl_version) const
+{
+    const auto cached_layout = std::atomic_load(&_binary_layout);
+    if (cached_layout && cached_layout->first == ddl_version) {
+        // shares the ownership of the cache entry
+        return std::shared_ptr<const BinaryLayout>(cached_layout, &cached_layout->second);
+    }
+    return {};
+}
+
+void TypeInfo::setBinaryLayout(const Version& ddl_version, BinaryLayout layout) const
+{
+    std::atomic_store(&_binary_layout,
+                      std::shared_ptr<const VersionedBinaryLayout>(
+                          std::make_shared<VersionedBinaryLayout>(ddl_version, std::move(layout))));
+}
+
 /**
  * Element Size Info is inportant to get the TypeInfo for Structs
  */
@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../utilities/dd_arena.h"
+
 #include <ddl/dd/dd_predefined_datatypes.h>
 #include <ddl/dd/dd_predefined_units.h>
 #include <ddl/dd/dd_validationinfomodel.h>
@@ -85,8 +87,10 @@ void renameInMapFrom(const std::string& from_old,
     if (from_old != from_new) {
         for (auto& current_to: the_map) {
             auto& from_set = current_to.second;
-            from_set.erase(from_old);
-            from_set.insert(from_new);
+            // only the items that really depended on the old name depend on the new name
+            if (from_set.erase(from_old) > 0) {
+                from_set.insert(from_new);
+            }
         }
     }
 }
@@ -902,7 +906,7 @@ void ValidationInfo::update(datamodel::DataType& data_type, datamodel::DataDefin
                 auto validation_info = found_unit->getInfo<ValidationInfo>();
                 if (validation_info == nullptr) {
                     found_unit->setInfo<ValidationInfo>(
-                        std::make_shared<ValidationInfo>(*found_unit, parent_dd));
+                        utility::makeShared<ValidationInfo>(*found_unit, parent_dd));
                     validation_info = found_unit->getInfo<ValidationInfo>();
                 }
                 if (validation_info->getValidationLevel() < ValidationLevel::valid) {
@@ -1048,7 +1052,7 @@ const ValidationInfo* getOrCreateValidationInfo(const std::string& type_name,
             }
             auto info = dt->getInfo<ValidationInfo>();
             if (info == nullptr) {
-                dt->setInfo<ValidationInfo>(std::make_shared<ValidationInfo>(*dt, ddl));
+                dt->setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>(*dt, ddl));
                 info = dt->getInfo<ValidationInfo>();
             }
             else {
@@ -1062,7 +1066,7 @@ const ValidationInfo* getOrCreateValidationInfo(const std::string& type_name,
             auto et = ddl.getEnumTypes().access(type_name);
             auto info = et->getInfo<ValidationInfo>();
             if (info == nullptr) {
-                et->setInfo<ValidationInfo>(std::make_shared<ValidationInfo>(*et, ddl));
+                et->setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>(*et, ddl));
                 info = et->getInfo<ValidationInfo>();
             }
             else {
@@ -1077,7 +1081,7 @@ const ValidationInfo* getOrCreateValidationInfo(const std::string& type_name,
         auto st = ddl.getStructTypes().access(type_name);
         auto info = st->getInfo<ValidationInfo>();
         if (info == nullptr) {
-            st->setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+            st->setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>());
             info = st->getInfo<ValidationInfo>();
             info->update(*st, ddl);
         }
@@ -1092,7 +1096,7 @@ const ValidationInfo* getOrCreateValidationInfo(const std::string& type_name,
         auto smt = ddl.getStreamMetaTypes().access(type_name);
         auto info = smt->getInfo<ValidationInfo>();
         if (info == nullptr) {
-            smt->setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+            smt->setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>());
             info = smt->getInfo<ValidationInfo>();
             info->update(*smt, ddl);
         }
@@ -1175,7 +1179,7 @@ void updateValidationForElement(datamodel::StructType& parent_struct_type,
             auto unit_validation_info = found_unit->getInfo<ValidationInfo>();
             if (unit_validation_info == nullptr) {
                 found_unit->setInfo<ValidationInfo>(
-                    std::make_shared<ValidationInfo>(*found_unit, parent_dd));
+                    utility::makeShared<ValidationInfo>(*found_unit, parent_dd));
                 unit_validation_info = found_unit->getInfo<ValidationInfo>();
             }
             auto found_level = unit_validation_info->getValidationLevel();
@@ -1333,7 +1337,8 @@ void ValidationInfo::update(datamodel::StreamMetaType& stream_meta_type,
                 auto info = parent_meta_type->getInfo<ValidationInfo>();
                 if (info == nullptr) {
                     // do it like this because of recursion detection!
-                    parent_meta_type->setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+                    parent_meta_type->setInfo<ValidationInfo>(
+                        utility::makeShared<ValidationInfo>());
                     info = parent_meta_type->getInfo<ValidationInfo>();
                     info->update(*parent_meta_type, parent_dd);
                 }
@@ -1385,7 +1390,7 @@ void updateValidationForStreamStruct(datamodel::Stream& stream,
         }
         else {
             // do it in this order because of recursion detection
-            struct_type->setInfo<ValidationInfo>(std::make_shared<ValidationInfo>());
+            struct_type->setInfo<ValidationInfo>(utility::makeShared<ValidationInfo>());
             validation_info_stream_struct = struct_type->getInfo<ValidationInfo>();
             validation_info_stream_struct->update(*struct_type, parent_dd);
         }
@@ -1482,79 +1487,157 @@ const std::unordered_set<std::string>* findInMapTo(const std::string& find_to_ty
 }
 } // namespace
 
-void ValidationServiceInfo::forceRevalidationOfTypeDependencies(
+namespace {
+const std::unordered_set<std::string>* findDependentsOf(
     const std::string& type_name,
-    ddl::dd::TypeOfType type,
-    datamodel::DataDefinition& parent_dd,
-    ValidationServiceInfo::InvalidatedTypes& invalidated_types_to_return) const
+    ValidationServiceInfo::DependencyType type_of_dependency,
+    const std::unordered_map<uint8_t, ValidationServiceInfo::ToFromMap>& dependencies)
 {
-    const std::unordered_set<std::string>* invalidated_structs = nullptr;
-    const std::unordered_set<std::string>* invalidated_enums = nullptr;
-    if (type == struct_type) {
-        const auto& to_struct_type_map = _dependencies.find(struct_type_to_struct_type);
-        if (to_struct_type_map != _dependencies.end()) {
-            invalidated_structs = findInMapTo(type_name, to_struct_type_map->second);
-        }
-    }
-    else if (type == enum_type) {
-        const auto& to_struct_type_map = _dependencies.find(struct_type_to_enum_type);
-        if (to_struct_type_map != _dependencies.end()) {
-            invalidated_structs = findInMapTo(type_name, to_struct_type_map->second);
-        }
-    }
-    else if (type == data_type) {
-        const auto& to_struct_type_map = _dependencies.find(struct_type_to_data_type);
-        if (to_struct_type_map != _dependencies.end()) {
-            invalidated_structs = findInMapTo(type_name, to_struct_type_map->second);
-        }
-        const auto& to_enum_type_map = _dependencies.find(enum_type_to_data_type);
-        if (to_enum_type_map != _dependencies.end()) {
-            invalidated_enums = findInMapTo(type_name, to_enum_type_map->second);
-        }
-    }
-
-    if (invalidated_structs != nullptr) {
-        // set force invalid to the structs
-        for (const auto& current: *invalidated_structs) {
-            auto struct_type = parent_dd.getStructTypes().access(current);
-            if (struct_type) {
-                auto info = struct_type->getInfo<ValidationInfo>();
-                // if struct type already added find it and detect recursuin with that
-                if (std::find(invalidated_types_to_return._struct_type_names.begin(),
-                              invalidated_types_to_return._struct_type_names.end(),
-                              struct_type->getName()) ==
-                    invalidated_types_to_return._struct_type_names.end()) {
-                    // we insert the value here to ensure recursion detection
-                    invalidated_types_to_return._struct_type_names.push_back(current);
-                    if (info) {
-                        info->forceRevalidation();
-                        forceRevalidationOfTypeDependencies(struct_type->getName(),
-                                                            struct_type->getTypeOfType(),
-                                                            parent_dd,
-                                                            invalidated_types_to_return);
-                    }
+    const auto& to_type_map = dependencies.find(type_of_dependency);
+    if (to_type_map != dependencies.end()) {
+        return findInMapTo(type_name, to_type_map->second);
+    }
+    return nullptr;
+}
+
+/**
+ * Walks the reverse dependency index (to -> from) depth first and collects the dependency cone of
+ * a type. Struct types are collected in post order, reversing them yields an order where every
+ * struct type follows all invalidated struct types it uses, so the TypeInfo of the used types is
+ * always recalculated before the TypeInfo of the using type.
+ */
+class DependencyConeCollector {
+public:
+    DependencyConeCollector(
+        const std::unordered_map<uint8_t, ValidationServiceInfo::ToFromMap>& dependencies,
+        datamodel::DataDefinition& parent_dd,
+        const ValidationServiceInfo::InvalidatedTypes& already_invalidated)
+        : _dependencies(dependencies),
+          _parent_dd(parent_dd),
+          _visited_structs(already_invalidated._struct_type_names.begin(),
+                           already_invalidated._struct_type_names.end()),
+          _visited_enums(already_invalidated._enum_type_names.begin(),
+                         already_invalidated._enum_type_names.end()),
+          _visited_streams(already_invalidated._stream_names.begin(),
+                           already_invalidated._stream_names.end())
+    {
+    }
+
+    void collect(const std::string& type_name, ddl::dd::TypeOfType type)
+    {
+        if (type == struct_type) {
+            visitStructDependents(type_name);
+        }
+        else if (type == enum_type) {
+            visitEnumDependents(type_name);
+        }
+        else if (type == data_type) {
+            const auto enum_names = findDependentsOf(
+                type_name, ValidationServiceInfo::enum_type_to_data_type, _dependencies);
+            if (enum_names != nullptr) {
+                for (const auto& current: *enum_names) {
+                    visitEnum(current);
                 }
             }
+            visitStructs(findDependentsOf(
+                type_name, ValidationServiceInfo::struct_type_to_data_type, _dependencies));
+        }
+    }
+
+    void appendTo(ValidationServiceInfo::InvalidatedTypes& invalidated_types) const
+    {
+        invalidated_types._struct_type_names.insert(invalidated_types._struct_type_names.end(),
+                                                    _struct_post_order.rbegin(),
+                                                    _struct_post_order.rend());
+        invalidated_types._enum_type_names.insert(
+            invalidated_types._enum_type_names.end(), _enums.begin(), _enums.end());
+        invalidated_types._stream_names.insert(
+            invalidated_types._stream_names.end(), _streams.begin(), _streams.end());
+    }
+
+private:
+    void visitEnum(const std::string& enum_name)
+    {
+        auto enum_type_found = _parent_dd.getEnumTypes().access(enum_name);
+        if (enum_type_found && _visited_enums.insert(enum_name).second) {
+            _enums.push_back(enum_name);
+            auto info = enum_type_found->getInfo<ValidationInfo>();
+            if (info) {
+                info->forceRevalidation();
+                visitEnumDependents(enum_name);
+            }
         }
     }
 
-    // set force invalid to the enums
-    if (invalidated_enums != nullptr) {
-        for (const auto& current: *invalidated_enums) {
-            auto enum_type = parent_dd.getEnumTypes().access(current);
-            if (enum_type) {
-                auto info = enum_type->getInfo<ValidationInfo>();
-                invalidated_types_to_return._enum_type_names.push_back(current);
-                if (info) {
-                    info->forceRevalidation();
-                    forceRevalidationOfTypeDependencies(enum_type->getName(),
-                                                        enum_type->getTypeOfType(),
-                                                        parent_dd,
-                                                        invalidated_types_to_return);
+    void visitEnumDependents(const std::string& enum_name)
+    {
+        visitStructs(findDependentsOf(
+            enum_name, ValidationServiceInfo::struct_type_to_enum_type, _dependencies));
+    }
+
+    void visitStructs(const std::unordered_set<std::string>* struct_names)
+    {
+        if (struct_names != nullptr) {
+            for (const auto& current: *struct_names) {
+                visitStruct(current);
+            }
+        }
+    }
+
+    void visitStruct(const std::string& struct_name)
+    {
+        auto struct_type_found = _parent_dd.getStructTypes().access(struct_name);
+        // we insert the value first to ensure recursion detection
+        if (struct_type_found && _visited_structs.insert(struct_name).second) {
+            auto info = struct_type_found->getInfo<ValidationInfo>();
+            if (info) {
+                info->forceRevalidation();
+                visitStructDependents(struct_name);
+            }
+            _struct_post_order.push_back(struct_name);
+        }
+    }
+
+    void visitStructDependents(const std::string& struct_name)
+    {
+        visitStructs(findDependentsOf(
+            struct_name, ValidationServiceInfo::struct_type_to_struct_type, _dependencies));
+        const auto stream_names = findDependentsOf(
+            struct_name, ValidationServiceInfo::stream_to_struct_type, _dependencies);
+        if (stream_names != nullptr) {
+            for (const auto& current: *stream_names) {
+                auto stream_found = _parent_dd.getStreams().access(current);
+                if (stream_found && _visited_streams.insert(current).second) {
+                    _streams.push_back(current);
+                    auto info = stream_found->getInfo<ValidationInfo>();
+                    if (info) {
+                        info->forceRevalidation();
+                    }
                 }
             }
         }
     }
+
+    const std::unordered_map<uint8_t, ValidationServiceInfo::ToFromMap>& _dependencies;
+    datamodel::DataDefinition& _parent_dd;
+    std::unordered_set<std::string> _visited_structs;
+    std::unordered_set<std::string> _visited_enums;
+    std::unordered_set<std::string> _visited_streams;
+    std::vector<std::string> _struct_post_order;
+    std::vector<std::string> _enums;
+    std::vector<std::string> _streams;
+};
+} // namespace
+
+void ValidationServiceInfo::forceRevalidationOfTypeDependencies(
+    const std::string& type_name,
+    ddl::dd::TypeOfType type,
+    datamodel::DataDefinition& parent_dd,
+    ValidationServiceInfo::InvalidatedTypes& invalidated_types_to_return) const
+{
+    DependencyConeCollector collector(_dependencies, parent_dd, invalidated_types_to_return);
+    collector.collect(type_name, type);
+    collector.appendTo(invalidated_types_to_return);
 }
 
 } // namespace dd
@@ -12,10 +12,12 @@
 
 #include <a_util/strings.h>
 #include <ddl/dd/dd_predefined_datatypes.h>
+#include <ddl/dd/dd_typeinfomodel.h>
 #include <ddl/dd/ddcompare.h>
 #include <ddl/dd/ddstring.h>
 
 #include <algorithm>
+#include <memory>
 
 namespace ddl {
 // define all needed error types and values locally
@@ -113,12 +115,53 @@ a_util::result::Result DDCompare::isBinaryEqual(const std::string& type1,
                                                 const std::string& desc2,
                                                 bool is_subset)
 {
-    return isBinaryEqual(type1,
-                         ddl::DDString::fromXMLString(desc1),
-                         type2,
-                         ddl::DDString::fromXMLString(desc2),
-                         is_subset);
+    const auto dd1 = ddl::DDString::fromXMLString(desc1);
+    if (desc1 == desc2) {
+        // no need to parse the same description twice
+        return isBinaryEqual(type1, dd1, type2, dd1, is_subset);
+    }
+    return isBinaryEqual(type1, dd1, type2, ddl::DDString::fromXMLString(desc2), is_subset);
+}
+
+namespace {
+/**
+ * Retrieves the binary layout of a static struct type, it is cached within the TypeInfo of the
+ * struct type. Dynamic struct types do not have a binary layout.
+ */
+std::shared_ptr<const dd::BinaryLayout> getOrCalculateBinaryLayout(
+    const dd::StructTypeAccess& struct_access,
+    const codec::StructAccess& layout,
+    const dd::Version& dd_version)
+{
+    if (layout.isDynamic()) {
+        return {};
+    }
+    const auto type_info = struct_access.getStructType().getInfo<dd::TypeInfo>();
+    if (type_info == nullptr) {
+        return std::make_shared<const dd::BinaryLayout>(layout.calculateBinaryLayout());
+    }
+    auto binary_layout = type_info->getBinaryLayout(dd_version);
+    if (!binary_layout) {
+        type_info->setBinaryLayout(dd_version, layout.calculateBinaryLayout());
+        binary_layout = type_info->getBinaryLayout(dd_version);
+    }
+    return binary_layout;
+}
+
+std::shared_ptr<const dd::BinaryLayout> getCachedBinaryLayout(
+    const dd::StructTypeAccess& struct_access, const dd::Version& dd_version)
+{
+    const auto type_info = struct_access.getStructType().getInfo<dd::TypeInfo>();
+    return type_info ? type_info->getBinaryLayout(dd_version) : nullptr;
+}
+
+/// The fingerprints reject different layouts early, equal ones are confirmed leaf by leaf
+bool isSameBinaryLayout(const std::shared_ptr<const dd::BinaryLayout>& layout1,
+                        const std::shared_ptr<const dd::BinaryLayout>& layout2)
+{
+    return layout1 && layout2 && *layout1 == *layout2;
 }
+} // namespace
 
 a_util::result::Result DDCompare::isBinaryEqual(const std::string& type1,
                                                 const dd::DataDefinition& desc1,
@@ -137,15 +180,34 @@ a_util::result::Result DDCompare::isBinaryEqual(const std::string& type1,
                                  ("Unable to find definitions for struct " + type2).c_str());
     }
 
+    // a subset must not be greater than the whole size of the second
+    const bool size_matches =
+        !is_subset || struct1_access.getStaticStructSize() <= struct2_access.getStaticStructSize();
+
+    // fast path: both layouts were already compared once and did not change since then
+    if (size_matches &&
+        isSameBinaryLayout(getCachedBinaryLayout(struct1_access, desc1.getVersion()),
+                           getCachedBinaryLayout(struct2_access, desc2.getVersion()))) {
+        return a_util::result::SUCCESS;
+    }
+
     const codec::StructAccess layout1(struct1_access, desc1.getVersion());
     const codec::StructAccess layout2(struct2_access, desc2.getVersion());
 
     RETURN_DDLERROR_IF_FAILED(layout1.getInitResult());
     RETURN_DDLERROR_IF_FAILED(layout2.getInitResult());
 
+    // equal layouts are also a subset, on mismatch the full comparison creates the detailed result
+    if (size_matches &&
+        isSameBinaryLayout(
+            getOrCalculateBinaryLayout(struct1_access, layout1, desc1.getVersion()),
+            getOrCalculateBinaryLayout(struct2_access, layout2, desc2.getVersion()))) {
+        return a_util::result::SUCCESS;
+    }
+
     if (is_subset) {
         // subset is only allowed if the first is lower or equal the whole size of second
-        if (struct1_access.getStaticStructSize() <= struct2_access.getStaticStructSize()) {
+        if (size_matches) {
             return layout1.isBinarySubset(layout2);
         }
         else {
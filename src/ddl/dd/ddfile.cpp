@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../datamodel/xml_ddfromxml_reader.h"
+#include "./../utilities/dd_arena.h"
 #include "dd_fromxmlelement.h"
 
 #include <a_util/strings.h>
@@ -20,10 +22,29 @@ namespace {
 
 void fromXMLFile(dd::datamodel::DataDefinition& dd, const std::string& xml_filepath, bool strict)
 {
-    using namespace a_util::xml;
-    a_util::xml::DOM ddl_dom_file;
     std::vector<ddl::dd::Problem> problem_list;
+    std::string xml_buffer;
+    std::string xml_error;
+    if (!dd::datamodel::detail::readXMLFile(xml_filepath, xml_buffer, xml_error)) {
+        throw dd::Error("fromXMLFile", {xml_filepath}, xml_error);
+    }
+    if (dd::datamodel::detail::convertXMLFileToUTF8(xml_buffer)) {
+        // the XML is read in one pass without creating a DOM
+        if (!dd::datamodel::detail::readXML(xml_buffer, {}, strict, dd, problem_list, xml_error)) {
+            if (!xml_error.empty()) {
+                throw dd::Error("fromXMLFile", {xml_filepath}, xml_error);
+            }
+            throw dd::Error("fromXMLFile",
+                            {xml_filepath},
+                            " is not a valid DDL File. See problem list!",
+                            problem_list);
+        }
+        return;
+    }
 
+    // UTF-16 and UTF-32 encoded files are only supported by the DOM
+    using namespace a_util::xml;
+    a_util::xml::DOM ddl_dom_file;
     if (ddl_dom_file.load(xml_filepath)) {
         DOMElement root = ddl_dom_file.getRoot();
         if (!detail::fromXMLElement(dd, root, problem_list, {}, strict)) {
@@ -52,7 +73,7 @@ dd::DataDefinition DDFile::fromXMLFile(const std::string& xml_filepath, bool str
     ddl::fromXMLFile(created_datamodel, xml_filepath, strict);
     // this will validate
     created_dd.setModel(
-        std::make_shared<dd::datamodel::DataDefinition>(std::move(created_datamodel)));
+        dd::utility::makeShared<dd::datamodel::DataDefinition>(std::move(created_datamodel)));
     if (!created_dd.isValid(dd::ValidationLevel::good_enough)) {
         throw dd::Error("DDFile::fromXMLFile",
                         {xml_filepath},
@@ -9,7 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
-#include "dd_fromxmlelement.h"
+#include "./../datamodel/xml_ddfromxml_reader.h"
+#include "./../utilities/dd_arena.h"
 
 #include <a_util/strings.h>
 #include <ddl/dd/ddstring.h>
@@ -22,19 +23,18 @@ void fromXMLString(dd::datamodel::DataDefinition& dd,
                    bool strict)
 {
     std::vector<ddl::dd::Problem> problem_list;
-    using namespace a_util::xml;
-    DOM ddl_dom_string;
-    if (ddl_dom_string.fromString(xml_string)) {
-        DOMElement root = ddl_dom_string.getRoot();
-        if (!detail::fromXMLElement(dd, root, problem_list, ddl_language_version, strict)) {
-            throw dd::Error("fromXMLString",
-                            {"xml_string"},
-                            " is not a valid DDL string. See problem list!",
-                            problem_list);
+    // the XML is read in one pass without creating a DOM
+    std::string xml_buffer = xml_string;
+    std::string xml_error;
+    if (!dd::datamodel::detail::readXML(
+            xml_buffer, ddl_language_version, strict, dd, problem_list, xml_error)) {
+        if (!xml_error.empty()) {
+            throw dd::Error("fromXMLString", {"xml_string"}, xml_error);
         }
-    }
-    else {
-        throw dd::Error("fromXMLString", {"xml_string"}, ddl_dom_string.getLastError());
+        throw dd::Error("fromXMLString",
+                        {"xml_string"},
+                        " is not a valid DDL string. See problem list!",
+                        problem_list);
     }
 }
 
@@ -47,7 +47,7 @@ dd::DataDefinition DDString::fromXMLString(const std::string& xml_string,
     ddl::fromXMLString(created_datamodel, xml_string, ddl_language_version, strict);
     // this will throw if we have XML problems
     created_dd.setModel(
-        std::make_shared<dd::datamodel::DataDefinition>(std::move(created_datamodel)));
+        dd::utility::makeShared<dd::datamodel::DataDefinition>(std::move(created_datamodel)));
     // setModel validates
     // we throw if invalid
     if (!created_dd.isValid(dd::ValidationLevel::good_enough)) {
@@ -96,7 +96,13 @@ MapConfiguration& MapConfiguration::operator=(MapConfiguration&& oOther)
     _checked_for_consistency = oOther._checked_for_consistency;
     _is_consistent = oOther._is_consistent;
 
-    _transforms = std::move(oOther._transforms);
+    if (&oOther != this) {
+        for (MapTransformationList::iterator it = _transforms.begin(); it != _transforms.end();
+             ++it) {
+            delete *it;
+        }
+        _transforms = std::move(oOther._transforms);
+    }
 
     repairConfigReferences(*this);
     return *this;
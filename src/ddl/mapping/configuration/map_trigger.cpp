@@ -258,6 +258,11 @@ a_util::result::Result MapPeriodicTrigger::writeToDOM(a_util::xml::DOMElement& o
     return a_util::result::SUCCESS;
 }
 
+MapTriggerBase::TriggerKind MapPeriodicTrigger::getKind() const
+{
+    return tk_periodic;
+}
+
 MapTriggerBase* MapPeriodicTrigger::clone() const
 {
     return new MapPeriodicTrigger(*this);
@@ -338,6 +343,11 @@ a_util::result::Result MapSignalTrigger::setVariableNoTypeCheck(const std::strin
     return a_util::result::SUCCESS;
 }
 
+MapTriggerBase::TriggerKind MapSignalTrigger::getKind() const
+{
+    return tk_signal;
+}
+
 MapTriggerBase* MapSignalTrigger::clone() const
 {
     return new MapSignalTrigger(*this);
@@ -478,6 +488,11 @@ a_util::result::Result MapDataTrigger::setComparisonNoTypeCheck(
     return res;
 }
 
+MapTriggerBase::TriggerKind MapDataTrigger::getKind() const
+{
+    return tk_data;
+}
+
 MapTriggerBase* MapDataTrigger::clone() const
 {
     return new MapDataTrigger(*this);
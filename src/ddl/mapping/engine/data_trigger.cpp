@@ -8,12 +8,48 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include <a_util/result/error_def.h>
 #include <ddl/mapping/engine/data_trigger.h>
+#include <ddl/mapping/engine/element.h>
 
 #include <assert.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 
+namespace ddl {
+namespace mapping {
+namespace rt {
+// define all needed error types and values locally
+_MAKE_RESULT(-42, ERR_INVALID_TYPE);
+} // namespace rt
+} // namespace mapping
+} // namespace ddl
+
+using namespace ddl::mapping;
 using namespace ddl::mapping::rt;
 
+namespace {
+/**
+ * Converts an integral value into the integer type T.
+ * @retval false The value is out of the range of T (or NaN)
+ */
+template <typename T>
+bool toInteger(double value, T& result)
+{
+    // both limits are powers of two (or 0), so they are exact for 64 bit types as well
+    const double lowest = static_cast<double>(std::numeric_limits<T>::lowest());
+    const double behind_max = std::ldexp(1.0, std::numeric_limits<T>::digits);
+    if (!(value >= lowest && value < behind_max)) {
+        return false;
+    }
+    result = static_cast<T>(value);
+    return true;
+}
+
+} // namespace
+
 DataTrigger::DataTrigger(IMappingEnvironment& oEnv,
                          const std::string& strTriggerName,
                          const std::string& strVariableName,
@@ -23,7 +59,11 @@ DataTrigger::DataTrigger(IMappingEnvironment& oEnv,
       _name(strTriggerName),
       _variable_name(strVariableName),
       _value(f64Value),
-      _is_running(false)
+      _is_running(false),
+      _compare(&DataTrigger::compareNever),
+      _signed_range(),
+      _unsigned_range(),
+      _within_range(false)
 {
     if (strOperator == "equal") {
         _operator = e_equal;
@@ -87,6 +127,197 @@ bool DataTrigger::compare(double f64Val)
     return false;
 }
 
+a_util::result::Result DataTrigger::compile(uint32_t type32)
+{
+    switch (type32) {
+    case e_uint8:
+        compileInteger<uint8_t>();
+        break;
+    case e_uint16:
+        compileInteger<uint16_t>();
+        break;
+    case e_uint32:
+        compileInteger<uint32_t>();
+        break;
+    case e_uint64:
+        compileInteger<uint64_t>();
+        break;
+    case e_int8:
+        compileInteger<int8_t>();
+        break;
+    case e_int16:
+        compileInteger<int16_t>();
+        break;
+    case e_int32:
+        compileInteger<int32_t>();
+        break;
+    case e_int64:
+        compileInteger<int64_t>();
+        break;
+    case e_float32:
+        compileFloat<float>();
+        break;
+    case e_float64:
+        compileFloat<double>();
+        break;
+    case e_bool:
+        compileInteger<bool>();
+        break;
+    case e_char:
+        compileInteger<char>();
+        break;
+    default:
+        _compare = &DataTrigger::compareNever;
+        return ERR_INVALID_TYPE;
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+template <typename T>
+void DataTrigger::compileInteger()
+{
+    // every comparison of an integer with a double is a range check: x < 2.5 is x <= 2,
+    // x == 2.5 is never fulfilled and x != 2.5 always
+    T lower = std::numeric_limits<T>::lowest();
+    T upper = (std::numeric_limits<T>::max)();
+    T bound = {};
+    bool is_empty = false;
+    switch (_operator) {
+    case e_equal:
+    case e_not_equal:
+        is_empty = std::floor(_value) != _value || !toInteger(_value, bound);
+        lower = bound;
+        upper = bound;
+        break;
+    case e_less_than:
+        if (!toInteger(std::ceil(_value), bound) || bound == lower) {
+            // behind the maximum all values are less
+            is_empty = !(std::ceil(_value) > 0);
+        }
+        else {
+            upper = static_cast<T>(bound - 1);
+        }
+        break;
+    case e_less_than_equal:
+        if (!toInteger(std::floor(_value), bound)) {
+            is_empty = !(std::floor(_value) > 0);
+        }
+        else {
+            upper = bound;
+        }
+        break;
+    case e_greater_than:
+        if (!toInteger(std::floor(_value), bound) || bound == upper) {
+            // before the minimum all values are greater
+            is_empty = !(std::floor(_value) < 0);
+        }
+        else {
+            lower = static_cast<T>(bound + 1);
+        }
+        break;
+    case e_greater_than_equal:
+        if (!toInteger(std::ceil(_value), bound)) {
+            is_empty = !(std::ceil(_value) < 0);
+        }
+        else {
+            lower = bound;
+        }
+        break;
+    default:
+        assert(false);
+        is_empty = true;
+        break;
+    }
+
+    _within_range = _operator != e_not_equal;
+    if (std::is_signed<T>::value) {
+        _signed_range[0] = is_empty ? 1 : static_cast<int64_t>(lower);
+        _signed_range[1] = is_empty ? 0 : static_cast<int64_t>(upper);
+    }
+    else {
+        _unsigned_range[0] = is_empty ? 1 : static_cast<uint64_t>(lower);
+        _unsigned_range[1] = is_empty ? 0 : static_cast<uint64_t>(upper);
+    }
+    _compare = &DataTrigger::compareInteger<T>;
+}
+
+template <typename T>
+void DataTrigger::compileFloat()
+{
+    switch (_operator) {
+    case e_equal:
+        _compare = &DataTrigger::compareFloat<T, e_equal>;
+        break;
+    case e_not_equal:
+        _compare = &DataTrigger::compareFloat<T, e_not_equal>;
+        break;
+    case e_less_than:
+        _compare = &DataTrigger::compareFloat<T, e_less_than>;
+        break;
+    case e_greater_than:
+        _compare = &DataTrigger::compareFloat<T, e_greater_than>;
+        break;
+    case e_less_than_equal:
+        _compare = &DataTrigger::compareFloat<T, e_less_than_equal>;
+        break;
+    case e_greater_than_equal:
+        _compare = &DataTrigger::compareFloat<T, e_greater_than_equal>;
+        break;
+    default:
+        assert(false);
+        _compare = &DataTrigger::compareNever;
+        break;
+    }
+}
+
+bool DataTrigger::compareNever(const DataTrigger&, const void*)
+{
+    return false;
+}
+
+template <typename T>
+bool DataTrigger::compareInteger(const DataTrigger& oTrigger, const void* pValue)
+{
+    T typed_value;
+    std::memcpy(&typed_value, pValue, sizeof(T));
+    bool bWithinRange = false;
+    if (std::is_signed<T>::value) {
+        const int64_t value = static_cast<int64_t>(typed_value);
+        bWithinRange = oTrigger._signed_range[0] <= value && value <= oTrigger._signed_range[1];
+    }
+    else {
+        const uint64_t value = static_cast<uint64_t>(typed_value);
+        bWithinRange =
+            oTrigger._unsigned_range[0] <= value && value <= oTrigger._unsigned_range[1];
+    }
+    return bWithinRange == oTrigger._within_range;
+}
+
+template <typename T, Operator op>
+bool DataTrigger::compareFloat(const DataTrigger& oTrigger, const void* pValue)
+{
+    T typed_value;
+    std::memcpy(&typed_value, pValue, sizeof(T));
+    const double f64Val = typed_value;
+    switch (op) {
+    case e_equal:
+        return f64Val == oTrigger._value;
+    case e_not_equal:
+        return f64Val != oTrigger._value;
+    case e_less_than:
+        return f64Val < oTrigger._value;
+    case e_greater_than:
+        return f64Val > oTrigger._value;
+    case e_less_than_equal:
+        return f64Val <= oTrigger._value;
+    case e_greater_than_equal:
+        return f64Val >= oTrigger._value;
+    }
+
+    return false;
+}
+
 a_util::result::Result DataTrigger::transmit()
 {
     if (_is_running) {
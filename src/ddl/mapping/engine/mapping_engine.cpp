@@ -9,15 +9,22 @@
  */
 
 #include <a_util/result/error_def.h>
+#include <ddl/dd/ddcompare.h>
 #include <ddl/legacy_error_macros.h>
 #include <ddl/mapping/engine/mapping_engine.h>
 
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace ddl {
 namespace mapping {
 namespace rt {
 // define all needed error types and values locally
 _MAKE_RESULT(-4, ERR_POINTER);
 _MAKE_RESULT(-5, ERR_INVALID_ARG);
+_MAKE_RESULT(-13, ERR_TIMEOUT);
 _MAKE_RESULT(-16, ERR_NOT_IMPL);
 _MAKE_RESULT(-40, ERR_INVALID_STATE);
 _MAKE_RESULT(-42, ERR_INVALID_TYPE);
@@ -44,6 +51,232 @@ a_util::result::Result MappingEngine::setConfiguration(const MapConfiguration& o
     return a_util::result::SUCCESS;
 }
 
+namespace {
+bool hasEqualTriggers(const MapTarget& oTarget, const MapTarget& oOther)
+{
+    const MapTriggerList& oTriggers = oTarget.getTriggerList();
+    const MapTriggerList& oOtherTriggers = oOther.getTriggerList();
+    if (oTriggers.size() != oOtherTriggers.size()) {
+        return false;
+    }
+    for (size_t nTrigger = 0; nTrigger < oTriggers.size(); ++nTrigger) {
+        if (!oTriggers[nTrigger]->isEqual(*oOtherTriggers[nTrigger])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Check that the environment still resolves the type to the binary layout it was created with
+bool hasEqualLayout(IMappingEnvironment& oEnv,
+                    const std::string& strType,
+                    const std::string& strDescription)
+{
+    const char* strCurrentDesc = nullptr;
+    if (!oEnv.resolveType(strType.c_str(), strCurrentDesc) || nullptr == strCurrentDesc) {
+        return false;
+    }
+    return strDescription == strCurrentDesc ||
+           a_util::result::isOk(ddl::DDCompare::isBinaryEqual(
+               strType, strDescription, strType, strCurrentDesc, false));
+}
+
+/// Tries to lock the buffers of all mapped targets, so no source writes and no trigger sends them
+class TargetReadLocks {
+public:
+    explicit TargetReadLocks(const TargetMap& oTargets) : _targets(oTargets)
+    {
+        for (_locked_end = _targets.cbegin(); _locked_end != _targets.cend(); ++_locked_end) {
+            if (!_locked_end->second->tryAquireReadLock()) {
+                break;
+            }
+        }
+    }
+
+    ~TargetReadLocks()
+    {
+        for (auto it = _targets.cbegin(); it != _locked_end; ++it) {
+            it->second->releaseReadLock();
+        }
+    }
+
+    TargetReadLocks(const TargetReadLocks&) = delete;
+    TargetReadLocks& operator=(const TargetReadLocks&) = delete;
+
+    /// Check whether all buffers are locked
+    bool isLocked() const
+    {
+        return _locked_end == _targets.cend();
+    }
+
+private:
+    const TargetMap& _targets;
+    TargetMap::const_iterator _locked_end;
+};
+
+/// Check whether a sample of one of the sources is in progress
+bool isProcessingSample(const SourceMap& oSources)
+{
+    for (auto it = oSources.cbegin(); it != oSources.cend(); ++it) {
+        if (it->second->isProcessingSample()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Switches the sources and the targets to the started update at once between two samples, as
+ * soon as no sample of the sources is in progress and no target is sent
+ * @return @c false if this did not happen within a millisecond and the switch has to be retried
+ */
+bool trySwitch(const SourceMap& oSources, TargetMap& oTargets, a_util::result::Result& nRes)
+{
+    std::vector<std::unique_lock<a_util::concurrency::shared_mutex>> vecSourceLocks;
+    vecSourceLocks.reserve(oSources.size());
+    for (auto it = oSources.cbegin(); it != oSources.cend(); ++it) {
+        vecSourceLocks.push_back(it->second->lockForUpdate());
+    }
+
+    // no sample starts meanwhile, the samples in progress end soon unless a callback waits
+    const auto tmDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+    for (;;) {
+        if (!isProcessingSample(oSources)) {
+            const TargetReadLocks oTargetLocks(oTargets);
+            if (oTargetLocks.isLocked()) {
+                for (auto it = oSources.cbegin(); it != oSources.cend(); ++it) {
+                    it->second->commitUpdate();
+                }
+                for (auto it = oTargets.begin(); it != oTargets.end(); ++it) {
+                    const a_util::result::Result nConstantsRes = it->second->commitUpdate();
+                    if (!nConstantsRes) {
+                        nRes = nConstantsRes;
+                    }
+                }
+                return true;
+            }
+        }
+        if (std::chrono::steady_clock::now() > tmDeadline) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+}
+} // namespace
+
+a_util::result::Result MappingEngine::updateConfiguration(const MapConfiguration& oConfig,
+                                                          timestamp_t tmTimeout)
+{
+    // the new assignments reference the transformations of this copy, it is swapped with
+    // _map_config after the switch
+    MapConfiguration oNewConfig(oConfig);
+
+    // check the mapped targets and the types of the sources to reuse
+    for (auto it = _targets.cbegin(); it != _targets.cend(); ++it) {
+        const MapTarget* const pMapTarget = oNewConfig.getTarget(it->first);
+        const MapTarget* const pPrevMapTarget = _map_config.getTarget(it->first);
+        if (nullptr == pMapTarget || nullptr == pPrevMapTarget ||
+            pMapTarget->getType() != it->second->getTypeName() ||
+            !hasEqualTriggers(*pMapTarget, *pPrevMapTarget) ||
+            !hasEqualLayout(
+                _env, it->second->getTypeName(), it->second->getTypeDescription())) {
+            return ERR_INVALID_ARG;
+        }
+        const MapSourceNameList& lstSources = pMapTarget->getReferencedSources();
+        for (auto itSource = lstSources.cbegin(); itSource != lstSources.cend(); ++itSource) {
+            const MapSource* const pMapSource = oNewConfig.getSource(*itSource);
+            if (nullptr == pMapSource) {
+                return ERR_INVALID_ARG;
+            }
+            SourceMap::const_iterator itExisting = _sources.find(*itSource);
+            if (itExisting != _sources.end() &&
+                (itExisting->second->getTypeName() != pMapSource->getType() ||
+                 !hasEqualLayout(_env,
+                                 itExisting->second->getTypeName(),
+                                 itExisting->second->getTypeDescription()))) {
+                return ERR_INVALID_ARG;
+            }
+        }
+    }
+
+    // create the missing sources, they are not used before the switch
+    a_util::result::Result nRes;
+    SourceMap oNewSources;
+    for (auto it = _targets.cbegin(); it != _targets.cend() && nRes; ++it) {
+        const MapSourceNameList& lstSources =
+            oNewConfig.getTarget(it->first)->getReferencedSources();
+        for (auto itSource = lstSources.cbegin(); itSource != lstSources.cend(); ++itSource) {
+            if (_sources.find(*itSource) != _sources.end() ||
+                oNewSources.find(*itSource) != oNewSources.end()) {
+                continue;
+            }
+            const MapSource* const pMapSource = oNewConfig.getSource(*itSource);
+            const char* strSourceDesc = nullptr;
+            nRes = _env.resolveType(pMapSource->getType().c_str(), strSourceDesc);
+            if (!nRes) {
+                break;
+            }
+
+            auto pSrc = std::make_unique<Source>(_env);
+            nRes = pSrc->create(*pMapSource, strSourceDesc);
+            if (!nRes) {
+                break;
+            }
+            oNewSources[pMapSource->getName()] = pSrc.release();
+        }
+    }
+
+    // create the new assignments aside
+    SourceMap oAllSources(_sources);
+    oAllSources.insert(oNewSources.cbegin(), oNewSources.cend());
+    if (nRes) {
+        for (auto it = oAllSources.begin(); it != oAllSources.end(); ++it) {
+            it->second->beginUpdate();
+        }
+        for (auto it = _targets.begin(); it != _targets.end() && nRes; ++it) {
+            nRes = it->second->beginUpdate(
+                oNewConfig, *oNewConfig.getTarget(it->first), oAllSources);
+        }
+    }
+
+    bool bSwitch = a_util::result::isOk(nRes);
+    if (bSwitch) {
+        // the locks are not held while waiting for a sample in progress: a trigger calls back
+        // into the environment, the callback may wait for another sample of the sources
+        const auto tmDeadline =
+            std::chrono::steady_clock::now() + std::chrono::microseconds(tmTimeout);
+        while (!trySwitch(oAllSources, _targets, nRes)) {
+            if (std::chrono::steady_clock::now() > tmDeadline) {
+                nRes = ERR_TIMEOUT;
+                bSwitch = false;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    if (bSwitch) {
+        _sources.insert(oNewSources.cbegin(), oNewSources.cend());
+        oNewSources.clear();
+    }
+
+    // remove the previous assignments after the switch or the new ones on error
+    for (auto it = _targets.begin(); it != _targets.end(); ++it) {
+        it->second->endUpdate();
+    }
+    for (auto it = oAllSources.begin(); it != oAllSources.end(); ++it) {
+        it->second->endUpdate();
+    }
+    for (auto it = oNewSources.begin(); it != oNewSources.end(); ++it) {
+        delete it->second;
+    }
+    if (bSwitch) {
+        // the transformations are moved, so the new assignments still reference them
+        _map_config = std::move(oNewConfig);
+    }
+
+    return nRes;
+}
+
 a_util::result::Result MappingEngine::Map(const std::string& strTargetName, handle_t& hMappedSignal)
 {
     // If the target is already in the List, return invalid error
@@ -109,18 +342,16 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
         // Create Triggers
         const MapTriggerList& oTriggerList = pMapTarget->getTriggerList();
         for (auto it = oTriggerList.cbegin(); it != oTriggerList.cend(); it++) {
-            const MapPeriodicTrigger* const pMapPTrigger =
-                dynamic_cast<const MapPeriodicTrigger*>(*it);
-            const MapSignalTrigger* const pMapSigTrigger =
-                dynamic_cast<const MapSignalTrigger*>(*it);
-            const MapDataTrigger* const pMapDataTrigger = dynamic_cast<const MapDataTrigger*>(*it);
-
-            if (!pMapPTrigger && !pMapSigTrigger && !pMapDataTrigger) {
+            const MapTriggerBase::TriggerKind eKind = (*it)->getKind();
+            if (eKind != MapTriggerBase::tk_periodic && eKind != MapTriggerBase::tk_signal &&
+                eKind != MapTriggerBase::tk_data) {
                 nRes = ERR_NOT_IMPL;
                 break;
             }
 
-            if (pMapPTrigger) {
+            if (eKind == MapTriggerBase::tk_periodic) {
+                const MapPeriodicTrigger* const pMapPTrigger =
+                    static_cast<const MapPeriodicTrigger*>(*it);
                 std::string strTrigName;
                 if (pMapPTrigger->getPeriod() == 0) {
                     strTrigName = "ini";
@@ -144,24 +375,35 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
                 _triggers[strTrigName]->addTarget(pTarget);
             }
 
-            if (pMapSigTrigger) {
+            if (eKind == MapTriggerBase::tk_signal) {
+                const MapSignalTrigger* const pMapSigTrigger =
+                    static_cast<const MapSignalTrigger*>(*it);
                 const std::string strSourceName = pMapSigTrigger->getVariable();
+                // the key differs from the names of the periodic and data triggers, so the
+                // trigger found is a signal trigger
+                const std::string strTrigName = "signal:" + strSourceName;
 
-                TriggerMap::iterator iter = _triggers.find(strSourceName);
+                TriggerMap::iterator iter = _triggers.find(strTrigName);
                 if (iter == _triggers.end()) {
                     SignalTrigger* const pTrigger = new SignalTrigger(_env, strSourceName);
                     std::pair<TriggerMap::iterator, bool> oNewElem =
-                        _triggers.insert(std::make_pair(strSourceName, pTrigger));
+                        _triggers.insert(std::make_pair(strTrigName, pTrigger));
                     iter = oNewElem.first;
 
-                    oTriggerCleanup[strSourceName] = pTrigger;
+                    oTriggerCleanup[strTrigName] = pTrigger;
                 }
 
                 iter->second->addTarget(pTarget);
-                _sources[strSourceName]->addTrigger(_map_config, iter->second);
+                nRes = _sources[strSourceName]->addTrigger(
+                    _map_config, static_cast<SignalTrigger*>(iter->second));
+                if (!nRes) {
+                    break;
+                }
             }
 
-            if (pMapDataTrigger) {
+            if (eKind == MapTriggerBase::tk_data) {
+                const MapDataTrigger* const pMapDataTrigger =
+                    static_cast<const MapDataTrigger*>(*it);
                 std::string name = pMapDataTrigger->getSource() + "." +
                                    pMapDataTrigger->getVariable() + pMapDataTrigger->getOperator();
                 name.append(a_util::strings::format("%f", pMapDataTrigger->getValue()));
@@ -181,7 +423,11 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
                 }
 
                 iter->second->addTarget(pTarget);
-                _sources[pMapDataTrigger->getSource()]->addTrigger(_map_config, iter->second);
+                nRes = _sources[pMapDataTrigger->getSource()]->addTrigger(
+                    _map_config, static_cast<DataTrigger*>(iter->second));
+                if (!nRes) {
+                    break;
+                }
             }
         }
     }
@@ -198,6 +444,10 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
         }
 
         for (TriggerMap::iterator it = oTriggerCleanup.begin(); it != oTriggerCleanup.end(); ++it) {
+            for (SourceMap::iterator itSource = _sources.begin(); itSource != _sources.end();
+                 ++itSource) {
+                itSource->second->removeTrigger(it->second);
+            }
             _triggers.erase(it->first);
             delete it->second;
         }
@@ -294,6 +544,10 @@ a_util::result::Result MappingEngine::unmap(handle_t hMappedSignal)
     for (TriggerMap::iterator it = _triggers.begin(); it != _triggers.end(); ++it) {
         it->second->removeTarget(pTarget);
         if (it->second->getTargetList().empty()) {
+            for (SourceMap::iterator itSource = _sources.begin(); itSource != _sources.end();
+                 ++itSource) {
+                itSource->second->removeTrigger(it->second);
+            }
             delete it->second;
             vecEraseTrig.push_back(it);
         }
@@ -9,14 +9,17 @@
  */
 
 #include <a_util/result/error_def.h>
+#include <ddl/codec/codec_factory_cache.h>
 #include <ddl/codec/legacy/access_element.h>
 #include <ddl/legacy_error_macros.h>
 #include <ddl/mapping/configuration/map_configuration.h>
 #include <ddl/mapping/engine/data_trigger.h>
 #include <ddl/mapping/engine/signal_trigger.h>
 #include <ddl/mapping/engine/source.h>
+#include <ddl/mapping/engine/target.h>
 
-#include <assert.h>
+#include <algorithm>
+#include <shared_mutex>
 
 namespace ddl {
 namespace mapping {
@@ -32,7 +35,34 @@ _MAKE_RESULT(-20, ERR_INVALID_ELEMENT);
 using namespace ddl::mapping;
 using namespace ddl::mapping::rt;
 
-Source::Source(IMappingEnvironment& oEnv) : _env(oEnv), _handle(0)
+namespace {
+/// Holds the write locks of all targets a sample is written to
+class TargetWriteLocks {
+public:
+    explicit TargetWriteLocks(const Source::TargetRefList& oTargets) : _targets(oTargets)
+    {
+        for (auto it = _targets.cbegin(); it != _targets.cend(); ++it) {
+            (*it)->aquireWriteLock();
+        }
+    }
+
+    ~TargetWriteLocks()
+    {
+        for (auto it = _targets.cbegin(); it != _targets.cend(); ++it) {
+            (*it)->releaseWriteLock();
+        }
+    }
+
+    TargetWriteLocks(const TargetWriteLocks&) = delete;
+    TargetWriteLocks& operator=(const TargetWriteLocks&) = delete;
+
+private:
+    const Source::TargetRefList& _targets;
+};
+} // namespace
+
+Source::Source(IMappingEnvironment& oEnv)
+    : _env(oEnv), _handle(0), _program(std::make_shared<Program>())
 {
     _type_map["tUInt8"] = e_uint8;
     _type_map["tUInt16"] = e_uint16;
@@ -62,8 +92,8 @@ a_util::result::Result Source::create(const MapSource& oMapSource,
     _type_name = oMapSource.getType();
     _type_description = strTypeDescription;
 
-    _codec_factory =
-        std::make_unique<ddl::codec::CodecFactory>(_type_name.c_str(), _type_description.c_str());
+    _codec_factory = std::make_unique<ddl::codec::CodecFactory>(
+        ddl::codec::CodecFactoryCache::getGlobalCache().getFactory(_type_name, _type_description));
     if (_codec_factory->isValid()) {
         return _env.registerSource(_name.c_str(), _type_name.c_str(), this, _handle);
     }
@@ -71,64 +101,83 @@ a_util::result::Result Source::create(const MapSource& oMapSource,
     return ERR_INVALID_TYPE;
 }
 
-a_util::result::Result Source::addTrigger(const MapConfiguration& oMapConfig, TriggerBase* oTrigger)
+a_util::result::Result Source::addTrigger(const MapConfiguration&, SignalTrigger* pTrigger)
 {
-    Triggers::iterator it = _triggers.begin();
-    for (; it != _triggers.end(); ++it) {
-        if (it->first == oTrigger)
-            break;
+    // the triggers are not part of an update, see beginUpdate
+    SignalTriggers& oSignalTriggers = _program->signal_triggers;
+    if (std::find(oSignalTriggers.begin(), oSignalTriggers.end(), pTrigger) ==
+        oSignalTriggers.end()) {
+        oSignalTriggers.push_back(pTrigger);
     }
 
-    if (it == _triggers.end()) {
-        AssignmentStruct oStruct;
-        DataTrigger* pDataTrigger = dynamic_cast<DataTrigger*>(oTrigger);
-
-        if (pDataTrigger) {
-            // Get structure from datamodel which must have set the TypeModel!
-            auto struct_access =
-                dd::StructTypeAccess(oMapConfig.getDD()->getStructTypes().get(_type_name));
-            if (!struct_access) {
-                return ERR_POINTER;
-            }
-            auto elem_access = struct_access.getElementByPath(pDataTrigger->getVariable());
-            if (!elem_access) {
-                return ERR_POINTER;
-            }
+    return a_util::result::SUCCESS;
+}
 
-            // Get ID in DataDefinition
-            ddl::codec::CodecFactory oFac(struct_access);
-            ddl::codec::StaticDecoder oDecoder =
-                _codec_factory->makeStaticDecoderFor(NULL, oFac.getStaticBufferSize());
+a_util::result::Result Source::addTrigger(const MapConfiguration& oMapConfig,
+                                          DataTrigger* pTrigger)
+{
+    DataTriggers& oDataTriggers = _program->data_triggers;
+    for (DataTriggers::const_iterator it = oDataTriggers.begin(); it != oDataTriggers.end(); ++it) {
+        if (it->first == pTrigger) {
+            return a_util::result::SUCCESS;
+        }
+    }
 
-            try {
-                // Get element pointer offset
-                oStruct.element_ptr_offset = reinterpret_cast<uintptr_t>(
-                    oDecoder.getElement(pDataTrigger->getVariable()).getAddress());
-            }
-            catch (const std::exception& ex) {
-                RETURN_ERROR_DESCRIPTION(ERR_INVALID_ELEMENT, ex.what());
-            }
+    // Get structure from datamodel which must have set the TypeModel!
+    auto struct_access =
+        dd::StructTypeAccess(oMapConfig.getDD()->getStructTypes().get(_type_name));
+    if (!struct_access) {
+        return ERR_POINTER;
+    }
+    auto elem_access = struct_access.getElementByPath(pTrigger->getVariable());
+    if (!elem_access) {
+        return ERR_POINTER;
+    }
 
-            auto data_type_name = elem_access.getElement().getTypeName();
-            // Get Type from TypeMap
-            TypeMap::const_iterator it_name = _type_map.find(data_type_name);
-            if (it_name != _type_map.end()) {
-                oStruct.type32 = it_name->second;
-            }
+    // Get ID in DataDefinition
+    ddl::codec::StaticDecoder oDecoder =
+        _codec_factory->makeStaticDecoderFor(NULL, _codec_factory->getStaticBufferSize());
 
-            // find element size
-            auto data_type_source = elem_access.getDataType();
-            if (data_type_source) {
-                oStruct.buffer_size = data_type_source->getBitSize() / 8;
-            }
-            else {
-                return ERR_INVALID_TYPE;
-            }
-        }
+    uintptr_t element_ptr_offset = 0;
+    try {
+        // Get element pointer offset
+        element_ptr_offset = reinterpret_cast<uintptr_t>(
+            oDecoder.getElement(pTrigger->getVariable()).getAddress());
+    }
+    catch (const std::exception& ex) {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ELEMENT, ex.what());
+    }
 
-        _triggers.push_back(std::make_pair(oTrigger, oStruct));
+    // Get Type from TypeMap, for enum types this is the underlying data type
+    auto data_type_source = elem_access.getDataType();
+    if (!data_type_source) {
+        return ERR_INVALID_TYPE;
+    }
+    TypeMap::const_iterator it_name = _type_map.find(data_type_source->getName());
+    if (it_name == _type_map.end()) {
+        return ERR_INVALID_TYPE;
     }
 
+    // the type of the variable is known now, so the comparison does not need to convert
+    RETURN_IF_FAILED(pTrigger->compile(it_name->second));
+    oDataTriggers.push_back(std::make_pair(pTrigger, element_ptr_offset));
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result Source::removeTrigger(const TriggerBase* pTrigger)
+{
+    SignalTriggers& oSignalTriggers = _program->signal_triggers;
+    oSignalTriggers.erase(std::remove(oSignalTriggers.begin(), oSignalTriggers.end(), pTrigger),
+                          oSignalTriggers.end());
+    DataTriggers& oDataTriggers = _program->data_triggers;
+    oDataTriggers.erase(std::remove_if(oDataTriggers.begin(),
+                                       oDataTriggers.end(),
+                                       [pTrigger](const DataTriggers::value_type& oDataTrigger) {
+                                           return oDataTrigger.first == pTrigger;
+                                       }),
+                        oDataTriggers.end());
+
     return a_util::result::SUCCESS;
 }
 
@@ -137,17 +186,55 @@ const std::string& Source::getTypeName() const
     return _type_name;
 }
 
+const std::string& Source::getTypeDescription() const
+{
+    return _type_description;
+}
+
 const Source::Assignments& Source::getAssigmentList() const
 {
-    return _assignments;
+    return _update_program ? _update_program->assignments : _program->assignments;
+}
+
+void Source::beginUpdate()
+{
+    // the triggers of the mapped targets are not changed by an update
+    _update_program = std::make_shared<Program>();
+    _update_program->signal_triggers = _program->signal_triggers;
+    _update_program->data_triggers = _program->data_triggers;
+}
+
+void Source::commitUpdate()
+{
+    if (_update_program) {
+        std::swap(_program, _update_program);
+    }
+}
+
+bool Source::isProcessingSample() const
+{
+    // every sample in progress keeps the program it was written with until its triggers were
+    // called
+    return _program.use_count() > 1;
+}
+
+void Source::endUpdate()
+{
+    _update_program.reset();
+}
+
+Source::Program& Source::getProgramToUpdate()
+{
+    return _update_program ? *_update_program : *_program;
 }
 
 a_util::result::Result Source::addAssignment(const MapConfiguration& oMapConfig,
                                              const std::string& strSourceElement,
                                              TargetElement* pTargetElement)
 {
+    Program& oProgram = getProgramToUpdate();
     if (strSourceElement == "received()") {
-        _received_elements.push_back(pTargetElement);
+        oProgram.received_elements.push_back(pTargetElement);
     }
     else {
         AssignmentStruct oStruct;
@@ -193,8 +280,8 @@ a_util::result::Result Source::addAssignment(const MapConfiguration& oMapConfig,
             }
             else if (type_of_type == ddl::dd::struct_type) {
                 // TODO: check if this struct can be a different one than the one in _codec_factory
-                ddl::codec::CodecFactory oFactory(elem_access.getStructType()->getName().c_str(),
-                                                  _type_description.c_str());
+                const auto oFactory = ddl::codec::CodecFactoryCache::getGlobalCache().getFactory(
+                    elem_access.getStructType()->getName(), _type_description);
 
                 oStruct.buffer_size = oFactory.getStaticBufferSize();
             }
@@ -218,9 +305,8 @@ a_util::result::Result Source::addAssignment(const MapConfiguration& oMapConfig,
                 strPath.append("[0]");
             }
 
-            ddl::codec::CodecFactory oFac(struct_access);
             ddl::codec::StaticDecoder oDecoder =
-                _codec_factory->makeStaticDecoderFor(NULL, oFac.getStaticBufferSize());
+                _codec_factory->makeStaticDecoderFor(NULL, _codec_factory->getStaticBufferSize());
 
             try {
                 // Get element pointer offset
@@ -232,31 +318,33 @@ a_util::result::Result Source::addAssignment(const MapConfiguration& oMapConfig,
             }
         }
 
-        Assignments::iterator itAssigns = _assignments.end();
-        for (itAssigns = _assignments.begin(); itAssigns != _assignments.end(); ++itAssigns) {
+        Assignments::iterator itAssigns = oProgram.assignments.end();
+        for (itAssigns = oProgram.assignments.begin(); itAssigns != oProgram.assignments.end();
+             ++itAssigns) {
             if (itAssigns->first == oStruct) {
                 break;
             }
         }
 
-        if (itAssigns == _assignments.end()) {
-            _assignments.push_back(std::make_pair(oStruct, TargetElementList()));
-            _assignments.back().second.push_back(pTargetElement);
+        if (itAssigns == oProgram.assignments.end()) {
+            oProgram.assignments.push_back(std::make_pair(oStruct, TargetElementList()));
+            oProgram.assignments.back().second.push_back(pTargetElement);
         }
         else {
             itAssigns->second.push_back(pTargetElement);
         }
     }
 
-    _targets.insert(pTargetElement->getTarget());
+    oProgram.targets.insert(pTargetElement->getTarget());
 
     return a_util::result::SUCCESS;
 }
 
 a_util::result::Result Source::removeAssignmentsFor(const Target* pTarget)
 {
-    for (Assignments::iterator itAssignments = _assignments.begin();
-         itAssignments != _assignments.end();) {
+    Program& oProgram = getProgramToUpdate();
+    for (Assignments::iterator itAssignments = oProgram.assignments.begin();
+         itAssignments != oProgram.assignments.end();) {
         TargetElementList& oAssignedElements = itAssignments->second;
         for (TargetElementList::iterator itElements = oAssignedElements.begin();
              itElements != oAssignedElements.end();) {
@@ -270,14 +358,24 @@ a_util::result::Result Source::removeAssignmentsFor(const Target* pTarget)
         }
 
         if (itAssignments->second.empty()) {
-            itAssignments = _assignments.erase(itAssignments);
+            itAssignments = oProgram.assignments.erase(itAssignments);
         }
         else {
             ++itAssignments;
         }
     }
 
-    _targets.erase(pTarget);
+    for (TargetElementList::iterator itElements = oProgram.received_elements.begin();
+         itElements != oProgram.received_elements.end();) {
+        if ((*itElements)->getTarget() == pTarget) {
+            itElements = oProgram.received_elements.erase(itElements);
+        }
+        else {
+            ++itElements;
+        }
+    }
+
+    oProgram.targets.erase(pTarget);
 
     return a_util::result::SUCCESS;
 }
@@ -288,99 +386,59 @@ a_util::result::Result Source::onSampleReceived(const void* pData, size_t)
         return ERR_POINTER;
     }
 
-    // lock all currently mapped target buffers
-    // note: theres some optimization potential here:
-    //   -- rework the assignment container to be able to sort the assignments by target
-    //   -- lock only the current target during iteration over all assignments
-    // for now it is fast enough since the number of mapped targets isn't to high
-    for (TargetRefList::const_iterator it = _targets.begin(); it != _targets.end(); ++it) {
-        (*it)->aquireWriteLock();
-    }
-
-    // write true into all received(<this_signal>) assignments
-    bool bValue = true;
-    for (TargetElementList::iterator it = _received_elements.begin();
-         it != _received_elements.end();
-         it++) {
-        (*it)->setValue(&bValue, e_bool, sizeof(bValue));
-    }
+    std::shared_ptr<const Program> pProgram;
+    {
+        // the assignments are switched by an update of the configuration only between two
+        // samples, so a sample is written with either the previous or the new assignments
+        std::shared_lock<a_util::concurrency::shared_mutex> oSampleLock(_program_mutex);
+        pProgram = _program;
+
+        // lock all currently mapped target buffers
+        // note: theres some optimization potential here:
+        //   -- rework the assignment container to be able to sort the assignments by target
+        //   -- lock only the current target during iteration over all assignments
+        // for now it is fast enough since the number of mapped targets isn't to high
+        TargetWriteLocks oTargetLocks(pProgram->targets);
+
+        // write true into all received(<this_signal>) assignments
+        bool bValue = true;
+        for (TargetElementList::const_iterator it = pProgram->received_elements.begin();
+             it != pProgram->received_elements.end();
+             it++) {
+            (*it)->setValue(&bValue, e_bool, sizeof(bValue));
+        }
 
-    // write all assignments that stem from this source
-    for (Assignments::iterator itAssign = _assignments.begin(); itAssign != _assignments.end();
-         ++itAssign) {
-        void* pValue = (void*)((uintptr_t)pData + itAssign->first.element_ptr_offset);
+        // write all assignments that stem from this source
+        for (Assignments::const_iterator itAssign = pProgram->assignments.begin();
+             itAssign != pProgram->assignments.end();
+             ++itAssign) {
+            void* pValue = (void*)((uintptr_t)pData + itAssign->first.element_ptr_offset);
 
-        const std::vector<TargetElement*>& vecElements = itAssign->second;
-        uint32_t type32 = itAssign->first.type32;
-        size_t buffer_size = itAssign->first.buffer_size;
+            const std::vector<TargetElement*>& vecElements = itAssign->second;
+            uint32_t type32 = itAssign->first.type32;
+            size_t buffer_size = itAssign->first.buffer_size;
 
-        for (size_t idx = 0; idx < vecElements.size(); ++idx) {
-            vecElements[idx]->setValue(pValue, type32, buffer_size);
+            for (size_t idx = 0; idx < vecElements.size(); ++idx) {
+                vecElements[idx]->setValue(pValue, type32, buffer_size);
+            }
         }
     }
 
-    // unlock all currently mapped target buffers
-    for (TargetRefList::const_iterator it = _targets.begin(); it != _targets.end(); ++it) {
-        (*it)->releaseWriteLock();
+    // the triggers call back into the environment, which must not happen under the lock: an
+    // update waiting for the lock blocks new samples of this source, a callback waiting for one
+    // of them would deadlock
+    for (SignalTriggers::const_iterator it = pProgram->signal_triggers.begin();
+         it != pProgram->signal_triggers.end();
+         ++it) {
+        (*it)->transmit();
     }
 
-    // call signal triggers
-    for (Triggers::iterator it = _triggers.begin(); it != _triggers.end(); it++) {
-        SignalTrigger* pSigTrigger = dynamic_cast<SignalTrigger*>(it->first);
-        DataTrigger* pDataTrigger = dynamic_cast<DataTrigger*>(it->first);
-        if (pSigTrigger) {
-            pSigTrigger->transmit();
-        }
-        else if (pDataTrigger) {
-            // read the current value and cast it into a float64
-            double f64Val = 0;
-            void* pValue = (void*)((uintptr_t)pData + it->second.element_ptr_offset);
-            switch (it->second.type32) {
-            case e_uint8:
-                f64Val = *(static_cast<uint8_t*>(pValue));
-                break;
-            case e_uint16:
-                f64Val = *(static_cast<uint16_t*>(pValue));
-                break;
-            case e_uint32:
-                f64Val = *(static_cast<uint32_t*>(pValue));
-                break;
-            case e_uint64:
-                f64Val = static_cast<double>(*(static_cast<uint64_t*>(pValue)));
-                break;
-            case e_int8:
-                f64Val = *(static_cast<int8_t*>(pValue));
-                break;
-            case e_int16:
-                f64Val = *(static_cast<int16_t*>(pValue));
-                break;
-            case e_int32:
-                f64Val = *(static_cast<int32_t*>(pValue));
-                break;
-            case e_int64:
-                f64Val = static_cast<double>(*(static_cast<int64_t*>(pValue)));
-                break;
-            case e_float32:
-                f64Val = *(static_cast<float*>(pValue));
-                break;
-            case e_float64:
-                f64Val = *(static_cast<double*>(pValue));
-                break;
-            case e_bool:
-                f64Val = *(static_cast<bool*>(pValue));
-                break;
-            case e_char:
-                f64Val = *(static_cast<char*>(pValue));
-                break;
-            default:
-                assert(false);
-                break;
-            }
-
-            // compare/interpret the operator comparison
-            if (pDataTrigger->compare(f64Val)) {
-                pDataTrigger->transmit();
-            }
+    // call data triggers whose compiled comparison is fulfilled by the current value
+    for (DataTriggers::const_iterator it = pProgram->data_triggers.begin();
+         it != pProgram->data_triggers.end();
+         ++it) {
+        if (it->first->compare(static_cast<const uint8_t*>(pData) + it->second)) {
+            it->first->transmit();
         }
     }
 
@@ -9,6 +9,7 @@
  */
 
 #include <a_util/result/error_def.h>
+#include <ddl/codec/codec_factory_cache.h>
 #include <ddl/codec/legacy/access_element.h>
 #include <ddl/legacy_error_macros.h>
 #include <ddl/mapping/configuration/map_configuration.h>
@@ -31,18 +32,21 @@ _MAKE_RESULT(-20, ERR_INVALID_ELEMENT);
 using namespace ddl::mapping;
 using namespace ddl::mapping::rt;
 
-Target::Target(IMappingEnvironment& oEnv) : _counter(0), _env(oEnv)
+Target::Program::~Program()
+{
+    for (TargetElementList::iterator it = target_elements.begin(); it != target_elements.end();
+         ++it) {
+        delete *it;
+    }
+}
+
+Target::Target(IMappingEnvironment& oEnv)
+    : _program(std::make_unique<Program>()), _counter(0), _env(oEnv)
 {
 }
 
 Target::~Target()
 {
-    for (TargetElementList::iterator it = _target_elements.begin(); it != _target_elements.end();
-         ++it) {
-        delete *it;
-    }
-    _target_elements.clear();
-    _simulation_time_elements.clear();
 }
 
 a_util::result::Result Target::create(const MapConfiguration& oMapConfig,
@@ -52,7 +56,9 @@ a_util::result::Result Target::create(const MapConfiguration& oMapConfig,
 {
     _name = oMapTarget.getName();
     _type_name = oMapTarget.getType();
-    ddl::codec::CodecFactory oFactory(_type_name.c_str(), strTargetDescription.c_str());
+    _type_description = strTargetDescription;
+    const auto oFactory = ddl::codec::CodecFactoryCache::getGlobalCache().getFactory(
+        _type_name, strTargetDescription);
     RETURN_IF_FAILED(oFactory.isValid());
 
     // Alloc and zero memory
@@ -62,6 +68,48 @@ a_util::result::Result Target::create(const MapConfiguration& oMapConfig,
     _codec = std::make_unique<ddl::codec::StaticCodec>(
         oFactory.makeStaticCodecFor(&_buffer[0], _buffer.size()));
 
+    RETURN_IF_FAILED(createProgram(oMapConfig, oMapTarget, oSources, *_program));
+
+    // initialize memory
+    RETURN_IF_FAILED(reset(oMapConfig));
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result Target::beginUpdate(const MapConfiguration& oMapConfig,
+                                           const MapTarget& oMapTarget,
+                                           SourceMap& oSources)
+{
+    _update_program = std::make_unique<Program>();
+    return createProgram(oMapConfig, oMapTarget, oSources, *_update_program);
+}
+
+a_util::result::Result Target::commitUpdate()
+{
+    if (!_update_program) {
+        return a_util::result::SUCCESS;
+    }
+    std::swap(_program, _update_program);
+
+    // the values of the buffer are kept, only the constants of the new configuration are set
+    for (Constants::iterator it = _program->constant_elements.begin();
+         it != _program->constant_elements.end();
+         it++) {
+        RETURN_IF_FAILED(it->second->setDefaultValue(it->first));
+    }
+    return a_util::result::SUCCESS;
+}
+
+void Target::endUpdate()
+{
+    _update_program.reset();
+}
+
+a_util::result::Result Target::createProgram(const MapConfiguration& oMapConfig,
+                                             const MapTarget& oMapTarget,
+                                             SourceMap& oSources,
+                                             Program& oProgram)
+{
     // this works only because datamodel was set via dd::DataDefintion which calculated the TypeInfo
     const auto struct_type_access =
         dd::StructTypeAccess(oMapConfig.getDD()->getStructTypes().get(_type_name));
@@ -116,18 +164,19 @@ a_util::result::Result Target::create(const MapConfiguration& oMapConfig,
 
         // If a constant is given, there can be no transformation
         if (!itAssignment->getConstant().empty()) {
-            _constant_elements.push_back(make_pair(itAssignment->getConstant(), pElement.get()));
+            oProgram.constant_elements.push_back(
+                make_pair(itAssignment->getConstant(), pElement.get()));
         }
         else if (!itAssignment->getFunction().empty()) {
             if (itAssignment->getFunction() == "simulation_time") {
-                _simulation_time_elements.push_back(pElement.get());
+                oProgram.simulation_time_elements.push_back(pElement.get());
             }
             else if (itAssignment->getFunction() == "trigger_counter") {
                 uint64_t nMod = 0;
                 if (!itAssignment->getModulo().empty()) {
                     nMod = a_util::strings::toUInt64(itAssignment->getModulo());
                 }
-                _counter_elements.push_back(std::make_pair(nMod, pElement.get()));
+                oProgram.counter_elements.push_back(std::make_pair(nMod, pElement.get()));
             }
             else if (itAssignment->getFunction() == "received") {
                 // Add assignments to source
@@ -159,12 +208,9 @@ a_util::result::Result Target::create(const MapConfiguration& oMapConfig,
                 oMapConfig, itAssignment->getFrom(), pElement.get()));
         }
 
-        _target_elements.push_back(pElement.release());
+        oProgram.target_elements.push_back(pElement.release());
     }
 
-    // initialize memory
-    RETURN_IF_FAILED(reset(oMapConfig));
-
     return a_util::result::SUCCESS;
 }
 
@@ -185,7 +231,8 @@ a_util::result::Result Target::reset(const MapConfiguration& oMapConfig)
 
     // Set constant elements from the map configuration
     if (nResult) {
-        for (Constants::iterator it = _constant_elements.begin(); it != _constant_elements.end();
+        for (Constants::iterator it = _program->constant_elements.begin();
+             it != _program->constant_elements.end();
              it++) {
             nResult = it->second->setDefaultValue(it->first);
         }
@@ -203,9 +250,14 @@ const std::string& Target::getTypeName() const
     return _type_name;
 }
 
+const std::string& Target::getTypeDescription() const
+{
+    return _type_description;
+}
+
 const TargetElementList& Target::getElementList() const
 {
-    return _target_elements;
+    return _program->target_elements;
 }
 
 size_t Target::getSize() const
@@ -217,8 +269,9 @@ a_util::result::Result Target::updateAccessFunctionValues()
 {
     // set simulation time for simulation_time assignments
     timestamp_t tmTime = _env.getTime();
-    for (std::vector<TargetElement*>::const_iterator it = _simulation_time_elements.begin();
-         it != _simulation_time_elements.end();
+    for (std::vector<TargetElement*>::const_iterator it =
+             _program->simulation_time_elements.begin();
+         it != _program->simulation_time_elements.end();
          it++) {
         (*it)->setValue(&tmTime, e_int64, sizeof(timestamp_t));
     }
@@ -232,8 +285,8 @@ a_util::result::Result Target::updateTriggerFunctionValues()
     _counter++;
 
     // write counter into trigger_counter assignments
-    for (TriggerCounters::const_iterator it = _counter_elements.begin();
-         it != _counter_elements.end();
+    for (TriggerCounters::const_iterator it = _program->counter_elements.begin();
+         it != _program->counter_elements.end();
          it++) {
         uint64_t nValue = _counter;
         if (it->first != 0) {
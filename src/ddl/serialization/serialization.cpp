@@ -17,25 +17,49 @@ namespace codec {
 // define all needed error types and values locally
 _MAKE_RESULT(-12, ERR_MEMORY);
 
-a_util::result::Result transformToBuffer(const codec::Decoder& decoder,
-                                         a_util::memory::MemoryBuffer& buffer,
-                                         bool zero)
+namespace {
+template <typename ALLOCATE>
+a_util::result::Result transformToAllocatedBuffer(const codec::Decoder& decoder,
+                                                  a_util::memory::MemoryBuffer& buffer,
+                                                  bool zero,
+                                                  ALLOCATE allocate)
 {
     DataRepresentation target_rep =
         decoder.getRepresentation() == deserialized ? serialized : deserialized;
     size_t needed_size = decoder.getBufferSize(target_rep);
     if (buffer.getSize() < needed_size) {
-        if (!buffer.allocate(needed_size)) {
+        if (!allocate(needed_size)) {
             return ERR_MEMORY;
         }
     }
-
-    if (zero) {
+    else if (zero) {
+        // a newly allocated buffer is zero-initialized already
         a_util::memory::set(buffer.getPtr(), buffer.getSize(), 0, buffer.getSize());
     }
     codec::Codec codec = decoder.makeCodecFor(buffer.getPtr(), buffer.getSize(), target_rep);
     return transform(decoder, codec);
 }
+} // namespace
+
+a_util::result::Result transformToBuffer(const codec::Decoder& decoder,
+                                         a_util::memory::MemoryBuffer& buffer,
+                                         bool zero)
+{
+    return transformToAllocatedBuffer(decoder, buffer, zero, [&buffer](size_t needed_size) {
+        return buffer.allocate(needed_size);
+    });
+}
+
+a_util::result::Result transformToBuffer(const codec::Decoder& decoder,
+                                         a_util::memory::MemoryBuffer& buffer,
+                                         a_util::memory::MemoryBufferPool& pool,
+                                         bool zero)
+{
+    return transformToAllocatedBuffer(
+        decoder, buffer, zero, [&buffer, &pool](size_t needed_size) {
+            return buffer.allocate(needed_size, pool);
+        });
+}
 
 } // namespace codec
 
@@ -0,0 +1,132 @@
+/**
+ * @file
+ * Implementation of the arena allocation of the datamodel items
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "dd_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace ddl {
+namespace dd {
+namespace utility {
+
+namespace {
+/// the arena of the innermost ArenaScope of this thread
+thread_local const std::shared_ptr<MonotonicArena>* current_arena = nullptr;
+
+size_t getPadding(const char* position, size_t alignment)
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(position);
+    return (alignment - (address & (alignment - 1))) & (alignment - 1);
+}
+
+char* alignUp(char* position, size_t alignment)
+{
+    return position + getPadding(position, alignment);
+}
+} // namespace
+
+struct MonotonicArena::Block {
+    Block* previous;
+};
+
+MonotonicArena::MonotonicArena(size_t block_size)
+    : _block_size(std::max<size_t>(block_size, 1024))
+{
+}
+
+MonotonicArena::~MonotonicArena()
+{
+    while (_blocks) {
+        Block* const previous = _blocks->previous;
+        ::operator delete(_blocks);
+        _blocks = previous;
+    }
+}
+
+void* MonotonicArena::allocate(size_t size, size_t alignment)
+{
+    if (_position) {
+        // the padding may exceed the rest of the block, never form a pointer behind its end
+        const size_t padding = getPadding(_position, alignment);
+        const size_t available = static_cast<size_t>(_end - _position);
+        if (padding <= available && size <= available - padding) {
+            char* const aligned = _position + padding;
+            _position = aligned + size;
+            ++_allocation_count;
+            _allocated_size += size;
+            return aligned;
+        }
+    }
+    return allocateBlock(size, alignment);
+}
+
+void* MonotonicArena::allocateBlock(size_t size, size_t alignment)
+{
+    const size_t required_size = sizeof(Block) + alignment + size;
+    // huge items get a block of their own, the current block stays in use
+    const bool own_block = required_size > _block_size / 4;
+    const size_t block_size = own_block ? required_size : _block_size;
+    auto* const block = static_cast<Block*>(::operator new(block_size));
+    _reserved_size += block_size;
+    char* const block_begin = reinterpret_cast<char*>(block) + sizeof(Block);
+    char* const aligned = alignUp(block_begin, alignment);
+    if (own_block && _blocks) {
+        block->previous = _blocks->previous;
+        _blocks->previous = block;
+    }
+    else {
+        block->previous = _blocks;
+        _blocks = block;
+        _position = aligned + size;
+        _end = reinterpret_cast<char*>(block) + block_size;
+    }
+    ++_allocation_count;
+    _allocated_size += size;
+    return aligned;
+}
+
+size_t MonotonicArena::getAllocationCount() const
+{
+    return _allocation_count;
+}
+
+size_t MonotonicArena::getAllocatedSize() const
+{
+    return _allocated_size;
+}
+
+size_t MonotonicArena::getReservedSize() const
+{
+    return _reserved_size;
+}
+
+ArenaScope::ArenaScope(std::shared_ptr<MonotonicArena> arena)
+    : _arena(std::move(arena)), _enclosing_arena(current_arena)
+{
+    current_arena = &_arena;
+}
+
+ArenaScope::~ArenaScope()
+{
+    current_arena = _enclosing_arena;
+}
+
+const std::shared_ptr<MonotonicArena>& ArenaScope::getCurrentArena()
+{
+    static const std::shared_ptr<MonotonicArena> no_arena;
+    return current_arena ? *current_arena : no_arena;
+}
+
+} // namespace utility
+} // namespace dd
+} // namespace ddl
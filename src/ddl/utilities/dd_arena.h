@@ -0,0 +1,240 @@
+/**
+ * @file
+ * Private arena allocation of the datamodel items, not part of the installed API
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef DD_DD_ARENA_H_INCLUDED
+#define DD_DD_ARENA_H_INCLUDED
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ddl {
+namespace dd {
+namespace utility {
+
+/**
+ * @brief Monotonic arena: Allocates from large blocks by incrementing a position, single
+ * deallocations are ignored and all blocks are released together in the DTOR.
+ * @remark The arena is not thread-safe, it must only be used by one thread at a time.
+ */
+class MonotonicArena {
+public:
+    /// the default size of the blocks, small enough to be reused by the heap after release
+    static constexpr size_t default_block_size = 64 * 1024;
+
+    /**
+     * @brief CTOR
+     *
+     * @param block_size the size of the blocks to allocate from
+     */
+    explicit MonotonicArena(size_t block_size = default_block_size);
+    /**
+     * @brief DTOR, releases all memory allocated from the arena
+     */
+    ~MonotonicArena();
+    /// no copy CTOR
+    MonotonicArena(const MonotonicArena&) = delete;
+    /// no copy assignment
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * @brief allocates memory from the current block or a new block
+     *
+     * @param size the size in bytes
+     * @param alignment the alignment, a power of two
+     * @return void* the allocated memory
+     * @throws std::bad_alloc if no new block could be allocated
+     */
+    void* allocate(size_t size, size_t alignment);
+    /**
+     * @brief Get the amount of allocations
+     *
+     * @return size_t
+     */
+    size_t getAllocationCount() const;
+    /**
+     * @brief Get the amount of bytes handed out by @ref allocate
+     *
+     * @return size_t
+     */
+    size_t getAllocatedSize() const;
+    /**
+     * @brief Get the amount of bytes of all blocks
+     *
+     * @return size_t
+     */
+    size_t getReservedSize() const;
+
+private:
+    struct Block;
+    void* allocateBlock(size_t size, size_t alignment);
+
+    Block* _blocks = nullptr;
+    char* _position = nullptr;
+    char* _end = nullptr;
+    const size_t _block_size;
+    size_t _allocation_count = 0;
+    size_t _allocated_size = 0;
+    size_t _reserved_size = 0;
+};
+
+/**
+ * @brief Allocator allocating from a @ref MonotonicArena.
+ * Every copy of the allocator shares the ownership of the arena, so items allocated with
+ * @c std::allocate_shared keep the arena alive.
+ *
+ * @tparam T the value type
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    /// local definition of the value type
+    typedef T value_type;
+
+    /**
+     * @brief CTOR
+     *
+     * @param arena the arena to allocate from
+     */
+    explicit ArenaAllocator(std::shared_ptr<MonotonicArena> arena) noexcept
+        : _arena(std::move(arena))
+    {
+    }
+    /**
+     * @brief rebinding copy CTOR
+     *
+     * @param other the allocator of another value type
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : _arena(other.getArena())
+    {
+    }
+    /**
+     * @brief allocates memory for \p count values
+     *
+     * @param count the amount of values
+     * @return T* the allocated memory
+     */
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+    /**
+     * @brief does nothing, the memory is released with the arena
+     */
+    void deallocate(T*, size_t) noexcept
+    {
+    }
+    /**
+     * @brief Get the Arena
+     *
+     * @return const std::shared_ptr<MonotonicArena>&
+     */
+    const std::shared_ptr<MonotonicArena>& getArena() const noexcept
+    {
+        return _arena;
+    }
+
+private:
+    std::shared_ptr<MonotonicArena> _arena;
+};
+
+/**
+ * @brief compares the arenas of two allocators
+ * @return true if both allocate from the same arena
+ */
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.getArena() == rhs.getArena();
+}
+
+/**
+ * @brief compares the arenas of two allocators
+ * @return true if the allocators allocate from different arenas
+ */
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Activates the arena allocation mode for the current thread.
+ * While the scope exists the datamodel items created with @ref makeShared by this thread (the
+ * datamodel itself, its header, the type and validation infos) are allocated from the given arena
+ * instead of one heap allocation each. The items share the ownership of the arena, so the arena
+ * is released with the last item of the datamodel. The types and elements held by the public
+ * access containers are always allocated on the heap.
+ * @code
+ * dd::DataDefinition dd;
+ * {
+ *     dd::utility::ArenaScope arena_scope(std::make_shared<dd::utility::MonotonicArena>());
+ *     dd = DDString::fromXMLString(large_description);
+ * }
+ * @endcode
+ * @remark Memory of items removed from the datamodel is not reused until the arena is released,
+ *         so the mode is meant for datamodels which are read once and changed rarely.
+ * @remark Scopes may be nested, the innermost one is used.
+ */
+class ArenaScope {
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param arena the arena to allocate from, nullptr to use the heap within this scope
+     */
+    explicit ArenaScope(std::shared_ptr<MonotonicArena> arena);
+    /**
+     * @brief DTOR, reactivates the arena of the enclosing scope
+     */
+    ~ArenaScope();
+    /// no copy CTOR
+    ArenaScope(const ArenaScope&) = delete;
+    /// no copy assignment
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    /**
+     * @brief Get the arena of the innermost scope of the current thread
+     *
+     * @return const std::shared_ptr<MonotonicArena>& the arena or nullptr if no arena is active
+     */
+    static const std::shared_ptr<MonotonicArena>& getCurrentArena();
+
+private:
+    std::shared_ptr<MonotonicArena> _arena;
+    const std::shared_ptr<MonotonicArena>* _enclosing_arena;
+};
+
+/**
+ * @brief creates a shared item in the arena of the current @ref ArenaScope, or on the heap like
+ * @c std::make_shared if no arena is active.
+ *
+ * @tparam T the type of the item
+ * @tparam Args the CTOR argument types
+ * @param args the CTOR arguments
+ * @return std::shared_ptr<T>
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> makeShared(Args&&... args)
+{
+    const auto& arena = ArenaScope::getCurrentArena();
+    if (arena) {
+        return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+} // namespace utility
+} // namespace dd
+} // namespace ddl
+
+#endif // DD_DD_ARENA_H_INCLUDED
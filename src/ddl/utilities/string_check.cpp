@@ -11,7 +11,7 @@
 
 #include <ddl/utilities/string_check.h>
 
-#include <regex>
+#include <algorithm>
 
 namespace ddl {
 namespace dd {
@@ -19,8 +19,17 @@ namespace utility {
 
 bool isInteger(const std::string& string_to_check)
 {
-    static const std::regex numeric_integer_check("^-{0,1}(\\d)+");
-    return std::regex_match(string_to_check, numeric_integer_check);
+    // like matching "^-{0,1}(\d)+", without the allocations of std::regex
+    auto current = string_to_check.cbegin();
+    if (current != string_to_check.cend() && *current == '-') {
+        ++current;
+    }
+    if (current == string_to_check.cend()) {
+        return false;
+    }
+    return std::all_of(current, string_to_check.cend(), [](char character) {
+        return character >= '0' && character <= '9';
+    });
 }
 
 } // namespace utility
@@ -9,7 +9,7 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
-#include <a_util/datetime/datetime.h>
+#include <a_util/datetime/clock.h>
 #include <a_util/filesystem.h>
 #include <a_util/logging/log.h>
 
@@ -34,7 +34,7 @@ void addEntry(const LogEntry& entry)
 void addEntry(std::uint8_t log_level, const std::string& message, const std::string& source)
 {
     LogEntry entry;
-    entry.time_stamp = a_util::datetime::getCurrentLocalDateTime().toTimestamp();
+    entry.time_stamp = a_util::datetime::getCurrentLocalTimestamp();
     entry.log_level = log_level;
     entry.message = message;
     entry.source = source;
@@ -53,10 +53,9 @@ Logger getLogger()
 
 std::string defaultFormat(const LogEntry& entry)
 {
-    a_util::datetime::DateTime oTime;
-    oTime.set(entry.time_stamp);
-
-    std::string log_msg = oTime.format("%Y-%m-%d %H:%M:%S ");
+    // the date and time is rendered once per second and thread
+    thread_local a_util::datetime::TimestampFormatter formatter("%Y-%m-%d %H:%M:%S ");
+    std::string log_msg = formatter.format(entry.time_stamp);
 
     if (entry.log_level <= Error) {
         log_msg += "[ERROR]";
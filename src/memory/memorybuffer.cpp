@@ -9,6 +9,8 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "memorybuffer_pool_impl.h"
+
 #include <a_util/memory.h>
 
 namespace a_util {
@@ -18,9 +20,25 @@ struct MemoryBuffer::Implementation {
     std::uint8_t* buffer;
     std::size_t size;
     bool owned;
+    // the pool and the size class of the buffer if allocated from a pool
+    std::shared_ptr<MemoryBufferPool::Implementation> pool;
+    std::size_t capacity;
+
+    Implementation() : buffer(nullptr), size(0), owned(true), capacity(0)
+    {
+    }
 
-    Implementation() : buffer(nullptr), size(0), owned(true)
+    void release()
     {
+        if (pool) {
+            pool->release(buffer, capacity);
+            pool.reset();
+            capacity = 0;
+        }
+        else if (owned && buffer) {
+            delete[] buffer;
+        }
+        buffer = nullptr;
     }
 };
 
@@ -38,6 +56,12 @@ MemoryBuffer::MemoryBuffer(void* buffer, std::size_t size) : _impl(new Implement
     attach(buffer, size);
 }
 
+MemoryBuffer::MemoryBuffer(std::size_t initial_size, MemoryBufferPool& pool)
+    : _impl(new Implementation())
+{
+    allocate(initial_size, pool);
+}
+
 MemoryBuffer& MemoryBuffer::operator=(const MemoryBuffer& other)
 {
     if (this != &other) {
@@ -64,11 +88,7 @@ MemoryBuffer::MemoryBuffer(const MemoryBuffer& other) : _impl(new Implementation
 
 bool MemoryBuffer::allocate(std::size_t new_size)
 {
-    if (_impl->owned && _impl->buffer) {
-        delete[] _impl->buffer;
-    }
-
-    _impl->buffer = nullptr;
+    _impl->release();
     _impl->size = new_size;
     _impl->owned = true;
 
@@ -83,6 +103,31 @@ bool MemoryBuffer::allocate(std::size_t new_size)
     return true;
 }
 
+bool MemoryBuffer::allocate(std::size_t new_size, MemoryBufferPool& pool)
+{
+    if (new_size == 0) {
+        reset();
+        return true;
+    }
+
+    const std::size_t capacity = pool._impl->getCapacity(new_size);
+    // keep the current buffer if it fits and at most half of it stays unused
+    if (_impl->pool != pool._impl || _impl->capacity < new_size || _impl->capacity / 2 > capacity) {
+        // the current buffer is released first to be reused if it has the same size class
+        reset();
+        _impl->buffer = static_cast<std::uint8_t*>(pool._impl->acquire(capacity));
+        if (!_impl->buffer) {
+            return false;
+        }
+        _impl->pool = pool._impl;
+        _impl->capacity = capacity;
+    }
+    _impl->size = new_size;
+    _impl->owned = true;
+    set(_impl->buffer, new_size, 0, new_size);
+    return true;
+}
+
 void MemoryBuffer::reset()
 {
     allocate(0);
@@ -0,0 +1,239 @@
+/**
+ * @file
+ * Memory buffer pool implementation
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "memorybuffer_pool_impl.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace a_util {
+namespace memory {
+namespace {
+// size of the huge pages and of the pages the mapped buffers are aligned to at least
+constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+constexpr std::size_t page_size = 4096;
+
+std::size_t roundUp(std::size_t size, std::size_t step)
+{
+    return (size + step - 1) & ~(step - 1);
+}
+
+std::size_t floorPowerOfTwo(std::size_t value)
+{
+    std::size_t power = 1;
+    while (power <= value / 2) {
+        power *= 2;
+    }
+    return power;
+}
+} // namespace
+
+constexpr std::size_t MemoryBufferPool::default_alignment;
+constexpr std::size_t MemoryBufferPool::default_huge_page_threshold;
+constexpr std::size_t MemoryBufferPool::default_max_cached_buffers;
+
+MemoryBufferPool::Implementation::Implementation(std::size_t alignment,
+                                                 HugePages huge_pages,
+                                                 std::size_t huge_page_threshold,
+                                                 std::size_t max_cached_buffers)
+    : alignment(alignment),
+      _huge_pages(huge_pages),
+      _huge_page_threshold(huge_page_threshold),
+      _max_cached_buffers(max_cached_buffers),
+      _cached_size(0)
+{
+}
+
+MemoryBufferPool::Implementation::~Implementation()
+{
+    shrink();
+}
+
+std::size_t MemoryBufferPool::Implementation::getCapacity(std::size_t size) const
+{
+    // four size classes per power of two, so at most a quarter of a buffer is unused
+    const std::size_t aligned_size = roundUp(size, alignment);
+    const std::size_t step = std::max(alignment, floorPowerOfTwo(aligned_size - 1) / 4);
+    const std::size_t capacity = roundUp(aligned_size, step);
+    return isMapped(capacity) ? roundUp(capacity, huge_page_size) : capacity;
+}
+
+void* MemoryBufferPool::Implementation::acquire(std::size_t capacity)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto cached_buffers = _cached_buffers.find(capacity);
+        if (cached_buffers != _cached_buffers.end() && !cached_buffers->second.empty()) {
+            void* const buffer = cached_buffers->second.back();
+            cached_buffers->second.pop_back();
+            _cached_size -= capacity;
+            return buffer;
+        }
+    }
+    return allocateBuffer(capacity);
+}
+
+void MemoryBufferPool::Implementation::release(void* buffer, std::size_t capacity)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& cached_buffers = _cached_buffers[capacity];
+        if (cached_buffers.size() < _max_cached_buffers) {
+            cached_buffers.push_back(buffer);
+            _cached_size += capacity;
+            return;
+        }
+    }
+    freeBuffer(buffer, capacity);
+}
+
+std::size_t MemoryBufferPool::Implementation::getCachedSize() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cached_size;
+}
+
+void MemoryBufferPool::Implementation::shrink()
+{
+    std::map<std::size_t, std::vector<void*>> cached_buffers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        cached_buffers.swap(_cached_buffers);
+        _cached_size = 0;
+    }
+    for (const auto& size_class: cached_buffers) {
+        for (void* buffer: size_class.second) {
+            freeBuffer(buffer, size_class.first);
+        }
+    }
+}
+
+bool MemoryBufferPool::Implementation::isMapped(std::size_t capacity) const
+{
+#ifdef __linux__
+    return _huge_pages != HugePages::none && capacity >= _huge_page_threshold &&
+           alignment <= page_size;
+#else
+    (void)capacity;
+    return false;
+#endif
+}
+
+void* MemoryBufferPool::Implementation::allocateBuffer(std::size_t capacity) const
+{
+#ifdef __linux__
+    if (isMapped(capacity)) {
+        void* buffer = MAP_FAILED;
+        if (_huge_pages == HugePages::hugetlb) {
+            buffer = ::mmap(nullptr,
+                            capacity,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                            -1,
+                            0);
+        }
+        if (buffer == MAP_FAILED) {
+            // transparent huge pages need a huge page aligned range, so cut it from a larger one
+            const std::size_t mapped_size = capacity + huge_page_size;
+            buffer = ::mmap(
+                nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (buffer == MAP_FAILED) {
+                return nullptr;
+            }
+            char* const mapped = static_cast<char*>(buffer);
+            char* const aligned = mapped + (roundUp(reinterpret_cast<std::uintptr_t>(mapped),
+                                                    huge_page_size) -
+                                            reinterpret_cast<std::uintptr_t>(mapped));
+            if (aligned != mapped) {
+                ::munmap(mapped, aligned - mapped);
+            }
+            ::munmap(aligned + capacity, mapped + mapped_size - (aligned + capacity));
+            ::madvise(aligned, capacity, MADV_HUGEPAGE);
+            buffer = aligned;
+        }
+        return buffer;
+    }
+#endif
+#ifdef _WIN32
+    return ::_aligned_malloc(capacity, alignment);
+#else
+    void* buffer = nullptr;
+    if (::posix_memalign(&buffer, std::max(alignment, sizeof(void*)), capacity) != 0) {
+        return nullptr;
+    }
+    return buffer;
+#endif
+}
+
+void MemoryBufferPool::Implementation::freeBuffer(void* buffer, std::size_t capacity) const
+{
+#ifdef __linux__
+    if (isMapped(capacity)) {
+        ::munmap(buffer, capacity);
+        return;
+    }
+#else
+    (void)capacity;
+#endif
+#ifdef _WIN32
+    ::_aligned_free(buffer);
+#else
+    std::free(buffer);
+#endif
+}
+
+MemoryBufferPool::MemoryBufferPool(std::size_t alignment,
+                                   HugePages huge_pages,
+                                   std::size_t huge_page_threshold,
+                                   std::size_t max_cached_buffers)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("alignment is not a power of two");
+    }
+    _impl = std::make_shared<Implementation>(
+        alignment, huge_pages, huge_page_threshold, max_cached_buffers);
+}
+
+MemoryBufferPool::~MemoryBufferPool()
+{
+    // the buffers in use keep the implementation alive, the released ones are not needed anymore
+    _impl->shrink();
+}
+
+std::size_t MemoryBufferPool::getAlignment() const
+{
+    return _impl->alignment;
+}
+
+std::size_t MemoryBufferPool::getCapacity(std::size_t size) const
+{
+    return size == 0 ? 0 : _impl->getCapacity(size);
+}
+
+std::size_t MemoryBufferPool::getCachedSize() const
+{
+    return _impl->getCachedSize();
+}
+
+void MemoryBufferPool::shrink()
+{
+    _impl->shrink();
+}
+
+} // namespace memory
+} // namespace a_util
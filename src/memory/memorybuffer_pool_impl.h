@@ -0,0 +1,74 @@
+/**
+ * @file
+ * Implementation class of the memory buffer pool, shared by the pool and the buffers allocated
+ * from it.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef A_UTIL_UTIL_MEMORY_DETAIL_MEMORYBUFFER_POOL_IMPL_HEADER_INCLUDED
+#define A_UTIL_UTIL_MEMORY_DETAIL_MEMORYBUFFER_POOL_IMPL_HEADER_INCLUDED
+
+#include <a_util/memory/memorybuffer_pool.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace a_util {
+namespace memory {
+class MemoryBufferPool::Implementation {
+public:
+    Implementation(std::size_t alignment,
+                   HugePages huge_pages,
+                   std::size_t huge_page_threshold,
+                   std::size_t max_cached_buffers);
+    ~Implementation();
+
+    /**
+     * Get the size class of a buffer
+     * @param[in] size The requested size, greater than zero
+     * @return The capacity of the buffers of the size class
+     */
+    std::size_t getCapacity(std::size_t size) const;
+
+    /**
+     * Reuse a released buffer of the size class or allocate a new one
+     * @param[in] capacity The capacity as returned by @ref getCapacity
+     * @return The buffer or @c nullptr if no memory is available
+     */
+    void* acquire(std::size_t capacity);
+
+    /**
+     * Keep a buffer for reuse or free it if enough buffers of its size class are kept
+     * @param[in] buffer The buffer returned by @ref acquire
+     * @param[in] capacity The capacity of the buffer
+     */
+    void release(void* buffer, std::size_t capacity);
+
+    std::size_t getCachedSize() const;
+    void shrink();
+
+    const std::size_t alignment;
+
+private:
+    void* allocateBuffer(std::size_t capacity) const;
+    void freeBuffer(void* buffer, std::size_t capacity) const;
+    bool isMapped(std::size_t capacity) const;
+
+    const HugePages _huge_pages;
+    const std::size_t _huge_page_threshold;
+    const std::size_t _max_cached_buffers;
+    mutable std::mutex _mutex;
+    std::map<std::size_t, std::vector<void*>> _cached_buffers;
+    std::size_t _cached_size;
+};
+
+} // namespace memory
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_MEMORY_DETAIL_MEMORYBUFFER_POOL_IMPL_HEADER_INCLUDED
@@ -20,8 +20,13 @@
 #include <stdexcept>
 #endif
 
+#include <errno.h>
+#include <fcntl.h>
 #include <malloc.h>
+#include <poll.h>
 #include <pwd.h>
+#include <signal.h>
+#include <spawn.h>
 #include <stdlib.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
@@ -41,74 +46,302 @@
 #include <a_util/strings/strings_format.h>
 #include <a_util/system/system.h>
 
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 29)
+#define A_UTIL_PROCESS_SPAWN_CHDIR
+#endif
+#endif
+
+extern char** environ;
+
 namespace a_util {
 namespace process {
-namespace detail {
-uint32_t execute(const a_util::filesystem::Path& executable_file,
-                 const std::string& arguments,
-                 const a_util::filesystem::Path& working_path,
-                 std::string& std_out,
-                 const a_util::filesystem::Path& temp_std_err_file)
+namespace {
+// convert the 8 bit return value into our 32 bit return value
+// (also check for negative return values!)
+uint32_t toExitCode(int status)
 {
-    a_util::filesystem::Path exe_path = executable_file;
-    a_util::filesystem::Path work_path = working_path;
+    uint32_t exit_status = static_cast<uint32_t>(
+        WIFSIGNALED(status) ? 128 + WTERMSIG(status) : WEXITSTATUS(status));
+    if (exit_status & 0x80) {
+        exit_status |= 0xFFFFFF00;
+    }
+    return exit_status;
+}
 
-    detail::preparePaths(exe_path, work_path);
+// both pipe ends are closed on exec, the child gets the write end as a duplicate
+bool createPipe(int (&fds)[2])
+{
+#ifdef __linux__
+    return ::pipe2(fds, O_CLOEXEC) == 0;
+#else
+    if (::pipe(fds) != 0) {
+        return false;
+    }
+    ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    return true;
+#endif
+}
 
-    std::string err_forward_arg;
-    if (!temp_std_err_file.isEmpty()) {
-        err_forward_arg = " 2>";
-        err_forward_arg += temp_std_err_file.toString();
+void closeFd(int& fd)
+{
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
     }
-    FILE* fd_pipe = nullptr;
+}
 
-    std::string call_command = a_util::strings::format("cd \"%s\" && %s %s%s",
-                                                       work_path.toString().c_str(),
-                                                       exe_path.toString().c_str(),
-                                                       arguments.c_str(),
-                                                       err_forward_arg.c_str());
-    fd_pipe = popen(call_command.c_str(), "r");
+/**
+ * Starts the process with posix_spawn, its standard out and error redirected to @c std_out_fd and
+ * @c std_err_fd. Without posix_spawn_file_actions_addchdir_np, a child changing the working
+ * directory is forked instead.
+ * @return The process id or -1 if the process could not be started.
+ */
+pid_t spawn(const char* file,
+            char* const* argv,
+            const std::string& working_dir,
+            int std_out_fd,
+            int std_err_fd)
+{
+#ifdef A_UTIL_PROCESS_SPAWN_CHDIR
+    const bool spawn_supported = true;
+#else
+    const bool spawn_supported = working_dir.empty();
+#endif
+    pid_t pid = -1;
+    if (spawn_supported) {
+        posix_spawn_file_actions_t file_actions;
+        if (::posix_spawn_file_actions_init(&file_actions) != 0) {
+            return -1;
+        }
+        int result = ::posix_spawn_file_actions_adddup2(&file_actions, std_out_fd, STDOUT_FILENO);
+        if (result == 0) {
+            result = ::posix_spawn_file_actions_adddup2(&file_actions, std_err_fd, STDERR_FILENO);
+        }
+#ifdef A_UTIL_PROCESS_SPAWN_CHDIR
+        if (result == 0 && !working_dir.empty()) {
+            result = ::posix_spawn_file_actions_addchdir_np(&file_actions, working_dir.c_str());
+        }
+#endif
+        if (result == 0) {
+            result = ::posix_spawnp(&pid, file, &file_actions, nullptr, argv, environ);
+        }
+        ::posix_spawn_file_actions_destroy(&file_actions);
+        return result == 0 ? pid : -1;
+    }
 
-    if (!fd_pipe) {
-        return 1;
+    // the child reports a failure before or of exec through this pipe, which a successful exec
+    // closes without any data
+    int error_pipe[2] = {-1, -1};
+    if (!createPipe(error_pipe)) {
+        return -1;
+    }
+    pid = ::fork();
+    if (pid == 0) {
+        // only async-signal-safe calls until exec
+        if (::dup2(std_out_fd, STDOUT_FILENO) >= 0 && ::dup2(std_err_fd, STDERR_FILENO) >= 0 &&
+            ::chdir(working_dir.c_str()) == 0) {
+            ::execvp(file, argv);
+        }
+        const int error = errno;
+        while (::write(error_pipe[1], &error, sizeof(error)) < 0 && errno == EINTR) {
+        }
+        ::_exit(127);
+    }
+    closeFd(error_pipe[1]);
+    if (pid > 0) {
+        int error = 0;
+        ssize_t read_size = 0;
+        while ((read_size = ::read(error_pipe[0], &error, sizeof(error))) < 0 && errno == EINTR) {
+        }
+        if (read_size > 0) {
+            int status = 0;
+            while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+            }
+            pid = -1;
+        }
     }
+    closeFd(error_pipe[0]);
+    return pid;
+}
 
-    char buf[1024];
-    while (fgets(buf, 1024, fd_pipe) != nullptr) {
-        std_out.append(buf);
+/**
+ * Reap the process if it has exited, without waiting for it.
+ * @return @c true if the process is gone, its exit status is stored in @c status then
+ */
+bool hasExited(pid_t pid, int& status)
+{
+    pid_t result = 0;
+    while ((result = ::waitpid(pid, &status, WNOHANG)) < 0 && errno == EINTR) {
     }
+    return result != 0;
+}
 
-    uint32_t exit_status = pclose(fd_pipe);
-    // convert the 8 bit return value into our 32 bit return value
-    // (also check for negative return values!)
-    exit_status = (int32_t)WEXITSTATUS(exit_status);
-    if (exit_status & 0x80) {
-        exit_status |= 0xFFFFFF00;
+void readOutput(int& fd,
+                std::string& output,
+                const std::function<void(const char* data, std::size_t size)>& callback)
+{
+    char buffer[16384];
+    const ssize_t read_size = ::read(fd, buffer, sizeof(buffer));
+    if (read_size > 0) {
+        if (callback) {
+            callback(buffer, static_cast<std::size_t>(read_size));
+        }
+        else {
+            output.append(buffer, static_cast<std::size_t>(read_size));
+        }
+    }
+    else if (read_size == 0 || errno != EINTR) {
+        closeFd(fd);
     }
-    return exit_status;
 }
 
+ExecuteResult spawnAndCapture(const char* file,
+                              char* const* argv,
+                              const std::string& working_dir,
+                              const ExecuteOptions& options)
+{
+    ExecuteResult result;
+    int std_out_pipe[2] = {-1, -1};
+    int std_err_pipe[2] = {-1, -1};
+    if (!createPipe(std_out_pipe)) {
+        return result;
+    }
+    if (!createPipe(std_err_pipe)) {
+        closeFd(std_out_pipe[0]);
+        closeFd(std_out_pipe[1]);
+        return result;
+    }
+
+    const pid_t pid = spawn(file, argv, working_dir, std_out_pipe[1], std_err_pipe[1]);
+    closeFd(std_out_pipe[1]);
+    closeFd(std_err_pipe[1]);
+    if (pid < 0) {
+        closeFd(std_out_pipe[0]);
+        closeFd(std_err_pipe[0]);
+        return result;
+    }
+    result.started = true;
+
+    // children of the application may hold the pipes open after it exited, so the pipes are not
+    // waited for longer than this without checking the application
+    const int poll_interval = 10;
+    using clock = std::chrono::steady_clock;
+    const auto deadline = clock::now() + std::chrono::microseconds(options.timeout);
+    int status = 0;
+    bool exited = false;
+    while (std_out_pipe[0] >= 0 || std_err_pipe[0] >= 0) {
+        int poll_timeout = 0;
+        if (!exited) {
+            exited = hasExited(pid, status);
+        }
+        if (!exited) {
+            poll_timeout = poll_interval;
+            if (options.timeout >= 0) {
+                const auto remaining = deadline - clock::now();
+                if (remaining <= clock::duration::zero()) {
+                    // the process is not reaped yet, so its id can not have been reused
+                    result.timed_out = true;
+                    ::kill(pid, SIGKILL);
+                    break;
+                }
+                // round up, a timeout of zero would spin until the deadline
+                poll_timeout = static_cast<int>(std::min<std::int64_t>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count() + 1,
+                    poll_interval));
+            }
+        }
+        pollfd poll_fds[2];
+        nfds_t poll_fd_count = 0;
+        for (const int fd: {std_out_pipe[0], std_err_pipe[0]}) {
+            if (fd >= 0) {
+                poll_fds[poll_fd_count++] = {fd, POLLIN, 0};
+            }
+        }
+        const int ready_count = ::poll(poll_fds, poll_fd_count, poll_timeout);
+        if (ready_count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (ready_count == 0 && exited) {
+            // everything the application wrote has been read
+            break;
+        }
+        for (nfds_t index = 0; index < poll_fd_count; ++index) {
+            if (poll_fds[index].revents == 0) {
+                continue;
+            }
+            if (poll_fds[index].fd == std_out_pipe[0]) {
+                readOutput(std_out_pipe[0], result.std_out, options.on_std_out);
+            }
+            else {
+                readOutput(std_err_pipe[0], result.std_err, options.on_std_err);
+            }
+        }
+    }
+    closeFd(std_out_pipe[0]);
+    closeFd(std_err_pipe[0]);
+
+    if (!exited) {
+        while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+        }
+    }
+    result.exit_code = toExitCode(status);
+    return result;
+}
+} // namespace
+
+namespace detail {
 uint32_t execute(const a_util::filesystem::Path& executable_file,
                  const std::string& arguments,
                  const a_util::filesystem::Path& working_path,
                  std::string& std_out,
                  std::string& std_err)
 {
-    uint64_t proc_id = getCurrentProcessId();
-    a_util::filesystem::Path temp_error_file = filesystem::getTempDirectory();
-
-    timestamp_t easymillisec = a_util::system::getCurrentMilliseconds();
-    temp_error_file.append(
-        a_util::strings::format("a_util_ex_stderr_%uld_%ld", proc_id, easymillisec));
+    a_util::filesystem::Path exe_path = executable_file;
+    a_util::filesystem::Path work_path = working_path;
 
-    uint32_t ret_val = execute(executable_file, arguments, working_path, std_out, temp_error_file);
+    detail::preparePaths(exe_path, work_path);
 
-    a_util::filesystem::readTextFile(temp_error_file, std_err);
-    a_util::filesystem::remove(temp_error_file);
-    return ret_val;
+    // the arguments are a command line, so the shell is still needed to split them
+    std::string call_command = a_util::strings::format("cd \"%s\" && %s %s",
+                                                       work_path.toString().c_str(),
+                                                       exe_path.toString().c_str(),
+                                                       arguments.c_str());
+    const char* argv[] = {"sh", "-c", call_command.c_str(), nullptr};
+    ExecuteResult result =
+        spawnAndCapture("/bin/sh", const_cast<char* const*>(argv), {}, ExecuteOptions());
+    if (!result.started) {
+        return 1;
+    }
+    std_out.append(result.std_out);
+    std_err = std::move(result.std_err);
+    return result.exit_code;
 }
 } // namespace detail
 
+ExecuteResult execute(const a_util::filesystem::Path& executable_file,
+                      const std::vector<std::string>& arguments,
+                      const ExecuteOptions& options)
+{
+    const std::string file = executable_file.toString();
+    std::vector<char*> argv;
+    argv.reserve(arguments.size() + 2);
+    argv.push_back(const_cast<char*>(file.c_str()));
+    for (const auto& argument: arguments) {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+    return spawnAndCapture(file.c_str(), argv.data(), options.working_dir.toString(), options);
+}
+
 uint64_t getCurrentProcessId()
 {
     return static_cast<uint64_t>(getpid());
@@ -29,21 +29,17 @@ namespace process {
 #define popen _popen
 #define pclose _pclose
 
-namespace detail {
-uint32_t execute(const a_util::filesystem::Path& executable_file,
-                 const std::string& arguments,
-                 const a_util::filesystem::Path& working_path,
-                 std::string& std_out,
-                 std::string& std_err)
+namespace {
+/**
+ * Run a command line with standard out and error redirected to pipes and wait for it to exit.
+ * @return @c false if the process could not be created, @c exit_code is not set then
+ */
+bool runAndCapture(const std::string& command_line,
+                   const a_util::filesystem::Path& working_path,
+                   std::string& std_out,
+                   std::string& std_err,
+                   uint32_t& exit_code)
 {
-    a_util::filesystem::Path exe_path = executable_file;
-    a_util::filesystem::Path work_path = working_path;
-
-    detail::preparePaths(exe_path, work_path);
-
-    std::string call_command =
-        a_util::strings::format("%s %s", exe_path.toString().c_str(), arguments.c_str());
-
     // if we use popen() on windows systems, a console opens and closes immediately if none is
     // already present (e.g. start an app from GUI) to avoid this we generate a whole new process
     // and connect via "real" pipe see https://msdn.microsoft.com/en-us/library/ms682499.aspx for
@@ -77,13 +73,13 @@ uint32_t execute(const a_util::filesystem::Path& executable_file,
     startup_info.hStdError = childStd_ERR_Wr;
 
     BOOL bSuccess = CreateProcess(nullptr,
-                                  (LPTSTR)(LPCTSTR)call_command.c_str(),
+                                  (LPTSTR)(LPCTSTR)command_line.c_str(),
                                   nullptr,
                                   nullptr,
                                   TRUE,
                                   0,
                                   nullptr,
-                                  work_path.toString().c_str(),
+                                  working_path.toString().c_str(),
                                   &startup_info,
                                   &proc_info);
 
@@ -91,9 +87,13 @@ uint32_t execute(const a_util::filesystem::Path& executable_file,
     CloseHandle(childStd_ERR_Wr);
 
     if (!bSuccess) {
-        CloseHandle(proc_info.hProcess);
-        CloseHandle(proc_info.hThread);
-        return static_cast<std::uint32_t>(-1);
+        if (fd_pipe) {
+            fclose(fd_pipe);
+        }
+        if (fd_pipe_err) {
+            fclose(fd_pipe_err);
+        }
+        return false;
     }
 
     if (fd_pipe) {
@@ -110,8 +110,12 @@ uint32_t execute(const a_util::filesystem::Path& executable_file,
     }
 
     WaitForSingleObject(proc_info.hProcess, INFINITE);
-    fclose(fd_pipe);
-    fclose(fd_pipe_err);
+    if (fd_pipe) {
+        fclose(fd_pipe);
+    }
+    if (fd_pipe_err) {
+        fclose(fd_pipe_err);
+    }
 
     DWORD exit_status = 0;
     GetExitCodeProcess(proc_info.hProcess, &exit_status);
@@ -119,10 +123,85 @@ uint32_t execute(const a_util::filesystem::Path& executable_file,
     CloseHandle(proc_info.hProcess);
     CloseHandle(proc_info.hThread);
 
-    return exit_status;
+    exit_code = exit_status;
+    return true;
+}
+} // namespace
+
+namespace detail {
+uint32_t execute(const a_util::filesystem::Path& executable_file,
+                 const std::string& arguments,
+                 const a_util::filesystem::Path& working_path,
+                 std::string& std_out,
+                 std::string& std_err)
+{
+    a_util::filesystem::Path exe_path = executable_file;
+    a_util::filesystem::Path work_path = working_path;
+
+    detail::preparePaths(exe_path, work_path);
+
+    std::string call_command =
+        a_util::strings::format("%s %s", exe_path.toString().c_str(), arguments.c_str());
+
+    uint32_t exit_code = 0;
+    if (!runAndCapture(call_command, work_path, std_out, std_err, exit_code)) {
+        return static_cast<std::uint32_t>(-1);
+    }
+    return exit_code;
+}
+
+// quote an argument for CommandLineToArgvW and the parsing of the C runtime
+std::string quoteArgument(const std::string& argument)
+{
+    if (!argument.empty() && argument.find_first_of(" \t\n\v\"") == std::string::npos) {
+        return argument;
+    }
+    std::string quoted = "\"";
+    std::size_t backslashes = 0;
+    for (const char character: argument) {
+        if (character == '\\') {
+            ++backslashes;
+            continue;
+        }
+        // backslashes are only escaped in front of a quote
+        quoted.append(character == '"' ? backslashes * 2 + 1 : backslashes, '\\');
+        quoted += character;
+        backslashes = 0;
+    }
+    quoted.append(backslashes * 2, '\\');
+    quoted += '"';
+    return quoted;
 }
 } // namespace detail
 
+ExecuteResult execute(const a_util::filesystem::Path& executable_file,
+                      const std::vector<std::string>& arguments,
+                      const ExecuteOptions& options)
+{
+    // the program name is taken up to the closing quote, backslashes are not escaped there
+    std::string command_line = "\"" + executable_file.toString() + "\"";
+    for (const auto& argument: arguments) {
+        command_line += ' ';
+        command_line += detail::quoteArgument(argument);
+    }
+    const a_util::filesystem::Path working_path =
+        options.working_dir.isEmpty() ? a_util::filesystem::Path(".") : options.working_dir;
+
+    // the output is passed to the callbacks after the application exited, timeouts are ignored
+    ExecuteResult result;
+    result.started = runAndCapture(
+        command_line, working_path, result.std_out, result.std_err, result.exit_code);
+    if (options.on_std_out && !result.std_out.empty()) {
+        options.on_std_out(result.std_out.data(), result.std_out.size());
+        result.std_out.clear();
+    }
+    if (options.on_std_err && !result.std_err.empty()) {
+        options.on_std_err(result.std_err.data(), result.std_err.size());
+        result.std_err.clear();
+    }
+    return result;
+}
+
 uint64_t getCurrentProcessId()
 {
     return static_cast<uint64_t>(::GetCurrentProcessId());
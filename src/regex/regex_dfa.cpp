@@ -0,0 +1,555 @@
+/**
+ * @file
+ * Compilation of regular expressions into a deterministic finite automaton: the pattern is parsed
+ * into a syntax tree, translated into a nondeterministic automaton (Thompson construction) and
+ * determinized by the subset construction over classes of equivalent characters.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "regex_dfa.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <limits>
+#include <map>
+#include <unordered_set>
+
+namespace a_util {
+namespace regex {
+namespace detail {
+namespace {
+typedef std::bitset<256> CharSet;
+
+constexpr std::size_t infinite = std::numeric_limits<std::size_t>::max();
+// limits keeping the compilation fast, larger patterns are matched by std::regex
+constexpr std::size_t max_repetitions = 1000;
+constexpr std::size_t max_nfa_states = 10000;
+constexpr std::size_t max_dfa_states = 4096;
+
+/// thrown if the pattern is beyond the supported subset
+struct Unsupported {
+};
+
+struct Node {
+    enum Type { chars, sequence, alternation, repetition };
+
+    explicit Node(Type type) : type(type)
+    {
+    }
+
+    Type type;
+    CharSet char_set;
+    std::vector<Node> children;
+    std::size_t min = 1;
+    std::size_t max = 1;
+};
+
+CharSet makeRange(unsigned char first, unsigned char last)
+{
+    CharSet char_set;
+    for (unsigned int character = first; character <= last; ++character) {
+        char_set.set(character);
+    }
+    return char_set;
+}
+
+class Parser {
+public:
+    Parser(const std::string& pattern, bool case_sensitive)
+        : _pattern(pattern), _case_sensitive(case_sensitive)
+    {
+    }
+
+    Node parse()
+    {
+        Node node = parseAlternation();
+        if (!atEnd()) {
+            throw Unsupported();
+        }
+        return node;
+    }
+
+private:
+    bool atEnd() const
+    {
+        return _position >= _pattern.size();
+    }
+
+    char peek() const
+    {
+        return atEnd() ? '\0' : _pattern[_position];
+    }
+
+    char next()
+    {
+        if (atEnd()) {
+            throw Unsupported();
+        }
+        return _pattern[_position++];
+    }
+
+    Node parseAlternation()
+    {
+        Node node = parseSequence();
+        if (peek() != '|') {
+            return node;
+        }
+        Node alternation(Node::alternation);
+        alternation.children.push_back(std::move(node));
+        while (peek() == '|') {
+            next();
+            alternation.children.push_back(parseSequence());
+        }
+        return alternation;
+    }
+
+    Node parseSequence()
+    {
+        Node sequence(Node::sequence);
+        while (!atEnd() && peek() != '|' && peek() != ')') {
+            // anchors are only supported where they are implied by the full match
+            if (peek() == '^' || peek() == '$') {
+                const bool implied =
+                    peek() == '^' ? _position == 0 :
+                                    _position + 1 == _pattern.size() && _depth == 0;
+                if (!implied) {
+                    throw Unsupported();
+                }
+                next();
+                continue;
+            }
+            Node atom = parseAtom();
+            std::size_t min = 0, max = 0;
+            while (parseQuantifier(min, max)) {
+                Node repetition(Node::repetition);
+                repetition.min = min;
+                repetition.max = max;
+                repetition.children.push_back(std::move(atom));
+                atom = std::move(repetition);
+            }
+            sequence.children.push_back(std::move(atom));
+        }
+        return sequence;
+    }
+
+    bool parseQuantifier(std::size_t& min, std::size_t& max)
+    {
+        switch (peek()) {
+        case '*':
+            min = 0;
+            max = infinite;
+            break;
+        case '+':
+            min = 1;
+            max = infinite;
+            break;
+        case '?':
+            min = 0;
+            max = 1;
+            break;
+        case '{':
+            next();
+            min = parseNumber();
+            max = min;
+            if (peek() == ',') {
+                next();
+                max = peek() == '}' ? infinite : parseNumber();
+            }
+            if (peek() != '}' || max < min) {
+                throw Unsupported();
+            }
+            break;
+        default:
+            return false;
+        }
+        next();
+        // lazy quantifiers match the same strings as a whole
+        if (peek() == '?') {
+            next();
+        }
+        return true;
+    }
+
+    std::size_t parseNumber()
+    {
+        if (!std::isdigit(static_cast<unsigned char>(peek()))) {
+            throw Unsupported();
+        }
+        std::size_t number = 0;
+        while (std::isdigit(static_cast<unsigned char>(peek()))) {
+            number = number * 10 + static_cast<std::size_t>(next() - '0');
+            if (number > max_repetitions) {
+                throw Unsupported();
+            }
+        }
+        return number;
+    }
+
+    Node parseAtom()
+    {
+        Node node(Node::chars);
+        const char character = next();
+        switch (character) {
+        case '.':
+            node.char_set.set();
+            node.char_set.reset('\n');
+            node.char_set.reset('\r');
+            return node;
+        case '[':
+            node.char_set = parseBracket();
+            return node;
+        case '(': {
+            if (peek() == '?') {
+                // only non-capturing groups, no look arounds
+                next();
+                if (next() != ':') {
+                    throw Unsupported();
+                }
+            }
+            ++_depth;
+            Node group = parseAlternation();
+            --_depth;
+            if (next() != ')') {
+                throw Unsupported();
+            }
+            return group;
+        }
+        case '\\':
+            if (!parseClassEscape(peek(), node.char_set)) {
+                node.char_set.set(parseCharacterEscape(next()));
+            }
+            else {
+                next();
+            }
+            break;
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+        case '}':
+        case ']':
+            throw Unsupported();
+        default:
+            node.char_set.set(static_cast<unsigned char>(character));
+            break;
+        }
+        foldCase(node.char_set);
+        return node;
+    }
+
+    CharSet parseBracket()
+    {
+        CharSet char_set;
+        const bool negated = peek() == '^';
+        if (negated) {
+            next();
+        }
+        if (peek() == ']') {
+            throw Unsupported();
+        }
+        for (;;) {
+            const char character = next();
+            if (character == ']') {
+                break;
+            }
+            if (character == '[' && (peek() == ':' || peek() == '=' || peek() == '.')) {
+                throw Unsupported();
+            }
+            unsigned char first = static_cast<unsigned char>(character);
+            if (character == '\\') {
+                if (parseClassEscape(peek(), char_set)) {
+                    next();
+                    continue;
+                }
+                first = parseCharacterEscape(next());
+            }
+            // a range, unless the '-' is the last character of the bracket expression
+            if (peek() == '-' && _position + 1 < _pattern.size() &&
+                _pattern[_position + 1] != ']') {
+                next();
+                unsigned char last = static_cast<unsigned char>(next());
+                if (last == '\\') {
+                    CharSet unused;
+                    if (parseClassEscape(peek(), unused)) {
+                        throw Unsupported();
+                    }
+                    last = parseCharacterEscape(next());
+                }
+                if (last < first) {
+                    throw Unsupported();
+                }
+                char_set |= makeRange(first, last);
+            }
+            else {
+                char_set.set(first);
+            }
+        }
+        // fold before negating, so [^a] does not match 'A' either
+        foldCase(char_set);
+        if (negated) {
+            char_set.flip();
+        }
+        return char_set;
+    }
+
+    static bool parseClassEscape(char escape, CharSet& char_set)
+    {
+        CharSet class_set;
+        switch (std::tolower(static_cast<unsigned char>(escape))) {
+        case 'd':
+            class_set = makeRange('0', '9');
+            break;
+        case 'w':
+            class_set = makeRange('0', '9') | makeRange('a', 'z') | makeRange('A', 'Z');
+            class_set.set('_');
+            break;
+        case 's':
+            for (const char space: {' ', '\t', '\n', '\v', '\f', '\r'}) {
+                class_set.set(static_cast<unsigned char>(space));
+            }
+            break;
+        default:
+            return false;
+        }
+        if (std::isupper(static_cast<unsigned char>(escape))) {
+            class_set.flip();
+        }
+        char_set |= class_set;
+        return true;
+    }
+
+    static unsigned char parseCharacterEscape(char escape)
+    {
+        switch (escape) {
+        case 'n':
+            return '\n';
+        case 't':
+            return '\t';
+        case 'r':
+            return '\r';
+        case 'f':
+            return '\f';
+        case 'v':
+            return '\v';
+        default:
+            // back references, word boundaries and numeric escapes
+            if (std::isalnum(static_cast<unsigned char>(escape))) {
+                throw Unsupported();
+            }
+            return static_cast<unsigned char>(escape);
+        }
+    }
+
+    void foldCase(CharSet& char_set) const
+    {
+        if (_case_sensitive) {
+            return;
+        }
+        for (unsigned int lower = 'a'; lower <= 'z'; ++lower) {
+            const unsigned int upper = lower - 'a' + 'A';
+            if (char_set.test(lower) || char_set.test(upper)) {
+                char_set.set(lower);
+                char_set.set(upper);
+            }
+        }
+    }
+
+    const std::string& _pattern;
+    const bool _case_sensitive;
+    std::size_t _position = 0;
+    std::size_t _depth = 0;
+};
+
+/// Nondeterministic automaton, state 0 is the accepting state
+class Nfa {
+public:
+    struct State {
+        // a character state moves on the characters of the set to next, other states only have
+        // epsilon moves
+        bool has_chars = false;
+        CharSet char_set;
+        std::size_t next = 0;
+        std::vector<std::size_t> epsilon;
+    };
+
+    explicit Nfa(const Node& root)
+    {
+        addState();
+        start = build(root, 0);
+    }
+
+    std::vector<State> states;
+    std::size_t start;
+
+private:
+    std::size_t addState()
+    {
+        if (states.size() >= max_nfa_states) {
+            throw Unsupported();
+        }
+        states.emplace_back();
+        return states.size() - 1;
+    }
+
+    // builds the automaton of the node backwards, continuing with the state next
+    std::size_t build(const Node& node, std::size_t next)
+    {
+        switch (node.type) {
+        case Node::chars: {
+            const std::size_t state = addState();
+            states[state].has_chars = true;
+            states[state].char_set = node.char_set;
+            states[state].next = next;
+            return state;
+        }
+        case Node::sequence:
+            for (auto child = node.children.rbegin(); child != node.children.rend(); ++child) {
+                next = build(*child, next);
+            }
+            return next;
+        case Node::alternation: {
+            const std::size_t state = addState();
+            for (const auto& child: node.children) {
+                const std::size_t child_start = build(child, next);
+                states[state].epsilon.push_back(child_start);
+            }
+            return state;
+        }
+        case Node::repetition:
+            break;
+        }
+
+        const Node& child = node.children.front();
+        if (node.max == infinite) {
+            const std::size_t loop = addState();
+            const std::size_t child_start = build(child, loop);
+            states[loop].epsilon = {child_start, next};
+            next = loop;
+        }
+        else {
+            for (std::size_t optional = node.min; optional < node.max; ++optional) {
+                const std::size_t state = addState();
+                const std::size_t child_start = build(child, next);
+                states[state].epsilon = {child_start, next};
+                next = state;
+            }
+        }
+        for (std::size_t mandatory = 0; mandatory < node.min; ++mandatory) {
+            next = build(child, next);
+        }
+        return next;
+    }
+};
+
+/// the character states and the accepting state reachable by epsilon moves, sorted
+std::vector<std::size_t> closure(const Nfa& nfa,
+                                 std::vector<std::size_t> pending,
+                                 std::vector<std::size_t>& visited,
+                                 std::size_t visit)
+{
+    std::vector<std::size_t> result;
+    while (!pending.empty()) {
+        const std::size_t state = pending.back();
+        pending.pop_back();
+        if (visited[state] == visit) {
+            continue;
+        }
+        visited[state] = visit;
+        if (state == 0 || nfa.states[state].has_chars) {
+            result.push_back(state);
+        }
+        pending.insert(
+            pending.end(), nfa.states[state].epsilon.begin(), nfa.states[state].epsilon.end());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+} // namespace
+
+std::unique_ptr<Dfa> Dfa::compile(const std::string& pattern, bool case_sensitive)
+{
+    try {
+        const Nfa nfa(Parser(pattern, case_sensitive).parse());
+
+        // characters are equivalent if every character state either accepts both or none
+        std::unique_ptr<Dfa> dfa(new Dfa());
+        dfa->_byte_classes.fill(0);
+        std::uint32_t class_count = 1;
+        std::unordered_set<CharSet> char_sets;
+        for (const auto& state: nfa.states) {
+            if (!state.has_chars || !char_sets.insert(state.char_set).second) {
+                continue;
+            }
+            std::map<std::pair<std::uint8_t, bool>, std::uint8_t> refined_classes;
+            for (std::size_t character = 0; character < 256; ++character) {
+                const auto key =
+                    std::make_pair(dfa->_byte_classes[character], state.char_set.test(character));
+                const auto refined = refined_classes.emplace(
+                    key, static_cast<std::uint8_t>(refined_classes.size()));
+                dfa->_byte_classes[character] = refined.first->second;
+            }
+            class_count = static_cast<std::uint32_t>(refined_classes.size());
+        }
+        dfa->_class_count = class_count;
+        std::vector<unsigned char> class_representatives(class_count);
+        for (std::size_t character = 256; character-- > 0;) {
+            class_representatives[dfa->_byte_classes[character]] =
+                static_cast<unsigned char>(character);
+        }
+
+        // subset construction, state 0 is the dead state without any NFA state
+        std::vector<std::size_t> visited(nfa.states.size(), 0);
+        std::size_t visit = 0;
+        std::map<std::vector<std::size_t>, std::uint32_t> dfa_states;
+        std::vector<std::pair<const std::vector<std::size_t>*, std::uint32_t>> pending;
+        const auto addDfaState = [&](std::vector<std::size_t> nfa_states) {
+            const auto inserted = dfa_states.emplace(
+                std::move(nfa_states), static_cast<std::uint32_t>(dfa_states.size()));
+            if (inserted.second) {
+                if (dfa_states.size() > max_dfa_states) {
+                    throw Unsupported();
+                }
+                pending.emplace_back(&inserted.first->first,
+                                     inserted.first->second * class_count);
+                dfa->_accepting.push_back(!inserted.first->first.empty() &&
+                                          inserted.first->first.front() == 0);
+                dfa->_transitions.resize(dfa->_transitions.size() + class_count, 0);
+            }
+            return inserted.first->second * class_count;
+        };
+        addDfaState({});
+        pending.clear();
+        dfa->_start = addDfaState(closure(nfa, {nfa.start}, visited, ++visit));
+        while (!pending.empty()) {
+            const std::vector<std::size_t>& nfa_states = *pending.back().first;
+            const std::uint32_t state = pending.back().second;
+            pending.pop_back();
+            for (std::uint32_t byte_class = 0; byte_class < class_count; ++byte_class) {
+                const unsigned char character = class_representatives[byte_class];
+                std::vector<std::size_t> targets;
+                for (const std::size_t nfa_state: nfa_states) {
+                    if (nfa.states[nfa_state].has_chars &&
+                        nfa.states[nfa_state].char_set.test(character)) {
+                        targets.push_back(nfa.states[nfa_state].next);
+                    }
+                }
+                dfa->_transitions[state + byte_class] =
+                    addDfaState(closure(nfa, std::move(targets), visited, ++visit));
+            }
+        }
+        return dfa;
+    }
+    catch (const Unsupported&) {
+        return nullptr;
+    }
+}
+
+} // namespace detail
+} // namespace regex
+} // namespace a_util
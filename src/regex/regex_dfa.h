@@ -0,0 +1,77 @@
+/**
+ * @file
+ * Deterministic finite automaton for the full matching of regular expressions without back
+ * references, look arounds and inner anchors.
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef A_UTIL_UTIL_REGEX_DETAIL_REGEX_DFA_HEADER_INCLUDED
+#define A_UTIL_UTIL_REGEX_DETAIL_REGEX_DFA_HEADER_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace a_util {
+namespace regex {
+namespace detail {
+/**
+ * Automaton matching whole strings against an ECMAScript pattern in one pass, one table lookup
+ * per character.
+ *
+ * Supported are literals, escapes, @c . and bracket expressions with ranges and the classes
+ * @c \\d, @c \\w, @c \\s and their negations, (non-capturing) groups, alternations and all greedy
+ * and lazy quantifiers, @c ^ as first and @c $ as last character of the pattern.
+ */
+class Dfa {
+public:
+    /**
+     * Compile a pattern, which has to be a valid ECMAScript regular expression
+     * @param[in] pattern The regular expression
+     * @param[in] case_sensitive Whether or not the match is case sensitive (ASCII only)
+     * @return The automaton or @c nullptr if the pattern uses features beyond the supported subset
+     *         or the automaton would get too large
+     */
+    static std::unique_ptr<Dfa> compile(const std::string& pattern, bool case_sensitive);
+
+    /**
+     * Check if the whole string matches the pattern.
+     * @param[in] text The string to match
+     * @return @c true if the string matches, @c false otherwise
+     */
+    bool fullMatch(const std::string& text) const
+    {
+        // state 0 is the dead state, the states are premultiplied by the class count
+        std::uint32_t state = _start;
+        for (const char character: text) {
+            state = _transitions[state + _byte_classes[static_cast<unsigned char>(character)]];
+            if (state == 0) {
+                return false;
+            }
+        }
+        return _accepting[state / _class_count] != 0;
+    }
+
+private:
+    Dfa() = default;
+
+    /// characters which are not distinguished by any transition share a class
+    std::array<std::uint8_t, 256> _byte_classes;
+    std::uint32_t _class_count = 0;
+    std::uint32_t _start = 0;
+    std::vector<std::uint32_t> _transitions;
+    std::vector<std::uint8_t> _accepting;
+};
+
+} // namespace detail
+} // namespace regex
+} // namespace a_util
+
+#endif // A_UTIL_UTIL_REGEX_DETAIL_REGEX_DFA_HEADER_INCLUDED
@@ -9,8 +9,12 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "regex_dfa.h"
+
 #include <a_util/regex/regularexpression.h>
 
+#include <algorithm>
+#include <iterator>
 #include <regex>
 
 namespace a_util {
@@ -24,11 +28,13 @@ public:
     RegularExpression* _self;
     bool _is_case_sensitive;
     std::unique_ptr<std::regex> _regex;
+    // the automaton for full matches, if the pattern is within its supported subset
+    std::unique_ptr<detail::Dfa> _dfa;
     std::string _error_description;
     std::string _pattern;
 
     Implementation(RegularExpression* self)
-        : _self(self), _is_case_sensitive(true), _regex(), _error_description(), _pattern()
+        : _self(self), _is_case_sensitive(true), _regex(), _dfa(), _error_description(), _pattern()
     {
     }
 };
@@ -81,6 +87,7 @@ bool RegularExpression::setPattern(const std::string& pattern, bool case_sensiti
             regex->assign(pattern, regex->flags() | std::regex_constants::icase);
         }
         _impl->_regex.reset(regex.release());
+        _impl->_dfa = detail::Dfa::compile(pattern, case_sensitive);
     }
     catch (std::regex_error& e) {
         _impl->_error_description = e.what();
@@ -108,9 +115,39 @@ bool RegularExpression::fullMatch(const std::string& text) const
 {
     if (!_impl->_regex)
         return false;
+    if (_impl->_dfa)
+        return _impl->_dfa->fullMatch(text);
     return std::regex_match(text, *_impl->_regex);
 }
 
+std::vector<std::string> RegularExpression::filter(const std::vector<std::string>& texts) const
+{
+    std::vector<std::string> matching_texts;
+    if (!_impl->_regex)
+        return matching_texts;
+
+    if (_impl->_dfa) {
+        const detail::Dfa& dfa = *_impl->_dfa;
+        std::copy_if(texts.begin(),
+                     texts.end(),
+                     std::back_inserter(matching_texts),
+                     [&dfa](const std::string& text) { return dfa.fullMatch(text); });
+    }
+    else {
+        const std::regex& regex = *_impl->_regex;
+        std::copy_if(texts.begin(),
+                     texts.end(),
+                     std::back_inserter(matching_texts),
+                     [&regex](const std::string& text) { return std::regex_match(text, regex); });
+    }
+    return matching_texts;
+}
+
+bool RegularExpression::isAutomatonUsed() const
+{
+    return _impl->_regex && _impl->_dfa;
+}
+
 bool RegularExpression::fullMatch(const std::string& text,
                                   std::string& arg1,
                                   std::string& arg2,
@@ -16,9 +16,12 @@
 #include "std_to_detail.h"
 #include "strings_format_detail.h"
 
+#include <a_util/base/feature_check/library/charconv.h>
 #include <a_util/strings/strings_convert.h>
 #include <a_util/strings/strings_functions.h>
 
+#include <cstring> // std::strlen
+
 namespace a_util {
 namespace strings {
 namespace detail {
@@ -81,6 +84,60 @@ public:
     }
 };
 
+/**
+ * Converts the whole string with std::from_chars if available. It neither skips whitespaces nor
+ * depends on the locale, so every string it converts is converted to the same value by the
+ * strto* functions - which are the fallback for everything else.
+ * @retval true Conversion was successful, @c to contains the converted value.
+ * @retval false Not convertible by std::from_chars, @c to is left untouched.
+ */
+template <typename Numeric>
+bool fromChars(const char* from, Numeric& to)
+{
+#if HAS_CHARCONV
+    if (from) {
+        const char* const last = from + std::strlen(from);
+        Numeric tmp = 0;
+        const std::from_chars_result result = std::from_chars(from, last, tmp);
+        if (result.ec == std::errc() && result.ptr == last) {
+            to = tmp;
+            return true;
+        }
+    }
+#else
+    (void)from;
+    (void)to;
+#endif
+    return false;
+}
+
+/**
+ * Converts the whole string with std::from_chars if available and the decimal point of the C
+ * locale is '.', otherwise strtod would reject strings std::from_chars accepts (e.g. "1.5" with
+ * the decimal point ',').
+ * @retval true Conversion was successful, @c to contains the converted value.
+ * @retval false Not convertible by std::from_chars, @c to is left untouched.
+ */
+template <>
+bool fromChars(const char* from, double& to)
+{
+#if HAS_CHARCONV_FLOATING_POINT
+    if (from && isDecimalPointDot()) {
+        const char* const last = from + std::strlen(from);
+        double tmp = 0.0;
+        const std::from_chars_result result = std::from_chars(from, last, tmp);
+        if (result.ec == std::errc() && result.ptr == last) {
+            to = tmp;
+            return true;
+        }
+    }
+#else
+    (void)from;
+    (void)to;
+#endif
+    return false;
+}
+
 bool isIntegral(const char* first, std::size_t str_length, const char** last = nullptr)
 {
     const char* it = first;
@@ -119,22 +176,34 @@ bool isFloatingPoint(const char* first, std::size_t str_length)
 
 bool toInt8(const char* from, std::int8_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     return detail::StringToSigned<std::int8_t>(to).tryConvert<long>(&std::strtol, from);
 }
 
 bool toInt16(const char* from, std::int16_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     return detail::StringToSigned<std::int16_t>(to).tryConvert<long>(&std::strtol, from);
 }
 
 bool toInt32(const char* from, std::int32_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     return detail::StringToSigned<std::int32_t>(to).tryConvert<std::int64_t>(&detail::strtoll,
                                                                              from);
 }
 
 bool toInt64(const char* from, std::int64_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     // do not use errno as it is not thread safe in pre C++11 times
     const char* end = " ";
     const std::int64_t tmp =
@@ -166,24 +235,36 @@ bool toInt64(const char* from, std::int64_t& to)
 
 bool toUInt8(const char* from, std::uint8_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     return detail::StringToUnsigned<std::uint8_t>(to).tryConvert<unsigned long>(&std::strtoul,
                                                                                 from);
 }
 
 bool toUInt16(const char* from, std::uint16_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     return detail::StringToUnsigned<std::uint16_t>(to).tryConvert<unsigned long>(&std::strtoul,
                                                                                  from);
 }
 
 bool toUInt32(const char* from, std::uint32_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     return detail::StringToUnsigned<std::uint32_t>(to).tryConvert<std::uint64_t>(&detail::strtoull,
                                                                                  from);
 }
 
 bool toUInt64(const char* from, std::uint64_t& to)
 {
+    if (detail::fromChars(from, to)) {
+        return true;
+    }
     const char* end = " ";
     const std::uint64_t tmp =
         isEmpty(from) ? 0 : detail::strtoull(from, const_cast<char**>(&end), 10);
@@ -221,6 +302,17 @@ bool toFloat(const char* from, float& to)
 
 bool toDouble(const char* from, double& to)
 {
+    double tmp_from_chars = 0.0;
+    if (detail::fromChars(from, tmp_from_chars)) {
+        // the same limits as for the fallback
+        const bool is_convertible =
+            (tmp_from_chars != std::numeric_limits<double>::quiet_NaN()) &&
+            (tmp_from_chars != std::numeric_limits<double>::infinity()) &&
+            (tmp_from_chars != -(std::numeric_limits<double>::infinity()));
+        to = is_convertible ? tmp_from_chars : to;
+        return is_convertible;
+    }
+
 #if defined(__QNX__)
     // for QNX sscanf is providing better results for values near the floating point limits
     double tmp = 0.0;
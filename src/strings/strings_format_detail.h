@@ -16,6 +16,7 @@
 
 #include <a_util/strings/strings_format.h>
 
+#include <clocale>
 #include <limits>
 
 namespace a_util {
@@ -37,20 +38,15 @@ const std::string& numericMinToString(const Numeric* = nullptr)
     return str_numeric_limit;
 }
 
-template <typename Numeric>
-std::string signedNumericToString(Numeric from)
-{ //+1 for terminating '\0'
-    const std::string::size_type buffer_size = numericMinToString<Numeric>().size() + 1;
-    const char* const specifier = defaultConversion<Numeric>::specifier;
-    return a_util::strings::format(buffer_size, specifier, from);
-}
-
-template <typename Numeric>
-std::string unsignedNumericToString(Numeric from)
-{ //+1 for terminating '\0'
-    const std::string::size_type buffer_size = numericMaxToString<Numeric>().size() + 1;
-    const char* const specifier = defaultConversion<Numeric>::specifier;
-    return a_util::strings::format(buffer_size, specifier, from);
+/**
+ * Check whether the decimal point of the C locale (category @c LC_NUMERIC) is '.'. Only then the
+ * locale independent floating point conversions of <charconv> equal printf and strtod.
+ * @return @c true if the decimal point is '.', @c false otherwise.
+ */
+inline bool isDecimalPointDot()
+{
+    const char* const decimal_point = std::localeconv()->decimal_point;
+    return decimal_point[0] == '.' && decimal_point[1] == '\0';
 }
 
 } // namespace detail
@@ -11,58 +11,188 @@
 
 #include "strings_format_detail.h"
 
+#include <a_util/base/feature_check/library/charconv.h>
+#include <a_util/strings/strings_format.h>
+
+#include <cstdio>  // std::snprintf
+#include <cstdlib> // std::strtod
+#include <cstring> // std::memcpy
+#include <limits>
 #include <string>
+#include <type_traits>
 
 namespace a_util {
 namespace strings {
+namespace detail {
+namespace {
+/// the decimal representations of 0 to 99, converting two digits per division
+const char two_digits[] = "00010203040506070809"
+                          "10111213141516171819"
+                          "20212223242526272829"
+                          "30313233343536373839"
+                          "40414243444546474849"
+                          "50515253545556575859"
+                          "60616263646566676869"
+                          "70717273747576777879"
+                          "80818283848586878889"
+                          "90919293949596979899";
+
+/// sign, digits of std::uint64_t
+constexpr std::size_t max_integer_size = 1 + 20;
+/// sign, integral digits of DBL_MAX, decimal point and 6 fractional digits of "%f"
+constexpr std::size_t max_fixed_size = 1 + std::numeric_limits<double>::max_exponent10 + 1 + 1 + 6;
+/// sign, max_digits10 digits, decimal point and exponent ("e-308")
+constexpr std::size_t max_round_trip_size = 1 + std::numeric_limits<double>::max_digits10 + 1 + 5;
+
+char* copyChars(char* first, char* last, const char* from, std::size_t size)
+{
+    if (static_cast<std::size_t>(last - first) < size) {
+        return nullptr;
+    }
+    std::memcpy(first, from, size);
+    return first + size;
+}
+
+template <typename Unsigned>
+char* unsignedToChars(char* first, char* last, Unsigned from)
+{
+    // the digits are created backwards
+    char digits[max_integer_size];
+    char* const digits_end = digits + sizeof(digits);
+    char* pos = digits_end;
+    while (from >= 100) {
+        const std::size_t index = static_cast<std::size_t>(from % 100) * 2;
+        from /= 100;
+        *--pos = two_digits[index + 1];
+        *--pos = two_digits[index];
+    }
+    if (from >= 10) {
+        const std::size_t index = static_cast<std::size_t>(from) * 2;
+        *--pos = two_digits[index + 1];
+        *--pos = two_digits[index];
+    }
+    else {
+        *--pos = static_cast<char>('0' + from);
+    }
+    return copyChars(first, last, pos, static_cast<std::size_t>(digits_end - pos));
+}
+
+template <typename Unsigned, typename Signed>
+char* signedToChars(char* first, char* last, Signed from)
+{
+    if (from < 0) {
+        if (first == last) {
+            return nullptr;
+        }
+        *first = '-';
+        // negate within the unsigned type, which is well defined for the minimum as well
+        return unsignedToChars(first + 1, last, Unsigned(0) - static_cast<Unsigned>(from));
+    }
+    return unsignedToChars(first, last, static_cast<Unsigned>(from));
+}
+
+template <typename Float>
+char* fixedToChars(char* first, char* last, Float from)
+{
+#if HAS_CHARCONV_FLOATING_POINT
+    // equal to "%f" without the format string parsing, as long as the locale writes a '.'
+    if (isDecimalPointDot()) {
+        const std::to_chars_result result =
+            std::to_chars(first, last, from, std::chars_format::fixed, 6);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    }
+#endif
+    char buffer[max_fixed_size + 1];
+    const int size = std::snprintf(buffer, sizeof(buffer), "%f", static_cast<double>(from));
+    return size < 0 ? nullptr : copyChars(first, last, buffer, static_cast<std::size_t>(size));
+}
+
+template <typename Float>
+char* roundTripToChars(char* first, char* last, Float from)
+{
+#if HAS_CHARCONV_FLOATING_POINT
+    // the result has to convert back with strtod, which expects the decimal point of the locale
+    if (isDecimalPointDot()) {
+        const std::to_chars_result result = std::to_chars(first, last, from);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    }
+#endif
+    // the shortest "%g" representation converting back to the same value
+    char buffer[max_round_trip_size + 1];
+    int size = 0;
+    for (int precision = std::numeric_limits<Float>::digits10;
+         precision <= std::numeric_limits<Float>::max_digits10;
+         ++precision) {
+        size = std::snprintf(
+            buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(from));
+        if (size < 0) {
+            return nullptr;
+        }
+        if (static_cast<Float>(std::strtod(buffer, nullptr)) == from) {
+            break;
+        }
+    }
+    return copyChars(first, last, buffer, static_cast<std::size_t>(size));
+}
+
+template <typename Numeric>
+std::string toStringUsingChars(Numeric from, char* (*to_chars)(char*, char*, Numeric))
+{
+    char buffer[max_fixed_size];
+    return std::string(buffer, to_chars(buffer, buffer + sizeof(buffer), from));
+}
+
+} // namespace
+} // namespace detail
+
 std::string toString(std::int8_t from)
 {
-    return detail::signedNumericToString(from);
+    return detail::toStringUsingChars<std::int8_t>(from, &toChars);
 }
 
 std::string toString(std::int16_t from)
 {
-    return detail::signedNumericToString(from);
+    return detail::toStringUsingChars<std::int16_t>(from, &toChars);
 }
 
 std::string toString(std::int32_t from)
 {
-    return detail::signedNumericToString(from);
+    return detail::toStringUsingChars<std::int32_t>(from, &toChars);
 }
 
 std::string toString(std::int64_t from)
 {
-    return detail::signedNumericToString(from);
+    return detail::toStringUsingChars<std::int64_t>(from, &toChars);
 }
 
 std::string toString(std::uint8_t from)
 {
-    return detail::unsignedNumericToString(from);
+    return detail::toStringUsingChars<std::uint8_t>(from, &toChars);
 }
 
 std::string toString(std::uint16_t from)
 {
-    return detail::unsignedNumericToString(from);
+    return detail::toStringUsingChars<std::uint16_t>(from, &toChars);
 }
 
 std::string toString(std::uint32_t from)
 {
-    return detail::unsignedNumericToString(from);
+    return detail::toStringUsingChars<std::uint32_t>(from, &toChars);
 }
 
 std::string toString(std::uint64_t from)
 {
-    return detail::unsignedNumericToString(from);
+    return detail::toStringUsingChars<std::uint64_t>(from, &toChars);
 }
 
 std::string toString(float from)
 {
-    return detail::signedNumericToString(from);
+    return detail::toStringUsingChars<float>(from, &toChars);
 }
 
 std::string toString(double from)
 {
-    return detail::signedNumericToString(from);
+    return detail::toStringUsingChars<double>(from, &toChars);
 }
 
 std::string toString(bool from)
@@ -70,5 +200,81 @@ std::string toString(bool from)
     return from ? std::string("true") : std::string("false");
 }
 
+std::string toRoundTripString(float from)
+{
+    return detail::toStringUsingChars<float>(from, &toRoundTripChars);
+}
+
+std::string toRoundTripString(double from)
+{
+    return detail::toStringUsingChars<double>(from, &toRoundTripChars);
+}
+
+char* toChars(char* first, char* last, bool from)
+{
+    return from ? detail::copyChars(first, last, "true", 4) :
+                  detail::copyChars(first, last, "false", 5);
+}
+
+char* toChars(char* first, char* last, std::int8_t from)
+{
+    return detail::signedToChars<std::uint32_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::int16_t from)
+{
+    return detail::signedToChars<std::uint32_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::int32_t from)
+{
+    return detail::signedToChars<std::uint32_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::int64_t from)
+{
+    return detail::signedToChars<std::uint64_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::uint8_t from)
+{
+    return detail::unsignedToChars<std::uint32_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::uint16_t from)
+{
+    return detail::unsignedToChars<std::uint32_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::uint32_t from)
+{
+    return detail::unsignedToChars<std::uint32_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, std::uint64_t from)
+{
+    return detail::unsignedToChars<std::uint64_t>(first, last, from);
+}
+
+char* toChars(char* first, char* last, float from)
+{
+    return detail::fixedToChars(first, last, from);
+}
+
+char* toChars(char* first, char* last, double from)
+{
+    return detail::fixedToChars(first, last, from);
+}
+
+char* toRoundTripChars(char* first, char* last, float from)
+{
+    return detail::roundTripToChars(first, last, from);
+}
+
+char* toRoundTripChars(char* first, char* last, double from)
+{
+    return detail::roundTripToChars(first, last, from);
+}
+
 } // namespace strings
 } // namespace a_util
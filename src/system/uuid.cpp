@@ -9,33 +9,270 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
-#include "uuid++.hh"
+#include <a_util/system/detail/chacha20.h>
+#include <a_util/system/uuid.h>
 
-#include <a_util/concurrency/fast_mutex.h>
-#include <a_util/concurrency/mutex.h>
-#include <a_util/system.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <random>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif // !_WIN32
 
 namespace a_util {
 namespace system {
-std::string generateUUIDv4()
+namespace {
+void wipe(void* destination, std::size_t size)
+{
+    // volatile keeps the compiler from dropping the stores to memory that is not read again
+    volatile std::uint8_t* bytes = static_cast<volatile std::uint8_t*>(destination);
+    while (size-- > 0) {
+        *bytes++ = 0;
+    }
+}
+
+std::uint32_t rotateLeft(std::uint32_t value, int shift)
+{
+    return (value << shift) | (value >> (32 - shift));
+}
+
+void quarterRound(std::array<std::uint32_t, 16>& state,
+                  std::size_t a,
+                  std::size_t b,
+                  std::size_t c,
+                  std::size_t d)
+{
+    state[a] += state[b];
+    state[d] = rotateLeft(state[d] ^ state[a], 16);
+    state[c] += state[d];
+    state[b] = rotateLeft(state[b] ^ state[c], 12);
+    state[a] += state[b];
+    state[d] = rotateLeft(state[d] ^ state[a], 8);
+    state[c] += state[d];
+    state[b] = rotateLeft(state[b] ^ state[c], 7);
+}
+
+std::uint32_t readLittleEndian(const std::uint8_t* source)
+{
+    return static_cast<std::uint32_t>(source[0]) | static_cast<std::uint32_t>(source[1]) << 8 |
+           static_cast<std::uint32_t>(source[2]) << 16 |
+           static_cast<std::uint32_t>(source[3]) << 24;
+}
+
+} // namespace
+
+namespace detail {
+void chaCha20Block(const std::array<std::uint32_t, 8>& key,
+                   std::uint32_t counter,
+                   const std::array<std::uint32_t, 3>& nonce,
+                   std::uint8_t* destination)
+{
+    // "expand 32-byte k", the key, the block counter and the nonce
+    std::array<std::uint32_t, 16> input = {{0x61707865, 0x3320646e, 0x79622d32, 0x6b206574}};
+    std::copy(key.begin(), key.end(), input.begin() + 4);
+    input[12] = counter;
+    std::copy(nonce.begin(), nonce.end(), input.begin() + 13);
+    std::array<std::uint32_t, 16> state = input;
+    for (int double_round = 0; double_round < 10; ++double_round) {
+        quarterRound(state, 0, 4, 8, 12);
+        quarterRound(state, 1, 5, 9, 13);
+        quarterRound(state, 2, 6, 10, 14);
+        quarterRound(state, 3, 7, 11, 15);
+        quarterRound(state, 0, 5, 10, 15);
+        quarterRound(state, 1, 6, 11, 12);
+        quarterRound(state, 2, 7, 8, 13);
+        quarterRound(state, 3, 4, 9, 14);
+    }
+    for (std::size_t index = 0; index < state.size(); ++index) {
+        const std::uint32_t word = state[index] + input[index];
+        destination[index * 4] = static_cast<std::uint8_t>(word);
+        destination[index * 4 + 1] = static_cast<std::uint8_t>(word >> 8);
+        destination[index * 4 + 2] = static_cast<std::uint8_t>(word >> 16);
+        destination[index * 4 + 3] = static_cast<std::uint8_t>(word >> 24);
+    }
+    wipe(input.data(), sizeof(input));
+    wipe(state.data(), sizeof(state));
+}
+
+} // namespace detail
+
+namespace {
+#ifndef _WIN32
+std::atomic<std::uint32_t> fork_generation{0};
+
+/// Count the forks, a child process inherits the generator states of its parent
+std::uint32_t getForkGeneration()
+{
+    static const int registered = ::pthread_atfork(
+        nullptr, nullptr, []() { fork_generation.fetch_add(1, std::memory_order_relaxed); });
+    static_cast<void>(registered);
+    return fork_generation.load(std::memory_order_relaxed);
+}
+#else
+std::uint32_t getForkGeneration()
 {
-    static uuid instance;
-    static a_util::concurrency::fast_mutex mutex;
+    return 0;
+}
+#endif // !_WIN32
 
-    std::string res;
-    res.reserve(36);
+/**
+ * ChaCha20 (D. J. Bernstein, RFC 8439) as cryptographically secure generator, keyed from the random
+ * device of the operating system. Every refill of the buffer replaces the key with the first bytes
+ * of the output (fast key erasure), and handed out bytes are wiped, so former output cannot be
+ * reconstructed from the state.
+ */
+class RandomGenerator {
+public:
+    RandomGenerator() : _key(), _buffer(), _position(buffer_size), _fork_generation(0)
+    {
+        seed();
+    }
+
+    ~RandomGenerator()
+    {
+        wipe(_key.data(), sizeof(_key));
+        wipe(_buffer.data(), _buffer.size());
+    }
+
+    /**
+     * Fill a buffer with random bytes
+     * @param[out] destination The buffer
+     * @param[in] size The size of the buffer, at most the output of one refill
+     */
+    void fill(std::uint8_t* destination, std::size_t size)
+    {
+        if (_fork_generation != getForkGeneration()) {
+            seed();
+        }
+        if (buffer_size - _position < size) {
+            refill();
+        }
+        std::memcpy(destination, &_buffer[_position], size);
+        wipe(&_buffer[_position], size);
+        _position += size;
+    }
+
+private:
+    static constexpr std::size_t block_size = detail::chacha20_block_size;
+    static constexpr std::size_t block_count = 8;
+    static constexpr std::size_t buffer_size = block_size * block_count;
+    static constexpr std::size_t key_size = 32;
+
+    void seed()
+    {
+        _fork_generation = getForkGeneration();
+        std::random_device device;
+        for (auto& word: _key) {
+            word = static_cast<std::uint32_t>(device());
+        }
+        // a forked child must not hand out the bytes its parent buffered
+        wipe(_buffer.data(), _buffer.size());
+        _position = buffer_size;
+    }
 
+    void refill()
     {
-        a_util::concurrency::unique_lock<a_util::concurrency::fast_mutex> lock(mutex);
-        instance.make(UUID_MAKE_V4);
-        char* ptr = instance.string();
-        if (ptr) {
-            res.assign(ptr);
-            free(ptr);
+        for (std::size_t block = 0; block < block_count; ++block) {
+            // the key is never reused, so the nonce can stay zero
+            detail::chaCha20Block(
+                _key, static_cast<std::uint32_t>(block), {{0, 0, 0}}, &_buffer[block * block_size]);
+        }
+        for (std::size_t index = 0; index < _key.size(); ++index) {
+            _key[index] = readLittleEndian(&_buffer[index * 4]);
         }
+        wipe(_buffer.data(), key_size);
+        _position = key_size;
+    }
+
+    std::array<std::uint32_t, 8> _key;
+    std::array<std::uint8_t, buffer_size> _buffer;
+    std::size_t _position;
+    std::uint32_t _fork_generation;
+};
+
+} // namespace
+
+Uuid::Uuid() : _bytes()
+{
+}
+
+Uuid::Uuid(const Bytes& bytes) : _bytes(bytes)
+{
+}
+
+const Uuid::Bytes& Uuid::getBytes() const
+{
+    return _bytes;
+}
+
+bool Uuid::isNil() const
+{
+    return *this == Uuid();
+}
+
+void Uuid::format(char* destination) const
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    for (std::size_t index = 0; index < _bytes.size(); ++index) {
+        if (index == 4 || index == 6 || index == 8 || index == 10) {
+            *destination++ = '-';
+        }
+        *destination++ = hex_digits[_bytes[index] >> 4];
+        *destination++ = hex_digits[_bytes[index] & 0x0F];
+    }
+}
+
+std::string Uuid::toString() const
+{
+    std::string result(string_length, '-');
+    format(&result[0]);
+    return result;
+}
+
+std::size_t Uuid::getHash() const
+{
+    std::uint64_t high = 0;
+    std::uint64_t low = 0;
+    for (std::size_t index = 0; index < 8; ++index) {
+        high = (high << 8) | _bytes[index];
+        low = (low << 8) | _bytes[index + 8];
     }
+    // combine the halves like boost::hash_combine, UUIDs are not necessarily random
+    const std::uint64_t hash = high ^ (low + 0x9E3779B97F4A7C15ULL + (high << 6) + (high >> 2));
+    return static_cast<std::size_t>(hash ^ (hash >> 32));
+}
 
-    return res;
+bool operator==(const Uuid& lhs, const Uuid& rhs)
+{
+    return lhs.getBytes() == rhs.getBytes();
+}
+
+bool operator!=(const Uuid& lhs, const Uuid& rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool operator<(const Uuid& lhs, const Uuid& rhs)
+{
+    return lhs.getBytes() < rhs.getBytes();
+}
+
+Uuid generateBinaryUUIDv4()
+{
+    thread_local RandomGenerator generator;
+    Uuid::Bytes bytes;
+    generator.fill(bytes.data(), bytes.size());
+    // version 4 and variant RFC 4122
+    bytes[6] = static_cast<std::uint8_t>((bytes[6] & 0x0F) | 0x40);
+    bytes[8] = static_cast<std::uint8_t>((bytes[8] & 0x3F) | 0x80);
+    return Uuid(bytes);
+}
+
+std::string generateUUIDv4()
+{
+    return generateBinaryUUIDv4().toString();
 }
 
 } // namespace system
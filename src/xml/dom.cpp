@@ -16,6 +16,8 @@
 
 #include <algorithm> //std::equal
 #include <functional>
+#include <mutex>
+#include <unordered_map>
 
 namespace a_util {
 namespace xml {
@@ -24,11 +26,105 @@ namespace xml {
 
 // XML line indendation used in toString/save
 static const char* const xml_indentation = "    ";
+// Count of query strings with compiled queries cached per DOM
+static const std::size_t query_cache_size = 64;
 
 DOMException::DOMException(const std::string& what) : std::runtime_error(what.c_str())
 {
 }
 
+// DOMQuery implementation
+class DOMQuery::Implementation {
+public:
+    std::string _query_string;
+    std::unique_ptr<const pugi::xpath_query> _query;
+    std::string _last_error;
+
+    explicit Implementation(const std::string& query) : _query_string(query)
+    {
+        try {
+            _query.reset(new pugi::xpath_query(query.c_str()));
+        }
+        catch (const pugi::xpath_exception& exception) {
+            _last_error = exception.what();
+        }
+    }
+};
+
+DOMQuery::DOMQuery()
+{
+}
+
+DOMQuery::DOMQuery(const std::string& query) : _impl(std::make_shared<Implementation>(query))
+{
+}
+
+DOMQuery::~DOMQuery()
+{
+}
+
+bool DOMQuery::isValid() const
+{
+    return _impl && _impl->_query;
+}
+
+std::string DOMQuery::getQuery() const
+{
+    return _impl ? _impl->_query_string : std::string();
+}
+
+std::string DOMQuery::getLastError() const
+{
+    return _impl ? _impl->_last_error : std::string();
+}
+
+namespace {
+/**
+ * Least recently used cache of compiled queries (thread-safe).
+ * Invalid queries are cached as well, so they are not compiled again on each call.
+ */
+class QueryCache {
+public:
+    DOMQuery getQuery(const std::string& query_string)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto found = _index.find(query_string);
+            if (found != _index.end()) {
+                _queries.splice(_queries.begin(), _queries, found->second);
+                return *found->second;
+            }
+        }
+        // compile without holding the lock
+        DOMQuery query(query_string);
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_index.find(query_string) == _index.end()) {
+            _queries.push_front(query);
+            _index.emplace(query_string, _queries.begin());
+            if (_queries.size() > query_cache_size) {
+                _index.erase(_queries.back().getQuery());
+                _queries.pop_back();
+            }
+        }
+        return query;
+    }
+
+private:
+    std::mutex _mutex;
+    std::list<DOMQuery> _queries;
+    std::unordered_map<std::string, std::list<DOMQuery>::iterator> _index;
+};
+
+pugi::xml_node findFirstElement(pugi::xml_node node)
+{
+    while (node && node.type() != pugi::node_element) {
+        node = node.next_sibling();
+    }
+    return node;
+}
+
+} // namespace
+
 // DOMElement implementation
 class DOMElement::Implementation {
 public:
@@ -40,6 +136,8 @@ public:
         this->_node = node;
     }
 
+    DOMQuery getQuery(const std::string& query_string) const;
+
     DOMElement createChildFromNode(pugi::xml_node new_node)
     {
         DOMElementList children;
@@ -184,13 +282,27 @@ std::string DOMElement::getPath() const
 
 bool DOMElement::findNode(const std::string& query, DOMElement& element_ptr) const
 {
+    return findNode(_impl->getQuery(query), element_ptr);
+}
+
+bool DOMElement::findNodes(const std::string& query, DOMElementList& elements) const
+{
+    return findNodes(_impl->getQuery(query), elements);
+}
+
+bool DOMElement::findNode(const DOMQuery& query, DOMElement& element_ptr) const
+{
+    if (!query.isValid()) {
+        return false;
+    }
     try {
-        pugi::xpath_node oRes = _impl->_node.select_node(query.c_str());
+        pugi::xpath_node oRes = _impl->_node.select_node(*query._impl->_query);
         if (!oRes) {
             element_ptr = DOMElement();
             return false;
         }
         else {
+            element_ptr._impl->_document = _impl->_document;
             element_ptr._impl->initFromNode(oRes.node());
         }
     }
@@ -201,17 +313,21 @@ bool DOMElement::findNode(const std::string& query, DOMElement& element_ptr) con
     return true;
 }
 
-bool DOMElement::findNodes(const std::string& query, DOMElementList& elements) const
+bool DOMElement::findNodes(const DOMQuery& query, DOMElementList& elements) const
 {
     elements.clear();
+    if (!query.isValid()) {
+        return false;
+    }
     try {
-        pugi::xpath_node_set oRes = _impl->_node.select_nodes(query.c_str());
+        pugi::xpath_node_set oRes = _impl->_node.select_nodes(*query._impl->_query);
         if (oRes.empty()) {
             return false;
         }
 
         for (pugi::xpath_node_set::const_iterator it = oRes.begin(); it != oRes.end(); ++it) {
             elements.push_back(DOMElement());
+            elements.back()._impl->_document = _impl->_document;
             elements.back()._impl->initFromNode(it->node());
         }
     }
@@ -222,6 +338,11 @@ bool DOMElement::findNodes(const std::string& query, DOMElementList& elements) c
     return true;
 }
 
+bool DOMElement::findNodes(const DOMQuery& query, DOMElementHandleList& elements) const
+{
+    return DOMElementHandle(*this).findNodes(query, elements);
+}
+
 bool DOMElement::sortNodes(const std::string& query, const SortingOrder order)
 {
     DOMElementList elements;
@@ -387,18 +508,30 @@ public:
     pugi::xml_document _document;
     DOMElement _root;
     mutable std::string _last_error;
+    std::unique_ptr<QueryCache> _query_cache;
 
-    Implementation() : _document(), _root(), _last_error()
+    Implementation() : _document(), _root(), _last_error(), _query_cache(new QueryCache())
     {
     }
 
     Implementation(const Implementation& other)
-        : _document(), _root(other._root), _last_error(other._last_error)
+        : _document(),
+          _root(other._root),
+          _last_error(other._last_error),
+          _query_cache(new QueryCache())
     {
         _document.reset(other._document);
     }
 };
 
+DOMQuery DOMElement::Implementation::getQuery(const std::string& query_string) const
+{
+    if (_document) {
+        return _document->_impl->_query_cache->getQuery(query_string);
+    }
+    return DOMQuery(query_string);
+}
+
 DOM::~DOM()
 {
 }
@@ -507,6 +640,16 @@ bool DOM::findNodes(const std::string& query, DOMElementList& elements) const
     return getRoot().findNodes(query, elements);
 }
 
+bool DOM::findNode(const DOMQuery& query, DOMElement& element_ptr) const
+{
+    return getRoot().findNode(query, element_ptr);
+}
+
+bool DOM::findNodes(const DOMQuery& query, DOMElementList& elements) const
+{
+    return getRoot().findNodes(query, elements);
+}
+
 std::string DOM::getLastError() const
 {
     return _impl->_last_error;
@@ -517,6 +660,135 @@ bool DOM::isNull() const
     return *this == DOM();
 }
 
+// DOMElementHandle implementation
+namespace {
+pugi::xml_node toNode(void* node)
+{
+    return pugi::xml_node(static_cast<pugi::xml_node_struct*>(node));
+}
+
+} // namespace
+
+DOMElementHandle::DOMElementHandle(const DOMElement& element)
+    : _node(element._impl->_node.internal_object()), _document(element._impl->_document)
+{
+}
+
+const char* DOMElementHandle::getName() const
+{
+    return toNode(_node).name();
+}
+
+const char* DOMElementHandle::getAttribute(const char* name, const char* def_value) const
+{
+    const pugi::xml_attribute attr = toNode(_node).attribute(name);
+    return attr ? attr.value() : def_value;
+}
+
+bool DOMElementHandle::hasAttribute(const char* name) const
+{
+    return !toNode(_node).attribute(name).empty();
+}
+
+const char* DOMElementHandle::getData() const
+{
+    return toNode(_node).child_value();
+}
+
+DOMElementHandle DOMElementHandle::getParent() const
+{
+    DOMElementHandle parent(*this);
+    const pugi::xml_node node = toNode(_node).parent();
+    parent._node = node.type() == pugi::node_element ? node.internal_object() : nullptr;
+    return parent;
+}
+
+DOMElementHandle DOMElementHandle::getFirstChild() const
+{
+    DOMElementHandle child(*this);
+    child._node = findFirstElement(toNode(_node).first_child()).internal_object();
+    return child;
+}
+
+DOMElementHandle DOMElementHandle::getChild(const char* name) const
+{
+    DOMElementHandle child(*this);
+    child._node = toNode(_node).child(name).internal_object();
+    return child;
+}
+
+DOMElementHandle DOMElementHandle::getNextSibling() const
+{
+    DOMElementHandle sibling(*this);
+    sibling._node = findFirstElement(toNode(_node).next_sibling()).internal_object();
+    return sibling;
+}
+
+bool DOMElementHandle::findNode(const DOMQuery& query, DOMElementHandle& element) const
+{
+    element = DOMElementHandle();
+    if (!query.isValid()) {
+        return false;
+    }
+    try {
+        const pugi::xpath_node result = toNode(_node).select_node(*query._impl->_query);
+        if (!result) {
+            return false;
+        }
+        element._node = result.node().internal_object();
+        element._document = _document;
+    }
+    catch (pugi::xpath_exception&) {
+        return false;
+    }
+
+    return true;
+}
+
+bool DOMElementHandle::findNodes(const DOMQuery& query, DOMElementHandleList& elements) const
+{
+    elements.clear();
+    if (!query.isValid()) {
+        return false;
+    }
+    try {
+        const pugi::xpath_node_set result = toNode(_node).select_nodes(*query._impl->_query);
+        elements.reserve(result.size());
+        for (const auto& xpath_node: result) {
+            elements.push_back(*this);
+            elements.back()._node = xpath_node.node().internal_object();
+        }
+    }
+    catch (pugi::xpath_exception&) {
+        return false;
+    }
+
+    return !elements.empty();
+}
+
+DOMElement DOMElementHandle::toElement() const
+{
+    DOMElement element;
+    element._impl->_document = _document;
+    element._impl->initFromNode(toNode(_node));
+    return element;
+}
+
+bool DOMElementHandle::isNull() const
+{
+    return _node == nullptr;
+}
+
+bool DOMElementHandle::operator==(const DOMElementHandle& other) const
+{
+    return _node == other._node;
+}
+
+bool DOMElementHandle::operator!=(const DOMElementHandle& other) const
+{
+    return !(*this == other);
+}
+
 bool operator==(const DOM& lhs, const DOM& rhs)
 {
     return lhs.getRoot() == rhs.getRoot();
@@ -0,0 +1,310 @@
+/**
+ * @file
+ * Executor test implementation
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <a_util/concurrency/executor.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+using a_util::concurrency::executor;
+using a_util::concurrency::executor_options;
+using a_util::concurrency::task_future;
+
+namespace {
+executor_options withThreads(std::size_t thread_count)
+{
+    executor_options options;
+    options.thread_count = thread_count;
+    return options;
+}
+
+/// blocks tasks until opened
+class Gate {
+public:
+    void open()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _open = true;
+        _condition.notify_all();
+    }
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _open; });
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _open = false;
+};
+} // namespace
+
+TEST(executor_test, TestSubmitReturnsResult)
+{
+    executor pool(withThreads(2));
+    EXPECT_EQ(2u, pool.thread_count());
+    task_future<int> future = pool.submit([]() { return 42; });
+    ASSERT_TRUE(future.valid());
+    EXPECT_EQ(42, future.get());
+
+    task_future<void> failing = pool.submit([]() { throw std::runtime_error("failed"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+    EXPECT_FALSE(task_future<int>().valid());
+}
+
+TEST(executor_test, TestDestructorRunsAllTasks)
+{
+    std::atomic<int> count{0};
+    {
+        executor pool(withThreads(2));
+        for (int task = 0; task < 1000; ++task) {
+            pool.post([&count, &pool]() {
+                // tasks may post further tasks until the destructor finished
+                pool.post([&count]() { ++count; });
+                ++count;
+            });
+        }
+    }
+    EXPECT_EQ(2000, count);
+}
+
+TEST(executor_test, TestIdleWorkersStealTasks)
+{
+    executor pool(withThreads(2));
+    // the nested task is pushed to the deque of the worker blocked in the outer task, so it
+    // only completes if the other worker steals it
+    auto future = pool.submit([&pool]() {
+        auto nested = pool.submit([]() { return std::this_thread::get_id(); });
+        EXPECT_NE(std::this_thread::get_id(), nested.get());
+        return true;
+    });
+    EXPECT_TRUE(future.get());
+}
+
+TEST(executor_test, TestContinuations)
+{
+    executor pool(withThreads(2));
+    Gate gate;
+    auto first = pool.submit([&gate]() {
+        gate.wait();
+        return 20;
+    });
+    auto second = first.then([](task_future<int> result) { return result.get() + 1; });
+    auto third = second.then([](const task_future<int>& result) { return result.get() * 2; });
+    EXPECT_EQ(std::future_status::timeout, third.wait_for(std::chrono::milliseconds(10)));
+    gate.open();
+    EXPECT_EQ(42, third.get());
+
+    // added to an already completed task
+    EXPECT_EQ(43, first.then([](task_future<int> result) { return result.get() + 23; }).get());
+
+    // exceptions are passed to the continuation
+    auto failing = pool.submit([]() -> int { throw std::runtime_error("failed"); });
+    auto handled = failing.then([](task_future<int> result) {
+        try {
+            return result.get();
+        }
+        catch (const std::runtime_error&) {
+            return -1;
+        }
+    });
+    EXPECT_EQ(-1, handled.get());
+}
+
+TEST(executor_test, TestParallelFor)
+{
+    executor pool(withThreads(4));
+    std::vector<std::atomic<int>> visits(10007);
+    for (auto& visit: visits) {
+        visit = 0;
+    }
+    pool.parallel_for(0, visits.size(), [&visits](std::size_t index) { ++visits[index]; });
+    for (const auto& visit: visits) {
+        ASSERT_EQ(1, visit.load());
+    }
+
+    // partial range and explicit grain size
+    pool.parallel_for(5, 10, [&visits](std::size_t index) { ++visits[index]; }, 2);
+    EXPECT_EQ(1, visits[4].load());
+    EXPECT_EQ(2, visits[5].load());
+    EXPECT_EQ(2, visits[9].load());
+    EXPECT_EQ(1, visits[10].load());
+    pool.parallel_for(10, 10, [](std::size_t) { FAIL(); });
+
+    // all indices are processed, the first exception is rethrown afterwards
+    std::atomic<int> count{0};
+    EXPECT_THROW(pool.parallel_for(0,
+                                   1000,
+                                   [&count](std::size_t index) {
+                                       ++count;
+                                       if (index % 100 == 0) {
+                                           throw std::out_of_range("index");
+                                       }
+                                   },
+                                   1),
+                 std::out_of_range);
+    EXPECT_EQ(1000, count);
+}
+
+TEST(executor_test, TestNestedParallelFor)
+{
+    executor pool(withThreads(2));
+    std::atomic<int> count{0};
+    // every worker blocks in the outer loop, the inner loops must not wait for queued helpers
+    pool.parallel_for(
+        0,
+        8,
+        [&pool, &count](std::size_t) {
+            pool.parallel_for(0, 100, [&count](std::size_t) { ++count; });
+        },
+        1);
+    EXPECT_EQ(800, count);
+}
+
+TEST(executor_test, TestBoundedSubmission)
+{
+    executor_options options = withThreads(1);
+    options.max_queued_tasks = 1;
+    executor pool(options);
+    Gate gate;
+    std::promise<void> running;
+    pool.post([&gate, &running]() {
+        running.set_value();
+        gate.wait();
+    });
+    running.get_future().wait();
+
+    std::atomic<int> count{0};
+    EXPECT_TRUE(pool.try_post([&count]() { ++count; }));
+    EXPECT_FALSE(pool.try_post([&count]() { ++count; }));
+    EXPECT_FALSE(pool.try_submit([]() { return 1; }).valid());
+
+    // blocks until the worker took the queued task
+    std::atomic<bool> posted{false};
+    std::thread submitter([&]() {
+        pool.post([&count]() { ++count; });
+        posted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(posted);
+    gate.open();
+    submitter.join();
+    EXPECT_TRUE(posted);
+    EXPECT_EQ(2, pool.submit([&count]() { return count.load(); }).get());
+}
+
+#if defined(__linux__)
+TEST(executor_test, TestThreadOptions)
+{
+    executor_options options = withThreads(2);
+    options.thread_name = "exec_test_";
+    options.pin_threads = true;
+    executor pool(options);
+    const std::string name = pool.submit([]() {
+                                     char buffer[16] = {};
+                                     pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+                                     return std::string(buffer);
+                                 })
+                                 .get();
+    EXPECT_EQ(0u, name.find("exec_test_"));
+    EXPECT_EQ(11u, name.size());
+}
+#endif
+
+TEST(executor_test, TestTaskThroughputPerformance)
+{
+    using namespace std::chrono;
+    const auto to_ns = [](steady_clock::duration duration, int count) {
+        return duration_cast<nanoseconds>(duration).count() / count;
+    };
+    const auto work = [](int value) {
+        std::uint64_t hash = static_cast<std::uint64_t>(value);
+        for (int round = 0; round < 16; ++round) {
+            hash = hash * 6364136223846793005u + 1442695040888963407u;
+        }
+        return hash;
+    };
+
+    const int async_count = 2000;
+    std::vector<std::future<std::uint64_t>> async_futures;
+    async_futures.reserve(async_count);
+    const auto start_async = steady_clock::now();
+    for (int task = 0; task < async_count; ++task) {
+        async_futures.push_back(std::async(std::launch::async, work, task));
+    }
+    std::uint64_t sum = 0;
+    for (auto& future: async_futures) {
+        sum += future.get();
+    }
+    const auto duration_async = steady_clock::now() - start_async;
+
+    executor pool;
+    const int task_count = 100000;
+    std::vector<task_future<std::uint64_t>> futures;
+    futures.reserve(task_count);
+    const auto start_submit = steady_clock::now();
+    for (int task = 0; task < task_count; ++task) {
+        futures.push_back(pool.submit([work, task]() { return work(task); }));
+    }
+    for (auto& future: futures) {
+        sum += future.get();
+    }
+    const auto duration_submit = steady_clock::now() - start_submit;
+
+    std::atomic<std::uint64_t> posted_sum{0};
+    std::atomic<int> posted_done{0};
+    const auto start_post = steady_clock::now();
+    pool.post([&pool, &posted_sum, &posted_done, work, task_count]() {
+        // posted from a worker, so the tasks go to the work stealing deques
+        for (int task = 0; task < task_count; ++task) {
+            pool.post([&posted_sum, &posted_done, work, task]() {
+                posted_sum += work(task);
+                ++posted_done;
+            });
+        }
+    });
+    while (posted_done.load() < task_count) {
+        std::this_thread::yield();
+    }
+    const auto duration_post = steady_clock::now() - start_post;
+
+    std::atomic<std::uint64_t> loop_sum{0};
+    const auto start_parallel_for = steady_clock::now();
+    pool.parallel_for(0, task_count, [&loop_sum, work](std::size_t index) {
+        loop_sum += work(static_cast<int>(index));
+    });
+    const auto duration_parallel_for = steady_clock::now() - start_parallel_for;
+
+    std::cout << "std::async: " << to_ns(duration_async, async_count) << " ns/task" << std::endl
+              << "executor::submit: " << to_ns(duration_submit, task_count) << " ns/task"
+              << std::endl
+              << "executor::post from a task: " << to_ns(duration_post, task_count) << " ns/task"
+              << std::endl
+              << "executor::parallel_for: " << to_ns(duration_parallel_for, task_count)
+              << " ns/index" << std::endl;
+    EXPECT_NE(0u, sum + posted_sum + loop_sum);
+}
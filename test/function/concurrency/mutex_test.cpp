@@ -17,6 +17,16 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
 template <typename Mutex>
 struct MutexTestStruct {
     Mutex mtx;
@@ -94,3 +104,149 @@ TEST(mutex_test, TestSharedMutex)
     ASSERT_FALSE(m.try_lock());
     ASSERT_FALSE(m.try_lock_shared());
 }
+
+TEST(mutex_test, TestSharedMutexConcurrentReadersAndWriters)
+{
+    a_util::concurrency::shared_mutex m;
+    // the writers keep both values equal, readers must never see them differ
+    std::uint64_t first = 0, second = 0;
+    std::atomic<bool> inconsistent{false};
+    std::vector<std::thread> threads;
+    for (int reader = 0; reader < 8; ++reader) {
+        threads.emplace_back([&]() {
+            for (int count = 0; count < 20000; ++count) {
+                m.lock_shared();
+                if (first != second) {
+                    inconsistent = true;
+                }
+                m.unlock_shared();
+            }
+        });
+    }
+    for (int writer = 0; writer < 2; ++writer) {
+        threads.emplace_back([&]() {
+            for (int count = 0; count < 20000; ++count) {
+                m.lock();
+                ++first;
+                ++second;
+                m.unlock();
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(inconsistent);
+    EXPECT_EQ(40000u, first);
+    EXPECT_EQ(40000u, second);
+}
+
+TEST(mutex_test, TestSharedMutexPrefersWriters)
+{
+    a_util::concurrency::shared_mutex m;
+    m.lock_shared();
+    std::atomic<bool> written{false};
+    std::thread writer([&]() {
+        m.lock();
+        written = true;
+        m.unlock();
+    });
+    // a waiting writer blocks new readers, so continuous readers can not starve it
+    while (m.try_lock_shared()) {
+        m.unlock_shared();
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(written);
+    m.unlock_shared();
+    writer.join();
+    EXPECT_TRUE(written);
+    m.lock_shared();
+    m.unlock_shared();
+}
+
+namespace {
+struct ContentionResult {
+    double reads_per_second;
+    double writes_per_second;
+};
+
+/// readers and one writer lock continuously for @c run_time
+template <typename SharedMutex>
+ContentionResult measureContention(int reader_count, std::chrono::milliseconds run_time)
+{
+    using namespace std::chrono;
+    SharedMutex m;
+    std::atomic<int> started{0};
+    std::atomic<bool> go{false};
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> reads{0};
+    std::uint64_t value = 0;
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < reader_count; ++reader) {
+        readers.emplace_back([&]() {
+            ++started;
+            while (!go) {
+                std::this_thread::yield();
+            }
+            std::uint64_t count = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                m.lock_shared();
+                count += value & 1;
+                m.unlock_shared();
+                ++count;
+            }
+            reads += count;
+        });
+    }
+    while (started < reader_count) {
+        std::this_thread::yield();
+    }
+
+    // the writer might not get the lock at all with a reader-preferring mutex, so it is stopped by
+    // another thread
+    std::mutex timer_mutex;
+    std::condition_variable timer_condition;
+    std::thread timer([&]() {
+        std::unique_lock<std::mutex> lock(timer_mutex);
+        timer_condition.wait_for(lock, run_time, [&]() { return stop.load(); });
+        stop = true;
+    });
+
+    std::uint64_t writes = 0;
+    const auto start = steady_clock::now();
+    go = true;
+    while (!stop.load(std::memory_order_relaxed)) {
+        m.lock();
+        ++value;
+        m.unlock();
+        ++writes;
+    }
+    timer.join();
+    for (auto& reader: readers) {
+        reader.join();
+    }
+    const double seconds = duration_cast<duration<double>>(steady_clock::now() - start).count();
+    return {static_cast<double>(reads.load()) / seconds, static_cast<double>(writes) / seconds};
+}
+
+void printContention(const char* name, const ContentionResult& result)
+{
+    std::cout << "    " << name << ": " << static_cast<std::uint64_t>(result.reads_per_second)
+              << " reads/s, " << static_cast<std::uint64_t>(result.writes_per_second)
+              << " writes/s" << std::endl;
+}
+} // namespace
+
+TEST(mutex_test, TestSharedMutexContentionPerformance)
+{
+    const std::chrono::milliseconds run_time(100);
+    for (int reader_count: {1, 4, 16, 64}) {
+        const ContentionResult result =
+            measureContention<a_util::concurrency::shared_mutex>(reader_count, run_time);
+        const ContentionResult result_std =
+            measureContention<std::shared_timed_mutex>(reader_count, run_time);
+        std::cout << reader_count << " readers + 1 writer:" << std::endl;
+        printContention("a_util shared_mutex", result);
+        printContention("std::shared_timed_mutex", result_std);
+    }
+}
@@ -0,0 +1,398 @@
+/**
+ * @file
+ * Ring buffer test implementation
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <a_util/concurrency/ring_buffer.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using a_util::concurrency::blocking_ring_buffer;
+using a_util::concurrency::mpmc_ring_buffer;
+using a_util::concurrency::spsc_ring_buffer;
+
+namespace {
+/// counts the living instances
+struct Counted {
+    static int instances;
+    explicit Counted(int init_value = 0) : value(init_value)
+    {
+        ++instances;
+    }
+    Counted(const Counted& other) : value(other.value)
+    {
+        ++instances;
+    }
+    Counted& operator=(const Counted&) = default;
+    ~Counted()
+    {
+        --instances;
+    }
+    int value;
+};
+int Counted::instances = 0;
+
+template <typename RingBuffer>
+class RingBufferTest : public ::testing::Test {
+};
+typedef ::testing::Types<spsc_ring_buffer<int>, mpmc_ring_buffer<int>> RingBufferTypes;
+TYPED_TEST_SUITE(RingBufferTest, RingBufferTypes);
+
+/// mutex and condition variable based queue for comparison
+template <typename T>
+class MutexQueue {
+public:
+    explicit MutexQueue(std::size_t capacity) : _capacity(capacity)
+    {
+    }
+    void push(const T& value)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_full.wait(lock, [this]() { return _queue.size() < _capacity; });
+        _queue.push_back(value);
+        _not_empty.notify_one();
+    }
+    void pop(T& value)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_empty.wait(lock, [this]() { return !_queue.empty(); });
+        value = _queue.front();
+        _queue.pop_front();
+        _not_full.notify_one();
+    }
+
+private:
+    const std::size_t _capacity;
+    std::mutex _mutex;
+    std::condition_variable _not_full;
+    std::condition_variable _not_empty;
+    std::deque<T> _queue;
+};
+
+/// spinning (yielding) push and pop on the lock-free buffers
+template <typename RingBuffer>
+class SpinningQueue {
+public:
+    explicit SpinningQueue(std::size_t capacity) : _ring_buffer(capacity)
+    {
+    }
+    void push(const typename RingBuffer::value_type& value)
+    {
+        while (!_ring_buffer.try_push(value)) {
+            std::this_thread::yield();
+        }
+    }
+    void pop(typename RingBuffer::value_type& value)
+    {
+        while (!_ring_buffer.try_pop(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    RingBuffer _ring_buffer;
+};
+
+template <typename Queue>
+double measureThroughput(std::size_t count)
+{
+    using namespace std::chrono;
+    Queue queue(1024);
+    const auto start = steady_clock::now();
+    std::thread producer([&queue, count]() {
+        for (std::size_t value = 0; value < count; ++value) {
+            queue.push(value);
+        }
+    });
+    std::size_t value = 0;
+    for (std::size_t index = 0; index < count; ++index) {
+        queue.pop(value);
+    }
+    producer.join();
+    return static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start).count()) /
+           static_cast<double>(count);
+}
+
+template <typename Queue>
+double measureRoundTrip(std::size_t count)
+{
+    using namespace std::chrono;
+    Queue ping(16), pong(16);
+    std::thread echo([&ping, &pong, count]() {
+        std::size_t value = 0;
+        for (std::size_t index = 0; index < count; ++index) {
+            ping.pop(value);
+            pong.push(value);
+        }
+    });
+    const auto start = steady_clock::now();
+    std::size_t value = 0;
+    for (std::size_t index = 0; index < count; ++index) {
+        ping.push(index);
+        pong.pop(value);
+    }
+    const auto duration = steady_clock::now() - start;
+    echo.join();
+    return static_cast<double>(duration_cast<nanoseconds>(duration).count()) /
+           static_cast<double>(count);
+}
+} // namespace
+
+TYPED_TEST(RingBufferTest, TestPushPop)
+{
+    TypeParam ring_buffer(5);
+    EXPECT_EQ(8u, ring_buffer.capacity());
+    EXPECT_TRUE(ring_buffer.empty());
+    int value = 0;
+    EXPECT_FALSE(ring_buffer.try_pop(value));
+
+    for (int round = 0; round < 3; ++round) {
+        for (int index = 0; index < 8; ++index) {
+            ASSERT_TRUE(ring_buffer.try_push(index));
+        }
+        EXPECT_FALSE(ring_buffer.try_push(8));
+        EXPECT_EQ(8u, ring_buffer.size());
+        for (int index = 0; index < 8; ++index) {
+            ASSERT_TRUE(ring_buffer.try_pop(value));
+            EXPECT_EQ(index, value);
+        }
+        EXPECT_FALSE(ring_buffer.try_pop(value));
+        EXPECT_TRUE(ring_buffer.empty());
+    }
+}
+
+TYPED_TEST(RingBufferTest, TestBatchPushPop)
+{
+    TypeParam ring_buffer(8);
+    const std::vector<int> values = {0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(6u, ring_buffer.try_push_n(values.begin(), values.size()));
+    EXPECT_EQ(2u, ring_buffer.try_push_n(values.begin(), values.size()));
+    EXPECT_EQ(0u, ring_buffer.try_push_n(values.begin(), values.size()));
+
+    std::vector<int> popped(10, -1);
+    EXPECT_EQ(4u, ring_buffer.try_pop_n(popped.begin(), 4));
+    EXPECT_EQ(4u, ring_buffer.try_pop_n(popped.begin() + 4, 10));
+    EXPECT_EQ(0u, ring_buffer.try_pop_n(popped.begin(), 10));
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4, 5, 0, 1, -1, -1}), popped);
+}
+
+TEST(ring_buffer_test, TestInPlaceConstruction)
+{
+    Counted::instances = 0;
+    {
+        spsc_ring_buffer<Counted> spsc(4);
+        mpmc_ring_buffer<Counted> mpmc(4);
+        EXPECT_TRUE(spsc.try_emplace(1));
+        EXPECT_TRUE(spsc.try_emplace(2));
+        EXPECT_TRUE(mpmc.try_emplace(3));
+        EXPECT_EQ(3, Counted::instances);
+
+        // processing in place without moving out
+        ASSERT_NE(nullptr, spsc.front());
+        EXPECT_EQ(1, spsc.front()->value);
+        spsc.pop();
+        EXPECT_EQ(2, Counted::instances);
+    }
+    // the remaining elements are destroyed
+    EXPECT_EQ(0, Counted::instances);
+
+    // move only types
+    mpmc_ring_buffer<std::unique_ptr<int>> ring_buffer(2);
+    EXPECT_TRUE(ring_buffer.try_push(std::unique_ptr<int>(new int(42))));
+    std::unique_ptr<int> value;
+    EXPECT_TRUE(ring_buffer.try_pop(value));
+    EXPECT_EQ(42, *value);
+}
+
+TEST(ring_buffer_test, TestSpscOrderUnderConcurrency)
+{
+    spsc_ring_buffer<std::uint32_t> ring_buffer(64);
+    const std::uint32_t count = 200000;
+    std::thread producer([&ring_buffer, count]() {
+        std::uint32_t batch[7];
+        for (std::uint32_t next = 0; next < count;) {
+            std::uint32_t pushed = 0;
+            if (next % 3 == 0) {
+                pushed = ring_buffer.try_push(next) ? 1 : 0;
+            }
+            else {
+                const std::uint32_t batch_size = std::min<std::uint32_t>(7, count - next);
+                for (std::uint32_t index = 0; index < batch_size; ++index) {
+                    batch[index] = next + index;
+                }
+                pushed = static_cast<std::uint32_t>(ring_buffer.try_push_n(batch, batch_size));
+            }
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+        }
+    });
+    // every element is popped exactly once and in order
+    std::uint32_t expected = 0;
+    std::uint32_t batch[5];
+    while (expected < count) {
+        const std::size_t popped = ring_buffer.try_pop_n(batch, 5);
+        for (std::size_t index = 0; index < popped; ++index) {
+            ASSERT_EQ(expected++, batch[index]);
+        }
+        if (popped == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ring_buffer.empty());
+}
+
+TEST(ring_buffer_test, TestMpmcLinearizability)
+{
+    const std::uint32_t producer_count = 4, consumer_count = 4, count_per_producer = 50000;
+    mpmc_ring_buffer<std::uint64_t> ring_buffer(128);
+    std::vector<std::atomic<int>> seen(producer_count * count_per_producer);
+    for (auto& element: seen) {
+        element = 0;
+    }
+    std::atomic<bool> out_of_order{false};
+    std::atomic<std::uint32_t> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t producer = 0; producer < producer_count; ++producer) {
+        threads.emplace_back([&ring_buffer, producer, count_per_producer]() {
+            for (std::uint32_t sequence = 0; sequence < count_per_producer; ++sequence) {
+                const std::uint64_t value = (std::uint64_t(producer) << 32) | sequence;
+                while (!ring_buffer.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::uint32_t consumer = 0; consumer < consumer_count; ++consumer) {
+        threads.emplace_back([&]() {
+            // the elements of one producer are popped in order by every consumer
+            std::vector<std::int64_t> last(producer_count, -1);
+            std::uint64_t value = 0;
+            while (consumed.load() < producer_count * count_per_producer) {
+                if (!ring_buffer.try_pop(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                ++consumed;
+                const std::uint32_t producer = static_cast<std::uint32_t>(value >> 32);
+                const std::uint32_t sequence = static_cast<std::uint32_t>(value);
+                if (static_cast<std::int64_t>(sequence) <= last[producer]) {
+                    out_of_order = true;
+                }
+                last[producer] = sequence;
+                ++seen[producer * count_per_producer + sequence];
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(out_of_order);
+    for (std::size_t index = 0; index < seen.size(); ++index) {
+        ASSERT_EQ(1, seen[index].load()) << index;
+    }
+    EXPECT_TRUE(ring_buffer.empty());
+}
+
+TEST(ring_buffer_test, TestBlockingRingBuffer)
+{
+    blocking_ring_buffer<mpmc_ring_buffer<int>> ring_buffer(2);
+    EXPECT_EQ(2u, ring_buffer.capacity());
+    int value = 0;
+    EXPECT_FALSE(ring_buffer.try_pop(value));
+    EXPECT_FALSE(ring_buffer.pop_for(value, std::chrono::milliseconds(10)));
+
+    ring_buffer.push(1);
+    EXPECT_TRUE(ring_buffer.try_push(2));
+    EXPECT_FALSE(ring_buffer.try_push(3));
+
+    // blocks until the consumer popped
+    std::atomic<bool> pushed{false};
+    std::thread producer([&]() {
+        ring_buffer.emplace(3);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(pushed);
+    ring_buffer.pop(value);
+    EXPECT_EQ(1, value);
+    producer.join();
+    EXPECT_TRUE(pushed);
+    EXPECT_TRUE(ring_buffer.pop_for(value, std::chrono::milliseconds(10)));
+    EXPECT_EQ(2, value);
+    EXPECT_TRUE(ring_buffer.try_pop(value));
+    EXPECT_EQ(3, value);
+
+    // many producers and consumers
+    const int count = 20000;
+    std::atomic<std::int64_t> sum{0};
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 2; ++thread) {
+        threads.emplace_back([&ring_buffer, count]() {
+            for (int element = 1; element <= count; ++element) {
+                ring_buffer.push(element);
+            }
+        });
+        threads.emplace_back([&ring_buffer, &sum, count]() {
+            int element = 0;
+            for (int index = 0; index < count; ++index) {
+                ring_buffer.pop(element);
+                sum += element;
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    EXPECT_EQ(2 * std::int64_t(count) * (count + 1) / 2, sum.load());
+}
+
+TEST(ring_buffer_test, TestThroughputAndLatencyPerformance)
+{
+    const std::size_t count = 200000, round_trips = 5000;
+    std::cout << "1 producer, 1 consumer, " << count << " elements:" << std::endl
+              << "    mutex queue:          "
+              << measureThroughput<MutexQueue<std::size_t>>(count) << " ns/element" << std::endl
+              << "    spsc_ring_buffer:     "
+              << measureThroughput<SpinningQueue<spsc_ring_buffer<std::size_t>>>(count)
+              << " ns/element" << std::endl
+              << "    mpmc_ring_buffer:     "
+              << measureThroughput<SpinningQueue<mpmc_ring_buffer<std::size_t>>>(count)
+              << " ns/element" << std::endl
+              << "    blocking_ring_buffer: "
+              << measureThroughput<blocking_ring_buffer<spsc_ring_buffer<std::size_t>>>(count)
+              << " ns/element" << std::endl;
+    std::cout << "round trip latency:" << std::endl
+              << "    mutex queue:          "
+              << measureRoundTrip<MutexQueue<std::size_t>>(round_trips) << " ns" << std::endl
+              << "    spsc_ring_buffer:     "
+              << measureRoundTrip<SpinningQueue<spsc_ring_buffer<std::size_t>>>(round_trips)
+              << " ns" << std::endl
+              << "    mpmc_ring_buffer:     "
+              << measureRoundTrip<SpinningQueue<mpmc_ring_buffer<std::size_t>>>(round_trips)
+              << " ns" << std::endl
+              << "    blocking_ring_buffer: "
+              << measureRoundTrip<blocking_ring_buffer<spsc_ring_buffer<std::size_t>>>(
+                     round_trips)
+              << " ns" << std::endl;
+}
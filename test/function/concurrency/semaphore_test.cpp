@@ -9,6 +9,7 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include <a_util/concurrency/fast_semaphore.h>
 #include <a_util/concurrency/semaphore.h>
 #include <a_util/system.h>
 
@@ -16,11 +17,15 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <chrono>
+#include <iostream>
 #include <thread>
+#include <vector>
 
+template <typename Semaphore>
 class SemaphoreTestFixture : public ::testing::Test {
 protected:
-    a_util::concurrency::semaphore _sema;
+    Semaphore _sema;
     std::atomic<bool> _done = {};
 
 public:
@@ -32,64 +37,69 @@ public:
     }
 };
 
-TEST_F(SemaphoreTestFixture, notifyWaitForInWorkerThreadSucceeds)
+using SemaphoreTypes =
+    ::testing::Types<a_util::concurrency::semaphore, a_util::concurrency::fast_semaphore>;
+TYPED_TEST_SUITE(SemaphoreTestFixture, SemaphoreTypes);
+
+TYPED_TEST(SemaphoreTestFixture, notifyWaitForInWorkerThreadSucceeds)
 {
-    std::thread th(&SemaphoreTestFixture::work, this);
-    ASSERT_EQ(_done, false);
-    _sema.notify();
+    std::thread th(&SemaphoreTestFixture<TypeParam>::work, this);
+    ASSERT_EQ(this->_done, false);
+    this->_sema.notify();
     th.join();
-    ASSERT_EQ(_done, true);
-    ASSERT_FALSE(_sema.is_set());
+    ASSERT_EQ(this->_done, true);
+    ASSERT_FALSE(this->_sema.is_set());
 }
 
-TEST_F(SemaphoreTestFixture, waitForThrowsForNegativeTimeout)
+TYPED_TEST(SemaphoreTestFixture, waitForThrowsForNegativeTimeout)
 {
-    EXPECT_THROW(_sema.wait_for(std::chrono::milliseconds(-50)), std::invalid_argument);
-    EXPECT_FALSE(_sema.is_set());
+    EXPECT_THROW(this->_sema.wait_for(std::chrono::milliseconds(-50)), std::invalid_argument);
+    EXPECT_FALSE(this->_sema.is_set());
 }
 
-TEST_F(SemaphoreTestFixture, waitFor__successful)
+TYPED_TEST(SemaphoreTestFixture, waitFor__successful)
 {
-    _sema.notify();
-    ASSERT_TRUE(_sema.wait_for(std::chrono::milliseconds(50)));
+    this->_sema.notify();
+    ASSERT_TRUE(this->_sema.wait_for(std::chrono::milliseconds(50)));
 }
-TEST_F(SemaphoreTestFixture, waitFor__failing)
+TYPED_TEST(SemaphoreTestFixture, waitFor__failing)
 {
-    ASSERT_FALSE(_sema.wait_for(std::chrono::milliseconds(50)));
+    ASSERT_FALSE(this->_sema.wait_for(std::chrono::milliseconds(50)));
 }
 
-TEST_F(SemaphoreTestFixture, resetLockCountSucceeds)
+TYPED_TEST(SemaphoreTestFixture, resetLockCountSucceeds)
 {
-    _sema.notify();
-    ASSERT_TRUE(_sema.is_set());
-    _sema.reset();
-    ASSERT_FALSE(_sema.is_set());
+    this->_sema.notify();
+    ASSERT_TRUE(this->_sema.is_set());
+    this->_sema.reset();
+    ASSERT_FALSE(this->_sema.is_set());
 }
 
-TEST_F(SemaphoreTestFixture, tryWaitSucceeds)
+TYPED_TEST(SemaphoreTestFixture, tryWaitSucceeds)
 {
-    ASSERT_FALSE(_sema.try_wait());
-    ASSERT_FALSE(_sema.is_set());
-    _sema.notify();
-    ASSERT_TRUE(_sema.try_wait());
-    ASSERT_FALSE(_sema.is_set());
+    ASSERT_FALSE(this->_sema.try_wait());
+    ASSERT_FALSE(this->_sema.is_set());
+    this->_sema.notify();
+    ASSERT_TRUE(this->_sema.try_wait());
+    ASSERT_FALSE(this->_sema.is_set());
 }
 
-TEST_F(SemaphoreTestFixture, waitForReturnsAfterSpecifiedTime)
+TYPED_TEST(SemaphoreTestFixture, waitForReturnsAfterSpecifiedTime)
 {
     using namespace ::testing; // gmocks AllOf(), Ge() and Le()
 
     const auto start_time = a_util::system::getCurrentMilliseconds();
-    ASSERT_FALSE(_sema.wait_for(std::chrono::milliseconds(50)));
+    ASSERT_FALSE(this->_sema.wait_for(std::chrono::milliseconds(50)));
     const auto running_time = a_util::system::getCurrentMilliseconds() - start_time;
 
     // Taking the lag of the time measurement into account, the running time is estimated ...
     EXPECT_THAT(running_time, AllOf(Ge(30), Le(150)));
 }
 
+template <typename Semaphore>
 class NotifySemaphoreThread {
 public:
-    NotifySemaphoreThread(a_util::concurrency::semaphore& semaphore)
+    NotifySemaphoreThread(Semaphore& semaphore)
         : _semaphore(semaphore), _thread(&NotifySemaphoreThread::threadFunc, this)
     {
     }
@@ -107,43 +117,115 @@ private:
     }
 
 private:
-    a_util::concurrency::semaphore& _semaphore;
+    Semaphore& _semaphore;
     std::thread _thread;
 };
 
-TEST_F(SemaphoreTestFixture, notifyFromWorkerThreadSucceeds)
+TYPED_TEST(SemaphoreTestFixture, notifyFromWorkerThreadSucceeds)
 {
     using namespace ::testing; // gmocks AllOf(), Ge() and Le()
 
-    NotifySemaphoreThread unlock_sempahore_thread(_sema);
+    NotifySemaphoreThread<TypeParam> unlock_sempahore_thread(this->_sema);
     const auto start_time = a_util::system::getCurrentMilliseconds();
     // notify() fires after ~50ms, so this should return after ~50ms, not 1s
     // test timeout is set by ctest to 1s, so this test would abort for this waiting time
-    EXPECT_TRUE(_sema.wait_for(std::chrono::seconds(1)));
+    EXPECT_TRUE(this->_sema.wait_for(std::chrono::seconds(1)));
     const auto running_time = a_util::system::getCurrentMilliseconds() - start_time;
 
     // Taking the lag of the time measurement into account, the running time is estimated ...
     EXPECT_THAT(running_time, AllOf(Ge(30), Le(150)));
 }
 
-TEST_F(SemaphoreTestFixture, waitAfterNotifySucceeds)
+TYPED_TEST(SemaphoreTestFixture, waitAfterNotifySucceeds)
 {
-    _sema.notify();
-    _sema.wait();
-    ASSERT_FALSE(_sema.is_set());
+    this->_sema.notify();
+    this->_sema.wait();
+    ASSERT_FALSE(this->_sema.is_set());
 }
 
-TEST_F(SemaphoreTestFixture, waitBlocksUntilNotify)
+TYPED_TEST(SemaphoreTestFixture, waitBlocksUntilNotify)
 {
     std::atomic<bool> wait_stopped{false};
     std::thread t{[&]() {
-        _sema.wait();
+        this->_sema.wait();
         wait_stopped = true;
     }};
 
     ASSERT_FALSE(wait_stopped);
-    _sema.notify();
+    this->_sema.notify();
     t.join();
     ASSERT_TRUE(wait_stopped);
-    ASSERT_FALSE(_sema.is_set());
+    ASSERT_FALSE(this->_sema.is_set());
+}
+
+TYPED_TEST(SemaphoreTestFixture, concurrentNotifyAndWaitKeepsCount)
+{
+    const int notify_count = 500;
+    std::vector<std::thread> threads;
+    for (int notifier = 0; notifier < 2; ++notifier) {
+        threads.emplace_back([&]() {
+            for (int notification = 0; notification < notify_count; ++notification) {
+                this->_sema.notify();
+                if (notification % 16 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    threads.emplace_back([&]() {
+        for (int taken = 0; taken < notify_count; ++taken) {
+            this->_sema.wait();
+        }
+    });
+    threads.emplace_back([&]() {
+        // timing out waits must not lose notifications
+        for (int taken = 0; taken < notify_count;) {
+            if (this->_sema.wait_for(std::chrono::microseconds(taken % 5))) {
+                ++taken;
+            }
+        }
+    });
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(this->_sema.is_set());
+    EXPECT_FALSE(this->_sema.try_wait());
+}
+
+TYPED_TEST(SemaphoreTestFixture, pingPongLatencyPerformance)
+{
+    using namespace std::chrono;
+    // few round trips, every test of semaphore_tests has to finish within its timeout of 1 s
+    const int round_trips = 500;
+    TypeParam pong;
+    std::thread partner([&]() {
+        for (int round_trip = 0; round_trip < round_trips; ++round_trip) {
+            this->_sema.wait();
+            pong.notify();
+        }
+    });
+    const auto start = steady_clock::now();
+    for (int round_trip = 0; round_trip < round_trips; ++round_trip) {
+        this->_sema.notify();
+        pong.wait();
+    }
+    const auto duration = steady_clock::now() - start;
+    partner.join();
+
+    std::cout << ::testing::UnitTest::GetInstance()->current_test_info()->type_param()
+              << " ping-pong: " << duration_cast<nanoseconds>(duration).count() / round_trips
+              << " ns/round trip" << std::endl;
+
+    // uncontended notify and wait
+    const auto start_uncontended = steady_clock::now();
+    for (int round_trip = 0; round_trip < round_trips; ++round_trip) {
+        this->_sema.notify();
+        this->_sema.wait();
+    }
+    const auto duration_uncontended = steady_clock::now() - start_uncontended;
+    std::cout << ::testing::UnitTest::GetInstance()->current_test_info()->type_param()
+              << " uncontended notify/wait: "
+              << duration_cast<nanoseconds>(duration_uncontended).count() / round_trips << " ns"
+              << std::endl;
+    EXPECT_FALSE(this->_sema.is_set());
 }
@@ -15,6 +15,14 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/time.h>
+#endif // !_WIN32
 
 #if (defined(_MSC_VER) && (_MSC_VER <= 1600)) // vc100, C++03
 
@@ -523,3 +531,139 @@ TEST(datetime_test, TestInvalidFormatDirective)
     ASSERT_THROW(dateTime.format("%s"), std::invalid_argument);
     ASSERT_EQ(dateTime.format("%%"), "%");
 }
+
+TEST(datetime_test, TestClock)
+{
+    const timestamp_t monotonic = getMonotonicMicroseconds();
+    EXPECT_GE(getMonotonicMicroseconds(), monotonic);
+    EXPECT_NEAR(static_cast<double>(getRealtimeMicroseconds()),
+                static_cast<double>(getMicroSecondsSinceUnixTimeOrigin()),
+                2000);
+
+    // the timestamp equals the one of the broken down local time
+    const timestamp_t local_timestamp = getCurrentLocalTimestamp();
+    EXPECT_NEAR(static_cast<double>(getCurrentLocalDateTime().toTimestamp()),
+                static_cast<double>(local_timestamp),
+                2000);
+    const timestamp_t unix_timestamp = getRealtimeMicroseconds();
+    EXPECT_NEAR(
+        static_cast<double>(
+            getCurrentLocalTimestamp(TimestampReference::MicroSecondsSinceUnixTimeOrigin)),
+        static_cast<double>(unix_timestamp + getUtcOffset(unix_timestamp)),
+        2000);
+    EXPECT_NEAR(static_cast<double>(getCurrentSystemDateTime().toTimestamp(
+                    TimestampReference::MicroSecondsSinceUnixTimeOrigin)),
+                static_cast<double>(unix_timestamp),
+                2000);
+}
+
+#ifndef _WIN32
+TEST(datetime_test, TestUtcOffset)
+{
+    const char* const previous_time_zone = std::getenv("TZ");
+    const std::string previous_value = previous_time_zone ? previous_time_zone : "";
+
+    // central european time, daylight saving time from 2022-03-27 01:00 UTC
+    ::setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    refreshTimeZone();
+    const timestamp_t hour = 3600000000LL;
+    const timestamp_t switch_to_summer_time =
+        DateTime(2022, 3, 27, 1, 0, 0)
+            .toTimestamp(TimestampReference::MicroSecondsSinceUnixTimeOrigin);
+    EXPECT_EQ(getUtcOffset(switch_to_summer_time - 1), hour);
+    EXPECT_EQ(getUtcOffset(switch_to_summer_time - 1), hour);
+    EXPECT_EQ(getUtcOffset(switch_to_summer_time), 2 * hour);
+    EXPECT_EQ(getUtcOffset(switch_to_summer_time + 100 * 24 * hour), 2 * hour);
+    EXPECT_EQ(getUtcOffset(-10 * 24 * hour), hour);
+
+    // a changed time zone is used after the refresh
+    ::setenv("TZ", "EST5", 1);
+    refreshTimeZone();
+    EXPECT_EQ(getUtcOffset(switch_to_summer_time), -5 * hour);
+    const DateTime local_time = getCurrentLocalDateTime();
+    DateTime expected_time;
+    expected_time.set(getRealtimeMicroseconds() - 5 * hour,
+                      TimestampReference::MicroSecondsSinceUnixTimeOrigin);
+    EXPECT_EQ(local_time.getDay(), expected_time.getDay());
+    EXPECT_EQ(local_time.getHour(), expected_time.getHour());
+
+    if (previous_time_zone) {
+        ::setenv("TZ", previous_value.c_str(), 1);
+    }
+    else {
+        ::unsetenv("TZ");
+    }
+    refreshTimeZone();
+}
+#endif // !_WIN32
+
+TEST(datetime_test, TestTimestampFormatter)
+{
+    const std::string format = "%Y-%m-%d %H:%M:%S %a %b %j %U %w %W %y %%";
+    TimestampFormatter formatter(format);
+    TimestampFormatter unix_formatter(format, TimestampReference::MicroSecondsSinceUnixTimeOrigin);
+
+    for (const auto& date_time: {DateTime(1970, 1, 1, 0, 0, 0),
+                                 DateTime(1969, 12, 31, 23, 59, 59, 999999),
+                                 DateTime(1900, 3, 1, 12, 0, 0),
+                                 DateTime(2000, 2, 29, 12, 30, 5, 10),
+                                 DateTime(2022, 12, 31, 23, 59, 59, 500000),
+                                 DateTime(2024, 7, 14, 8, 1, 2, 3)}) {
+        const std::string expected = date_time.format(format);
+        const timestamp_t timestamp = date_time.toTimestamp();
+        EXPECT_EQ(formatter.format(timestamp), expected);
+        // within the same second the text is reused
+        EXPECT_EQ(formatter.format(timestamp - date_time.getMicrosecond()), expected);
+        EXPECT_EQ(unix_formatter.format(
+                      date_time.toTimestamp(TimestampReference::MicroSecondsSinceUnixTimeOrigin)),
+                  expected);
+    }
+
+    EXPECT_EQ(TimestampFormatter("").format(0), "");
+    EXPECT_THROW(TimestampFormatter("%s"), std::invalid_argument);
+}
+
+/// Benchmark of timestamping and formatting as done per log entry
+TEST(datetime_test, TestTimestampPerformance)
+{
+    using namespace std::chrono;
+    const int count = 200000;
+    timestamp_t sum = 0;
+    std::size_t length = 0;
+    const auto measure = [&](const char* description, const auto& call) {
+        const auto start = steady_clock::now();
+        for (int index = 0; index < count; ++index) {
+            call();
+        }
+        std::cout << description << ": "
+                  << duration_cast<nanoseconds>(steady_clock::now() - start).count() / count
+                  << " nano sec per call" << std::endl;
+    };
+
+#ifndef _WIN32
+    measure("gettimeofday and localtime_r", [&]() {
+        struct timeval current_time;
+        ::gettimeofday(&current_time, nullptr);
+        struct tm local_time;
+        ::localtime_r(&current_time.tv_sec, &local_time);
+        sum += local_time.tm_sec;
+    });
+#endif // !_WIN32
+    measure("getCurrentLocalDateTime().toTimestamp()",
+            [&]() { sum += getCurrentLocalDateTime().toTimestamp(); });
+    measure("getCurrentLocalTimestamp()", [&]() { sum += getCurrentLocalTimestamp(); });
+    measure("getMonotonicMicroseconds()", [&]() { sum += getMonotonicMicroseconds(); });
+
+    const timestamp_t now = getCurrentLocalTimestamp();
+    measure("DateTime::format", [&]() {
+        DateTime date_time;
+        date_time.set(now + sum % 1000);
+        length += date_time.format("%Y-%m-%d %H:%M:%S ").size();
+    });
+    TimestampFormatter formatter("%Y-%m-%d %H:%M:%S ");
+    measure("TimestampFormatter::format",
+            [&]() { length += formatter.format(now + sum % 1000).size(); });
+
+    EXPECT_NE(sum, 0);
+    EXPECT_GT(length, 0u);
+}
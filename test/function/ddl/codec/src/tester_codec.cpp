@@ -15,13 +15,18 @@
 
 #include <a_util/system.h>
 #include <ddl/codec/codec_factory.h>
+#include <ddl/codec/codec_factory_cache.h>
+#include <ddl/codec/columnar_decoder.h>
+#include <ddl/codec/sample_diff.h>
 #include <ddl/dd/ddfile.h>
+#include <ddl/dd/ddstring.h>
 #include <ddl/serialization/serialization.h>
 
 #include <gtest/gtest.h>
 
 #include <chrono>
 #include <list>
+#include <random>
 #if (defined(__GNUC__) && (__GNUC__ < 7)) || (defined(_MSC_VER) && (_MSC_VER < 1920))
 #define NO_VARIANT_TEST
 #else
@@ -996,6 +1001,59 @@ TEST(CodecTest, TestStaticLeafCodecIndex)
     EXPECT_EQ(decoder.getElementValue<int64_t>(child_value_dummy_leaf_index), 4321);
 }
 
+/**
+ * @detail Regression test: the LeafCodecIndex of a serialized element which does not start at a
+ * byte boundary must access the bits of this element (its byte position was one byte too large).
+ */
+TEST(CodecTest, TestSerializedLeafCodecIndexNotAtByteBoundary)
+{
+    const auto description = R"(<?xml version="1.0" encoding="iso-8859-1" standalone="no"?>
+<ddl>
+    <structs>
+        <struct alignment="2" name="bits" version="1">
+            <element name="low" type="tUInt8" arraysize="1">
+                <serialized bytepos="0" bitpos="0" numbits="3" byteorder="LE"/>
+                <deserialized alignment="1"/>
+            </element>
+            <element name="middle" type="tUInt16" arraysize="1">
+                <serialized bytepos="0" bitpos="3" numbits="10" byteorder="LE"/>
+                <deserialized alignment="2"/>
+            </element>
+            <element name="high" type="tUInt8" arraysize="1">
+                <serialized bytepos="1" bitpos="5" numbits="3" byteorder="LE"/>
+                <deserialized alignment="1"/>
+            </element>
+        </struct>
+    </structs>
+</ddl>)";
+    codec::CodecFactory factory("bits", description);
+    ASSERT_TRUE(factory.isValid());
+    std::vector<uint8_t> buffer(factory.getStaticBufferSize(ddl::serialized));
+    ASSERT_EQ(buffer.size(), 2U);
+
+    const auto middle_leaf_index = codec::LeafCodecIndex(factory.getElement("middle").getIndex(),
+                                                         ddl::DataRepresentation::serialized);
+    const auto high_leaf_index = codec::LeafCodecIndex(factory.getElement("high").getIndex(),
+                                                       ddl::DataRepresentation::serialized);
+    {
+        auto codec = factory.makeCodecFor(buffer.data(), buffer.size(), ddl::serialized);
+        codec.getElement("low").setValue(5);
+        codec.getElement("middle").setValue(0x2A5);
+        codec.getElement("high").setValue(6);
+        EXPECT_EQ(codec.getElementValue<uint16_t>(middle_leaf_index), 0x2A5);
+        EXPECT_EQ(codec.getElementValue<uint8_t>(high_leaf_index), 6);
+
+        codec.setElementValue(middle_leaf_index, 0x15A);
+        codec.setElementValue(high_leaf_index, 3);
+    }
+
+    const auto decoder =
+        factory.makeStaticDecoderFor(buffer.data(), buffer.size(), ddl::serialized);
+    EXPECT_EQ(decoder.getElement("low").getValue<uint8_t>(), 5);
+    EXPECT_EQ(decoder.getElement("middle").getValue<uint16_t>(), 0x15A);
+    EXPECT_EQ(decoder.getElement("high").getValue<uint8_t>(), 3);
+}
+
 namespace dynamic_test_leaf {
 
 struct ArrayChildStruct {
@@ -1047,9 +1105,9 @@ TEST(CodecTest, TestDynamicLeafCodecIndex)
 }
 
 namespace {
-static void testPerformance(const std::function<void()>& test_call,
-                            size_t test_count,
-                            const std::string& test_description)
+static std::chrono::nanoseconds testPerformance(const std::function<void()>& test_call,
+                                                size_t test_count,
+                                                const std::string& test_description)
 {
     using namespace std::chrono_literals;
     using namespace std::chrono;
@@ -1066,6 +1124,7 @@ static void testPerformance(const std::function<void()>& test_call,
               << " micro sec per 1 iteration" << std::endl
               << "    Total (" << duration_cast<microseconds>(elapsed_measured_time_point).count()
               << " micro sec)" << std::endl;
+    return elapsed_time_per_iteration;
 }
 } // namespace
 
@@ -1475,3 +1534,1023 @@ TEST(CodecTest, useLeafCodecIndexWithArrays)
 }
 
 } // namespace static_array_access_leaf
+
+namespace reset_values {
+/**
+ * Creates a struct with @p leaf_count leaves of different types with default values, constants,
+ * serialized bit fields and deserialized padding bytes.
+ */
+std::string createDescription(size_t leaf_count)
+{
+    const std::vector<std::pair<std::string, size_t>> types = {{"tUInt8", 8},
+                                                               {"tInt16", 16},
+                                                               {"tUInt32", 32},
+                                                               {"tFloat64", 64},
+                                                               {"tBool", 8},
+                                                               {"tFloat32", 32},
+                                                               {"tInt64", 64},
+                                                               {"tEnum", 32}};
+    std::string elements;
+    size_t bit_pos = 0;
+    for (size_t leaf_idx = 0; leaf_idx < leaf_count; ++leaf_idx) {
+        const auto& type = types[leaf_idx % types.size()];
+        const size_t num_bits = (type.first == "tUInt8" && leaf_idx % 3 == 0) ? 3 : type.second;
+        elements += "<element name=\"elem_" + std::to_string(leaf_idx) + "\" type=\"" +
+                    type.first + "\" arraysize=\"1\"";
+        if (type.first == "tEnum") {
+            elements += " value=\"B\"";
+        }
+        else if (leaf_idx % 3 == 1) {
+            elements += " default=\"" + std::to_string(leaf_idx % 100) + "\"";
+        }
+        elements += "><serialized bytepos=\"" + std::to_string(bit_pos / 8) + "\" bitpos=\"" +
+                    std::to_string(bit_pos % 8) + "\" numbits=\"" + std::to_string(num_bits) +
+                    "\" byteorder=\"" + (leaf_idx % 2 ? "BE" : "LE") +
+                    "\"/><deserialized alignment=\"" + std::to_string(type.second / 8) +
+                    "\"/></element>";
+        bit_pos += num_bits;
+    }
+    return "<ddl><enums><enum name=\"tEnum\" type=\"tInt32\"><element name=\"A\" value=\"1\"/>"
+           "<element name=\"B\" value=\"2\"/></enum></enums><structs>"
+           "<struct name=\"tResetTest\" version=\"1\" alignment=\"8\">" +
+           elements + "</struct></structs></ddl>";
+}
+
+std::vector<uint8_t> createRandomData(size_t data_size)
+{
+    std::mt19937 random_engine(static_cast<std::mt19937::result_type>(data_size));
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<uint8_t> data(data_size);
+    for (auto& value: data) {
+        value = static_cast<uint8_t>(distribution(random_engine));
+    }
+    return data;
+}
+
+/**
+ * Resets the values element by element like resetValues did before the default value image.
+ */
+template <typename CodecType>
+void resetElementByElement(CodecType& codec, bool zero_values)
+{
+    codec::forEachLeafElement(codec.getElements(),
+                              [&zero_values](auto& element) { element.reset(zero_values); });
+}
+
+} // namespace reset_values
+
+/**
+ * @detail Check that resetValues with the precalculated default value image writes exactly the
+ * same bytes and bits as resetting element by element
+ */
+TEST(CodecTest, ResetValuesEqualsElementReset)
+{
+    using namespace reset_values;
+    const std::vector<std::pair<std::string, std::string>> descriptions = {
+        {"tResetTest", createDescription(100)},
+        {"main", all_types::test_description},
+        {"BigDataType",
+         ddl::DDString::toXMLString(ddl::DDFile::fromXMLFile(TEST_FILES_DIR
+                                                             "test_performance.description"))}};
+    for (const auto& description: descriptions) {
+        SCOPED_TRACE(description.first);
+        const codec::CodecFactory factory(description.first, description.second);
+        ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+        for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+            for (const auto zero_values: {false, true}) {
+                SCOPED_TRACE(::testing::Message() << "representation: " << representation
+                                                  << " zero_values: " << zero_values);
+                const auto data_size = factory.getStaticBufferSize(representation);
+                auto data_expected = createRandomData(data_size);
+                auto data_static_codec = data_expected;
+                auto data_codec = data_expected;
+
+                auto codec_expected =
+                    factory.makeStaticCodecFor(data_expected.data(), data_size, representation);
+                resetElementByElement(codec_expected, zero_values);
+
+                // twice to use the cached image
+                for (int loop = 0; loop < 2; ++loop) {
+                    auto static_codec = factory.makeStaticCodecFor(
+                        data_static_codec.data(), data_size, representation);
+                    static_codec.resetValues(zero_values);
+                    EXPECT_EQ(data_static_codec, data_expected);
+
+                    auto codec = factory.makeCodecFor(data_codec.data(), data_size, representation);
+                    codec.resetValues(zero_values);
+                    EXPECT_EQ(data_codec, data_expected);
+                }
+            }
+        }
+    }
+
+    // too small buffers are reported like before
+    const codec::CodecFactory factory("tResetTest", createDescription(100));
+    auto data = createRandomData(factory.getStaticBufferSize(ddl::deserialized));
+    auto codec = factory.makeStaticCodecFor(data.data(), data.size() / 2);
+    EXPECT_THROW(codec.resetValues(), std::runtime_error);
+}
+
+/**
+ * @detail Benchmark of resetValues of a struct with 2000 leaves against resetting element by
+ * element
+ */
+TEST(CodecTest, ResetValuesPerformance)
+{
+    using namespace reset_values;
+    const codec::CodecFactory factory("tResetTest", createDescription(2000));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+
+    const size_t test_reset_count = 100;
+    for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+        std::cout << "Representation: "
+                  << (representation == ddl::deserialized ? "deserialized" : "serialized")
+                  << std::endl;
+        auto data = createRandomData(factory.getStaticBufferSize(representation));
+        auto codec = factory.makeStaticCodecFor(data.data(), data.size(), representation);
+        // the first reset creates the default value image
+        testPerformance([&]() { codec.resetValues(true); }, 1, "First reset with resetValues");
+        testPerformance(
+            [&]() {
+                for (size_t current_test = 0; current_test < test_reset_count; ++current_test) {
+                    resetElementByElement(codec, true);
+                }
+            },
+            test_reset_count,
+            "Reset element by element");
+        testPerformance(
+            [&]() {
+                for (size_t current_test = 0; current_test < test_reset_count; ++current_test) {
+                    codec.resetValues(true);
+                }
+            },
+            test_reset_count,
+            "Reset with resetValues");
+    }
+}
+
+namespace columnar_decoder {
+/**
+ * Checks the values of the column against the values decoded sample by sample.
+ */
+template <typename T>
+void expectColumnEqualsDecoder(const codec::ColumnarDecoder& columnar_decoder,
+                               size_t column,
+                               const codec::CodecFactory& factory,
+                               const uint8_t* samples,
+                               size_t stride)
+{
+    const auto& column_name = columnar_decoder.getColumnName(column);
+    const auto index = factory.getElement(column_name).getIndex();
+    const T* values = columnar_decoder.getColumn<T>(column);
+    for (size_t sample = 0; sample < columnar_decoder.getSampleCount(); ++sample) {
+        const auto decoder = factory.makeStaticDecoderFor(samples + sample * stride,
+                                                          columnar_decoder.getSampleSize(),
+                                                          columnar_decoder.getRepresentation());
+        const T expected = decoder.getElementValue<T>(index);
+        if (std::is_same<T, bool>::value) {
+            EXPECT_EQ(expected ? 1 : 0, values[sample] ? 1 : 0)
+                << column_name << " of sample " << sample;
+        }
+        else {
+            // compare the bytes, random floating point values may be NaN
+            EXPECT_EQ(0, std::memcmp(&expected, &values[sample], sizeof(T)))
+                << column_name << " of sample " << sample;
+        }
+    }
+}
+
+void expectColumnsEqualDecoder(const codec::ColumnarDecoder& columnar_decoder,
+                               const codec::CodecFactory& factory,
+                               const uint8_t* samples,
+                               size_t stride)
+{
+    for (size_t column = 0; column < columnar_decoder.getColumnCount(); ++column) {
+        switch (columnar_decoder.getColumnType(column)) {
+        case codec::ElementType::cet_bool:
+            expectColumnEqualsDecoder<bool>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_int8:
+            expectColumnEqualsDecoder<int8_t>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_uint8:
+            expectColumnEqualsDecoder<uint8_t>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_int16:
+            expectColumnEqualsDecoder<int16_t>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_uint16:
+            expectColumnEqualsDecoder<uint16_t>(
+                columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_int32:
+            expectColumnEqualsDecoder<int32_t>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_uint32:
+            expectColumnEqualsDecoder<uint32_t>(
+                columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_int64:
+            expectColumnEqualsDecoder<int64_t>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_uint64:
+            expectColumnEqualsDecoder<uint64_t>(
+                columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_float:
+            expectColumnEqualsDecoder<float>(columnar_decoder, column, factory, samples, stride);
+            break;
+        case codec::ElementType::cet_double:
+            expectColumnEqualsDecoder<double>(columnar_decoder, column, factory, samples, stride);
+            break;
+        default:
+            ADD_FAILURE() << "unexpected column type";
+            break;
+        }
+    }
+}
+
+} // namespace columnar_decoder
+
+/**
+ * @detail Check that the ColumnarDecoder decodes the same values as the decoder sample by sample
+ */
+TEST(CodecTest, ColumnarDecoderEqualsDecoder)
+{
+    using namespace columnar_decoder;
+    const std::vector<std::pair<std::string, std::string>> descriptions = {
+        {"tResetTest", reset_values::createDescription(100)},
+        {"main", all_types::test_description},
+        {"BigDataType",
+         ddl::DDString::toXMLString(ddl::DDFile::fromXMLFile(TEST_FILES_DIR
+                                                             "test_performance.description"))}};
+    const size_t sample_count = 50;
+    for (const auto& description: descriptions) {
+        SCOPED_TRACE(description.first);
+        const codec::CodecFactory factory(description.first, description.second);
+        ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+        for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+            SCOPED_TRACE(::testing::Message() << "representation: " << representation);
+            codec::ColumnarDecoder columnar_decoder(factory, representation);
+            ASSERT_EQ(columnar_decoder.getColumnCount(), factory.getStaticElementCount());
+            ASSERT_EQ(columnar_decoder.getSampleSize(),
+                      factory.getStaticBufferSize(representation));
+            // with and without gaps between the samples
+            for (const auto gap: {size_t(0), size_t(3)}) {
+                const auto stride = columnar_decoder.getSampleSize() + gap;
+                // the last sample does not need the gap
+                const auto samples = reset_values::createRandomData(
+                    stride * sample_count - gap + (sample_count % 7));
+                EXPECT_EQ(columnar_decoder.decode(samples.data(), samples.size(), stride),
+                          sample_count);
+                EXPECT_EQ(columnar_decoder.getSampleCount(), sample_count);
+                expectColumnsEqualDecoder(columnar_decoder, factory, samples.data(), stride);
+            }
+        }
+    }
+}
+
+/**
+ * @detail Check the selection of columns and the error handling of the ColumnarDecoder
+ */
+TEST(CodecTest, ColumnarDecoderSelectColumns)
+{
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(16));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+
+    codec::ColumnarDecoder columnar_decoder(
+        factory, std::vector<std::string>{"elem_3", "elem_1"}, ddl::serialized);
+    ASSERT_EQ(columnar_decoder.getColumnCount(), 2U);
+    EXPECT_EQ(columnar_decoder.getColumnName(0), "elem_3");
+    EXPECT_EQ(columnar_decoder.getColumnType(0), codec::ElementType::cet_double);
+    EXPECT_EQ(columnar_decoder.getColumnName(1), "elem_1");
+    EXPECT_EQ(columnar_decoder.getColumnType(1), codec::ElementType::cet_int16);
+
+    std::vector<uint8_t> samples(columnar_decoder.getSampleSize() * 2);
+    for (size_t sample = 0; sample < 2; ++sample) {
+        auto codec = factory.makeStaticCodecFor(samples.data() + sample * samples.size() / 2,
+                                                samples.size() / 2,
+                                                ddl::serialized);
+        codec.setElementValue(factory.getElement("elem_3").getIndex(), 1.5 + sample);
+        codec.setElementValue(factory.getElement("elem_1").getIndex(),
+                              -1000 - static_cast<int>(sample));
+    }
+    EXPECT_EQ(columnar_decoder.decode(samples.data(), samples.size()), 2U);
+    EXPECT_EQ(columnar_decoder.getColumn<double>(0)[0], 1.5);
+    EXPECT_EQ(columnar_decoder.getColumn<double>(0)[1], 2.5);
+    EXPECT_EQ(columnar_decoder.getColumn<int16_t>(1)[0], -1000);
+    EXPECT_EQ(columnar_decoder.getColumn<int16_t>(1)[1], -1001);
+    // the columns are arrays of their value type
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(columnar_decoder.getColumn<double>(0)) % alignof(double),
+              0U);
+
+    // errors
+    EXPECT_THROW(columnar_decoder.getColumn<float>(0), std::runtime_error);
+    EXPECT_THROW(columnar_decoder.getColumn<double>(2), std::runtime_error);
+    EXPECT_THROW(columnar_decoder.decode(samples.data(), samples.size(), 1), std::runtime_error);
+    EXPECT_EQ(columnar_decoder.decode(samples.data(), samples.size() / 2 - 1), 0U);
+    EXPECT_THROW(codec::ColumnarDecoder(factory, std::vector<std::string>{"elem_16"}),
+                 std::runtime_error);
+    const codec::CodecFactory dynamic_factory("test", dynamic_test_leaf::test_description);
+    ASSERT_EQ(dynamic_factory.isValid(), a_util::result::SUCCESS);
+    EXPECT_THROW(codec::ColumnarDecoder{dynamic_factory}, std::runtime_error);
+}
+
+/**
+ * @detail Benchmark of the ColumnarDecoder against decoding sample by sample with a decoder and
+ * the LeafCodecIndex
+ */
+TEST(CodecTest, ColumnarDecoderPerformance)
+{
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(100));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+
+    const size_t sample_count = 10000;
+    for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+        std::cout << "Representation: "
+                  << (representation == ddl::deserialized ? "deserialized" : "serialized")
+                  << std::endl;
+        const auto sample_size = factory.getStaticBufferSize(representation);
+        const auto samples = reset_values::createRandomData(sample_size * sample_count);
+        const auto leaf_codec_indices = codec::getLeafCodecIndices(factory, representation);
+        std::vector<double> values(leaf_codec_indices.size() * sample_count);
+
+        const auto duration_decoder = testPerformance(
+            [&]() {
+                for (size_t sample = 0; sample < sample_count; ++sample) {
+                    const auto decoder = factory.makeStaticDecoderFor(
+                        samples.data() + sample * sample_size, sample_size, representation);
+                    for (size_t leaf = 0; leaf < leaf_codec_indices.size(); ++leaf) {
+                        values[leaf * sample_count + sample] =
+                            decoder.getElementValue<double>(leaf_codec_indices[leaf]);
+                    }
+                }
+            },
+            sample_count,
+            "Decoding sample by sample with LeafCodecIndex");
+        codec::ColumnarDecoder columnar_decoder(factory, representation);
+        const auto duration_columnar = testPerformance(
+            [&]() {
+                EXPECT_EQ(columnar_decoder.decode(samples.data(), samples.size()), sample_count);
+            },
+            sample_count,
+            "Decoding with ColumnarDecoder");
+        std::cout << "    " << static_cast<size_t>(1e9 / duration_decoder.count())
+                  << " samples/s sample by sample, "
+                  << static_cast<size_t>(1e9 / duration_columnar.count())
+                  << " samples/s with ColumnarDecoder" << std::endl;
+    }
+}
+
+namespace projection {
+/**
+ * Calls @p function with a value of the type of the element type.
+ */
+template <typename Function>
+void callWithValueType(codec::ElementType element_type, Function function)
+{
+    switch (element_type) {
+    case codec::ElementType::cet_bool:
+        return function(bool{});
+    case codec::ElementType::cet_int8:
+        return function(int8_t{});
+    case codec::ElementType::cet_uint8:
+        return function(uint8_t{});
+    case codec::ElementType::cet_int16:
+        return function(int16_t{});
+    case codec::ElementType::cet_uint16:
+        return function(uint16_t{});
+    case codec::ElementType::cet_int32:
+        return function(int32_t{});
+    case codec::ElementType::cet_uint32:
+        return function(uint32_t{});
+    case codec::ElementType::cet_int64:
+        return function(int64_t{});
+    case codec::ElementType::cet_uint64:
+        return function(uint64_t{});
+    case codec::ElementType::cet_float:
+        return function(float{});
+    case codec::ElementType::cet_double:
+        return function(double{});
+    default:
+        ADD_FAILURE() << "unexpected element type";
+    }
+}
+
+/**
+ * Checks the extracted values of the projection against the values of the decoder.
+ */
+template <typename DecoderType>
+void expectProjectionEqualsDecoder(const codec::CodecProjection& projection,
+                                   const std::vector<uint8_t>& output,
+                                   const DecoderType& decoder,
+                                   const std::vector<std::string>& element_names)
+{
+    ASSERT_EQ(projection.getElementCount(), element_names.size());
+    for (size_t element = 0; element < projection.getElementCount(); ++element) {
+        const auto element_type = projection.getElementType(element);
+        ASSERT_EQ(element_type, decoder.getElement(element_names[element]).getType());
+        callWithValueType(element_type, [&](auto type) {
+            using T = decltype(type);
+            T value;
+            std::memcpy(&value, output.data() + projection.getElementOffset(element), sizeof(T));
+            const auto& decoder_element = decoder.getElement(element_names[element]);
+            const T expected = decoder_element.template getValue<T>();
+            if (std::is_same<T, bool>::value) {
+                // the random data contains bool values other than 0 and 1
+                uint8_t bool_value;
+                std::memcpy(&bool_value, &value, 1);
+                EXPECT_EQ(decoder_element.template getValue<uint8_t>() != 0 ? 1 : 0, bool_value)
+                    << element_names[element];
+            }
+            else {
+                // compare the bytes, random floating point values may be NaN
+                EXPECT_EQ(0, std::memcmp(&expected, &value, sizeof(T))) << element_names[element];
+            }
+        });
+    }
+}
+
+} // namespace projection
+
+/**
+ * @detail Check that the projection of a static struct extracts the same values as the decoder
+ * into a compact output struct
+ */
+TEST(CodecTest, ProjectionOfStaticStruct)
+{
+    using namespace projection;
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(100));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    std::vector<std::string> element_names;
+    for (size_t leaf = 0; leaf < 100; leaf += 7) {
+        element_names.push_back("elem_" + std::to_string(leaf));
+    }
+
+    for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+        SCOPED_TRACE(::testing::Message() << "representation: " << representation);
+        const auto projection = factory.makeProjection(element_names, representation);
+        const auto data =
+            reset_values::createRandomData(factory.getStaticBufferSize(representation));
+        std::vector<uint8_t> output(projection.getOutputSize());
+        projection.extract(data.data(), data.size(), output.data(), output.size());
+        const auto decoder =
+            factory.makeStaticDecoderFor(data.data(), data.size(), representation);
+        expectProjectionEqualsDecoder(projection, output, decoder, element_names);
+
+        // the same with codec indices
+        std::vector<codec::CodecIndex> codec_indices;
+        for (const auto& element_name: element_names) {
+            codec_indices.push_back(factory.getElement(element_name).getIndex());
+        }
+        const auto projection_by_index = factory.makeProjection(codec_indices, representation);
+        std::vector<uint8_t> output_by_index(projection_by_index.getOutputSize());
+        projection_by_index.extract(
+            data.data(), data.size(), output_by_index.data(), output_by_index.size());
+        EXPECT_EQ(output_by_index, output);
+
+        EXPECT_THROW(projection.extract(data.data(), data.size() - 1, output.data(), output.size()),
+                     std::runtime_error);
+        EXPECT_THROW(projection.extract(data.data(), data.size(), output.data(), output.size() - 1),
+                     std::runtime_error);
+    }
+
+    // the output layout is like a C struct
+    struct Output {
+        uint8_t elem_0;
+        double elem_3;
+        int16_t elem_1;
+        bool elem_4;
+    };
+    const auto projection = factory.makeProjection({"elem_0", "elem_3", "elem_1", "elem_4"});
+    ASSERT_EQ(projection.getOutputSize(), sizeof(Output));
+    EXPECT_EQ(projection.getElementOffset(0), offsetof(Output, elem_0));
+    EXPECT_EQ(projection.getElementOffset(1), offsetof(Output, elem_3));
+    EXPECT_EQ(projection.getElementOffset(2), offsetof(Output, elem_1));
+    EXPECT_EQ(projection.getElementOffset(3), offsetof(Output, elem_4));
+
+    EXPECT_THROW(factory.makeProjection({"elem_100"}), std::runtime_error);
+}
+
+/**
+ * @detail Check that the projection of a dynamic struct resolves the positions with the array
+ * sizes of the data
+ */
+TEST(CodecTest, ProjectionOfDynamicStruct)
+{
+    using namespace projection;
+    const codec::CodecFactory factory("test", dynamic_test_leaf::test_description);
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    const std::vector<std::string> element_names = {
+        "array_size", "array[1].child_array[1]", "array[2].child_size", "array[2].child_array[2]"};
+    const auto projection = factory.makeProjection(element_names);
+    ASSERT_EQ(projection.getOutputSize(), 4 * sizeof(int32_t));
+
+    // the codec uses the array sizes of the first array element for all array elements, so the
+    // positions change with the size of the first child_array
+    const std::vector<std::pair<std::vector<int32_t>, std::vector<int32_t>>> samples = {
+        {{3, 3, 0, 1, 2, 3, 10, 11, 12, 3, 20, 21, 22}, {3, 11, 3, 22}},
+        {{3, 3, 0, 1, 2, 3, 10, 11, 12, 3, 20, 21, 22}, {3, 11, 3, 22}},
+        {{4, 4, 0, 1, 2, 3, 4, 10, 11, 12, 13, 4, 20, 21, 22, 23, 4, 30, 31, 32, 33},
+         {4, 11, 4, 22}},
+        {{3, 3, 0, 1, 2, 3, 10, 11, 12, 3, 20, 21, 22}, {3, 11, 3, 22}}};
+    for (const auto& sample: samples) {
+        const auto& data = sample.first;
+        std::vector<uint8_t> output(projection.getOutputSize());
+        projection.extract(
+            data.data(), data.size() * sizeof(int32_t), output.data(), output.size());
+        const auto decoder = factory.makeDecoderFor(data.data(), data.size() * sizeof(int32_t));
+        expectProjectionEqualsDecoder(projection, output, decoder, element_names);
+        std::vector<int32_t> values(4);
+        std::memcpy(values.data(), output.data(), output.size());
+        EXPECT_EQ(values, sample.second);
+    }
+
+    // the element array[2].child_size is behind the data with these array sizes
+    const std::vector<int32_t> data = {2, 3, 0, 1, 2, 3, 10, 11, 12};
+    std::vector<uint8_t> output(projection.getOutputSize());
+    EXPECT_THROW(projection.extract(
+                     data.data(), data.size() * sizeof(int32_t), output.data(), output.size()),
+                 std::runtime_error);
+    const auto& samples_data = samples[0].first;
+    // the data is too small for the array sizes
+    EXPECT_THROW(projection.extract(
+                     samples_data.data(), 5 * sizeof(int32_t), output.data(), output.size()),
+                 std::runtime_error);
+}
+
+/**
+ * @detail Benchmark of the projection of 12 leaves of a struct with thousands of leaves against
+ * the full deserialization
+ */
+TEST(CodecTest, ProjectionPerformance)
+{
+    const auto dd = ddl::DDFile::fromXMLFile(TEST_FILES_DIR "test_performance.description");
+    const codec::CodecFactory factory(*dd.getStructTypes().get("BigDataType"), dd);
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    const auto codec_indices = codec::getCodecIndices(factory);
+    std::vector<codec::CodecIndex> selected_indices;
+    for (size_t leaf = 0; leaf < codec_indices.size(); leaf += codec_indices.size() / 12) {
+        selected_indices.push_back(codec_indices[leaf]);
+    }
+    std::cout << "Projection of " << selected_indices.size() << " of " << codec_indices.size()
+              << " leaves" << std::endl;
+
+    const size_t test_count = 100;
+    const auto data = reset_values::createRandomData(factory.getStaticBufferSize(ddl::serialized));
+    a_util::memory::MemoryBuffer deserialized_buffer;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                const auto decoder =
+                    factory.makeDecoderFor(data.data(), data.size(), ddl::serialized);
+                ASSERT_EQ(codec::transformToBuffer(decoder, deserialized_buffer),
+                          a_util::result::SUCCESS);
+            }
+        },
+        test_count,
+        "Full deserialization");
+
+    const auto projection = factory.makeProjection(selected_indices, ddl::serialized);
+    std::vector<uint8_t> output(projection.getOutputSize());
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                projection.extract(data.data(), data.size(), output.data(), output.size());
+            }
+        },
+        test_count,
+        "Projection");
+}
+
+namespace sample_diff {
+/**
+ * Changes the value of the leaves with the given leaf indices.
+ */
+void changeLeaves(const codec::CodecFactory& factory,
+                  std::vector<uint8_t>& data,
+                  ddl::DataRepresentation representation,
+                  const std::vector<size_t>& leaves)
+{
+    auto codec = factory.makeStaticCodecFor(data.data(), data.size(), representation);
+    const auto codec_indices = codec::getCodecIndices(factory);
+    for (const auto leaf: leaves) {
+        if (codec_indices[leaf].getType() == codec::ElementType::cet_bool) {
+            codec.setElementValue<bool>(codec_indices[leaf],
+                                        !codec.getElementValue<bool>(codec_indices[leaf]));
+        }
+        else {
+            codec.setElementValue<uint64_t>(
+                codec_indices[leaf], codec.getElementValue<uint64_t>(codec_indices[leaf]) + 1);
+        }
+    }
+}
+
+} // namespace sample_diff
+
+/**
+ * @detail Check that the SampleDiff detects exactly the changed leaves and the delta of the
+ * changed leaves restores the current sample
+ */
+TEST(CodecTest, SampleDiffDetectsChangedLeaves)
+{
+    using namespace sample_diff;
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(100));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    std::vector<size_t> changed_leaves;
+    for (size_t leaf = 0; leaf < 100; leaf += 3) {
+        // the enum elements are constants
+        if (leaf % 8 != 7) {
+            changed_leaves.push_back(leaf);
+        }
+    }
+
+    for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+        SCOPED_TRACE(::testing::Message() << "representation: " << representation);
+        const codec::SampleDiff sample_diff(factory, representation);
+        ASSERT_EQ(sample_diff.getLeafCount(), 100);
+        std::vector<uint8_t> previous(sample_diff.getSampleSize());
+        factory.makeStaticCodecFor(previous.data(), previous.size(), representation)
+            .resetValues(true);
+        auto current = previous;
+        EXPECT_TRUE(
+            sample_diff.diff(previous.data(), previous.size(), current.data(), current.size())
+                .empty());
+
+        changeLeaves(factory, current, representation, changed_leaves);
+        EXPECT_EQ(
+            sample_diff.diff(previous.data(), previous.size(), current.data(), current.size()),
+            changed_leaves);
+
+        std::vector<uint8_t> delta;
+        EXPECT_EQ(sample_diff.encodeDelta(
+                      previous.data(), previous.size(), current.data(), current.size(), delta),
+                  changed_leaves.size());
+        auto restored = previous;
+        sample_diff.applyDelta(delta.data(), delta.size(), restored.data(), restored.size());
+        EXPECT_EQ(restored, current);
+
+        EXPECT_THROW(sample_diff.applyDelta(
+                         delta.data(), delta.size() - 1, restored.data(), restored.size()),
+                     std::runtime_error);
+        const uint32_t invalid_leaf = 100;
+        EXPECT_THROW(sample_diff.applyDelta(
+                         &invalid_leaf, sizeof(invalid_leaf), restored.data(), restored.size()),
+                     std::runtime_error);
+        EXPECT_THROW(
+            sample_diff.diff(previous.data(), previous.size() - 1, current.data(), current.size()),
+            std::runtime_error);
+    }
+
+    const codec::CodecFactory dynamic_factory("test", dynamic_test_leaf::test_description);
+    EXPECT_THROW(codec::SampleDiff{dynamic_factory}, std::runtime_error);
+}
+
+/**
+ * @detail Benchmark of the SampleDiff against the comparison of the variant values of all leaves
+ */
+TEST(CodecTest, SampleDiffPerformance)
+{
+    using namespace sample_diff;
+    const auto dd = ddl::DDFile::fromXMLFile(TEST_FILES_DIR "test_performance.description");
+    const codec::CodecFactory factory(*dd.getStructTypes().get("BigDataType"), dd);
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    const auto codec_indices = codec::getCodecIndices(factory);
+    const codec::SampleDiff sample_diff(factory);
+    std::vector<uint8_t> previous(sample_diff.getSampleSize());
+    factory.makeStaticCodecFor(previous.data(), previous.size()).resetValues(true);
+    auto current = previous;
+    const std::vector<size_t> changed_leaves = {0, 1000, 20000, 40000, 65000};
+    changeLeaves(factory, current, ddl::deserialized, changed_leaves);
+
+    const size_t variant_test_count = 10;
+    std::vector<size_t> variant_changed_leaves;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < variant_test_count; ++current_test) {
+                variant_changed_leaves.clear();
+                const auto previous_decoder =
+                    factory.makeStaticDecoderFor(previous.data(), previous.size());
+                const auto current_decoder =
+                    factory.makeStaticDecoderFor(current.data(), current.size());
+                for (size_t leaf = 0; leaf < codec_indices.size(); ++leaf) {
+                    if (!(previous_decoder.getElementVariantValue(codec_indices[leaf]) ==
+                          current_decoder.getElementVariantValue(codec_indices[leaf]))) {
+                        variant_changed_leaves.push_back(leaf);
+                    }
+                }
+            }
+        },
+        variant_test_count,
+        "Comparison of the variant values");
+    EXPECT_EQ(variant_changed_leaves, changed_leaves);
+
+    const size_t test_count = 1000;
+    std::vector<size_t> diff_changed_leaves;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                sample_diff.diff(previous.data(),
+                                 previous.size(),
+                                 current.data(),
+                                 current.size(),
+                                 diff_changed_leaves);
+            }
+        },
+        test_count,
+        "SampleDiff");
+    EXPECT_EQ(diff_changed_leaves, changed_leaves);
+}
+
+/**
+ * @detail Check that the cached leaf indices are the leaf elements of forEachLeafElement
+ */
+TEST(CodecTest, LeafIndicesEqualLeafElements)
+{
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(100));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    std::vector<codec::CodecIndex> leaf_elements;
+    codec::forEachLeafElement(factory.getElements(), [&leaf_elements](const auto& element) {
+        leaf_elements.push_back(element.getIndex());
+    });
+    EXPECT_EQ(factory.getLeafIndices(), leaf_elements);
+    // the cache is shared by the factory and its static decoders
+    const auto data = reset_values::createRandomData(factory.getStaticBufferSize());
+    const auto decoder = factory.makeStaticDecoderFor(data.data(), data.size());
+    EXPECT_EQ(&decoder.getLeafIndices(), &factory.getLeafIndices());
+
+    // the leaf elements of a dynamic decoder depend on the array sizes
+    using namespace dynamic_test_leaf;
+    const codec::CodecFactory dynamic_factory("test", test_description);
+    const ArrayTest test_data{3, {{3, {0, 1, 2}}, {3, {0, 1, 2}}, {3, {0, 1, 2}}}};
+    const auto dynamic_decoder = dynamic_factory.makeDecoderFor(&test_data, sizeof(test_data));
+    const auto& leaf_indices = dynamic_decoder.getLeafIndices();
+    ASSERT_EQ(leaf_indices.size(), 13);
+    EXPECT_EQ(dynamic_decoder.getElement(leaf_indices[12]).getFullName(),
+              "array[2].child_array[2]");
+    const ArrayTest other_test_data{2, {{1, {0}}, {1, {0}}}};
+    const auto other_dynamic_decoder =
+        dynamic_factory.makeDecoderFor(&other_test_data, sizeof(other_test_data));
+    EXPECT_EQ(other_dynamic_decoder.getLeafIndices().size(), 5);
+}
+
+/**
+ * @detail Benchmark of the iteration of all leaf elements with a std::function, with a template
+ * visitor and with the cached leaf indices
+ */
+TEST(CodecTest, LeafIterationPerformance)
+{
+    const auto dd = ddl::DDFile::fromXMLFile(TEST_FILES_DIR "test_performance.description");
+    const codec::CodecFactory factory(*dd.getStructTypes().get("BigDataType"), dd);
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    const auto data = reset_values::createRandomData(factory.getStaticBufferSize());
+    const auto decoder = factory.makeStaticDecoderFor(data.data(), data.size());
+    const size_t test_count = 10;
+
+    uint64_t sum_function = 0;
+    const std::function<void(const codec::StaticDecoder::Element&)> function =
+        [&sum_function](const codec::StaticDecoder::Element& element) {
+            sum_function += element.getValue<uint64_t>();
+        };
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                codec::forEachLeafElement(decoder.getElements(), function);
+            }
+        },
+        test_count,
+        "forEachLeafElement with std::function");
+
+    uint64_t sum_visitor = 0;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                codec::forEachLeafElement(decoder.getElements(),
+                                          [&sum_visitor](const auto& element) {
+                                              sum_visitor += element.template getValue<uint64_t>();
+                                          });
+            }
+        },
+        test_count,
+        "forEachLeafElement with template visitor");
+
+    uint64_t sum_leaf_indices = 0;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                for (const auto& leaf_index: decoder.getLeafIndices()) {
+                    sum_leaf_indices += decoder.getElementValue<uint64_t>(leaf_index);
+                }
+            }
+        },
+        test_count,
+        "Cached leaf indices");
+
+    EXPECT_EQ(sum_visitor, sum_function);
+    EXPECT_EQ(sum_leaf_indices, sum_function);
+}
+
+/**
+ * @detail Check that the typed leaf access reads and writes the same values as the LeafCodecIndex
+ * for all leaf types, byte orders and bit fields
+ */
+TEST(CodecTest, TypedLeafAccessEqualsLeafCodecIndex)
+{
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(100));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+        SCOPED_TRACE(::testing::Message() << "representation: " << representation);
+        const auto leaf_codec_indices = codec::getLeafCodecIndices(factory, representation);
+        std::vector<codec::TypedLeafAccess<int64_t>> typed_leaf_accesses;
+        for (const auto& leaf_codec_index: leaf_codec_indices) {
+            typed_leaf_accesses.emplace_back(leaf_codec_index);
+        }
+
+        // write the same values with both accesses, negative values check the sign extension
+        std::vector<uint8_t> expected_data(factory.getStaticBufferSize(representation));
+        std::vector<uint8_t> data(expected_data.size());
+        auto expected_codec = factory.makeStaticCodecFor(
+            expected_data.data(), expected_data.size(), representation);
+        auto codec = factory.makeStaticCodecFor(data.data(), data.size(), representation);
+        for (size_t leaf = 0; leaf < leaf_codec_indices.size(); ++leaf) {
+            const auto value = static_cast<int64_t>(leaf % 7) - 3;
+            expected_codec.setElementValue(leaf_codec_indices[leaf], value);
+            codec.setElementValue(typed_leaf_accesses[leaf], value);
+        }
+        EXPECT_EQ(data, expected_data);
+
+        const auto decoder =
+            factory.makeStaticDecoderFor(data.data(), data.size(), representation);
+        for (size_t leaf = 0; leaf < leaf_codec_indices.size(); ++leaf) {
+            SCOPED_TRACE(::testing::Message() << "leaf: " << leaf);
+            EXPECT_EQ(decoder.getElementValue(typed_leaf_accesses[leaf]),
+                      decoder.getElementValue<int64_t>(leaf_codec_indices[leaf]));
+        }
+    }
+
+    // errors
+    const auto leaf_codec_indices = codec::getLeafCodecIndices(factory, ddl::deserialized);
+    const codec::TypedLeafAccess<double> last_leaf_access(leaf_codec_indices.back());
+    std::vector<uint8_t> data(last_leaf_access.getRequiredDataSize() - 1);
+    const auto decoder = factory.makeStaticDecoderFor(data.data(), data.size());
+    EXPECT_THROW(decoder.getElementValue(last_leaf_access), std::runtime_error);
+    const codec::CodecFactory struct_factory("MainStruct",
+                                             alignment_of_substructs::test_description);
+    ASSERT_EQ(struct_factory.isValid(), a_util::result::SUCCESS);
+    EXPECT_THROW(codec::TypedLeafAccess<double>(
+                     struct_factory.getElement("sub_struct[0]").getIndex(), ddl::deserialized),
+                 std::runtime_error);
+}
+
+/**
+ * @detail Benchmark of reading all leaves with the CodecIndex, the LeafCodecIndex and the typed
+ * leaf access
+ */
+TEST(CodecTest, TypedLeafAccessPerformance)
+{
+    const codec::CodecFactory factory("tResetTest", reset_values::createDescription(100));
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    const size_t test_count = 10000;
+    for (const auto representation: {ddl::deserialized, ddl::serialized}) {
+        std::cout << "Representation: "
+                  << (representation == ddl::deserialized ? "deserialized" : "serialized")
+                  << std::endl;
+        std::vector<uint8_t> data(factory.getStaticBufferSize(representation));
+        const auto& leaf_indices = factory.getLeafIndices();
+        const auto leaf_codec_indices = codec::getLeafCodecIndices(factory, representation);
+        std::vector<codec::TypedLeafAccess<int64_t>> typed_leaf_accesses;
+        {
+            auto codec = factory.makeStaticCodecFor(data.data(), data.size(), representation);
+            for (size_t leaf = 0; leaf < leaf_codec_indices.size(); ++leaf) {
+                codec.setElementValue(leaf_codec_indices[leaf], static_cast<int64_t>(leaf % 7));
+                typed_leaf_accesses.emplace_back(leaf_codec_indices[leaf]);
+            }
+        }
+        const auto decoder =
+            factory.makeStaticDecoderFor(data.data(), data.size(), representation);
+
+        int64_t sum_codec_index = 0;
+        testPerformance(
+            [&]() {
+                for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                    for (const auto& leaf_index: leaf_indices) {
+                        sum_codec_index += decoder.getElementValue<int64_t>(leaf_index);
+                    }
+                }
+            },
+            test_count,
+            "Reading all leaves with CodecIndex");
+        int64_t sum_leaf_codec_index = 0;
+        testPerformance(
+            [&]() {
+                for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                    for (const auto& leaf_codec_index: leaf_codec_indices) {
+                        sum_leaf_codec_index += decoder.getElementValue<int64_t>(leaf_codec_index);
+                    }
+                }
+            },
+            test_count,
+            "Reading all leaves with LeafCodecIndex");
+        int64_t sum_typed_leaf_access = 0;
+        testPerformance(
+            [&]() {
+                for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                    for (const auto& typed_leaf_access: typed_leaf_accesses) {
+                        sum_typed_leaf_access += decoder.getElementValue(typed_leaf_access);
+                    }
+                }
+            },
+            test_count,
+            "Reading all leaves with TypedLeafAccess");
+
+        EXPECT_EQ(sum_leaf_codec_index, sum_codec_index);
+        EXPECT_EQ(sum_typed_leaf_access, sum_codec_index);
+    }
+}
+
+/**
+ * @detail Check that the codec factory cache shares the struct layout of equal descriptions and
+ * removes the least recently used factories
+ */
+TEST(CodecTest, CodecFactoryCache)
+{
+    codec::CodecFactoryCache cache(2);
+    const auto description_a = reset_values::createDescription(10);
+    const auto description_b = reset_values::createDescription(20);
+    const auto description_c = reset_values::createDescription(30);
+
+    const auto factory_a = cache.getFactory("tResetTest", description_a);
+    ASSERT_EQ(factory_a.isValid(), a_util::result::SUCCESS);
+    EXPECT_EQ(factory_a.getStaticElementCount(), 10U);
+    EXPECT_EQ(cache.getSize(), 1U);
+    // a cached factory shares the struct layout
+    EXPECT_EQ(&cache.getFactory("tResetTest", description_a).getLeafIndices(),
+              &factory_a.getLeafIndices());
+
+    const auto factory_b = cache.getFactory("tResetTest", description_b);
+    EXPECT_EQ(factory_b.getStaticElementCount(), 20U);
+    EXPECT_EQ(cache.getSize(), 2U);
+    // uses a, so b is the least recently used one
+    cache.getFactory("tResetTest", description_a);
+    const auto factory_c = cache.getFactory("tResetTest", description_c);
+    EXPECT_EQ(factory_c.getStaticElementCount(), 30U);
+    EXPECT_EQ(cache.getSize(), 2U);
+    EXPECT_EQ(&cache.getFactory("tResetTest", description_a).getLeafIndices(),
+              &factory_a.getLeafIndices());
+    EXPECT_NE(&cache.getFactory("tResetTest", description_b).getLeafIndices(),
+              &factory_b.getLeafIndices());
+
+    // invalid factories are not cached
+    EXPECT_NE(cache.getFactory("tNotExisting", description_a).isValid(),
+              a_util::result::SUCCESS);
+    EXPECT_EQ(cache.getSize(), 2U);
+
+    cache.setMaxSize(1);
+    EXPECT_EQ(cache.getSize(), 1U);
+    cache.clear();
+    EXPECT_EQ(cache.getSize(), 0U);
+}
+
+/**
+ * @detail Benchmark of cyclic transformations into a new buffer each, allocated from the heap and
+ * from a pool
+ */
+TEST(CodecTest, TransformToPooledBufferPerformance)
+{
+    const auto dd = ddl::DDFile::fromXMLFile(TEST_FILES_DIR "test_performance.description");
+    const codec::CodecFactory factory(*dd.getStructTypes().get("BigDataType"), dd);
+    ASSERT_EQ(factory.isValid(), a_util::result::SUCCESS);
+    const auto data = reset_values::createRandomData(factory.getStaticBufferSize());
+    const auto decoder = factory.makeDecoderFor(data.data(), data.size());
+    const size_t test_count = 20;
+
+    a_util::memory::MemoryBuffer heap_buffer;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                a_util::memory::MemoryBuffer buffer;
+                ASSERT_EQ(codec::transformToBuffer(decoder, buffer, true), a_util::result::SUCCESS);
+                heap_buffer.swap(buffer);
+            }
+        },
+        test_count,
+        "Allocate, transform and release with the heap");
+
+    a_util::memory::MemoryBufferPool pool;
+    a_util::memory::MemoryBuffer pooled_buffer;
+    testPerformance(
+        [&]() {
+            for (size_t current_test = 0; current_test < test_count; ++current_test) {
+                a_util::memory::MemoryBuffer buffer;
+                ASSERT_EQ(codec::transformToBuffer(decoder, buffer, pool, true),
+                          a_util::result::SUCCESS);
+                pooled_buffer.swap(buffer);
+            }
+        },
+        test_count,
+        "Allocate, transform and release with a pool");
+
+    EXPECT_EQ(pooled_buffer, heap_buffer);
+    EXPECT_EQ(pooled_buffer.getSize(), factory.getStaticBufferSize(ddl::serialized));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pooled_buffer.getPtr()) % pool.getAlignment(), 0u);
+}
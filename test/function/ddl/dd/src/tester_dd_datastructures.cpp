@@ -9,13 +9,17 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "./../../../../../src/ddl/utilities/dd_arena.h"
 #include "./../../_common/test_oo_ddl.h"
 
 #include <ddl/dd/dd.h>
+#include <ddl/utilities/string_check.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <stdint.h>
+#include <vector>
 
 using namespace ddl::dd;
 
@@ -364,3 +368,100 @@ TEST(TesterUtilityDataStructureMap, observerMove)
     auto struct_type_elem_changed_move = struct_type_move->getElements().access("elem1_changed");
     ASSERT_TRUE(struct_type_elem_changed_move);
 }
+
+/*****************************************************************************************
+ * Test arena
+ *****************************************************************************************/
+
+TEST(TesterUtilityArena, allocateAligned)
+{
+    utility::MonotonicArena arena(1024);
+    EXPECT_EQ(arena.getReservedSize(), 0u);
+    for (size_t alignment: {1, 2, 4, 8, 16, 64}) {
+        void* const memory = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % alignment, 0u);
+    }
+    const auto reserved_size = arena.getReservedSize();
+    EXPECT_GE(reserved_size, 1024u);
+
+    // a huge item gets a block of its own, the current block is still used afterwards
+    char* const huge = static_cast<char*>(arena.allocate(100000, 8));
+    huge[0] = huge[99999] = 1;
+    EXPECT_GE(arena.getReservedSize(), reserved_size + 100000);
+    const auto reserved_size_huge = arena.getReservedSize();
+    arena.allocate(16, 8);
+    EXPECT_EQ(arena.getReservedSize(), reserved_size_huge);
+
+    // the blocks are refilled
+    for (size_t count = 0; count < 1000; ++count) {
+        arena.allocate(16, 8);
+    }
+    EXPECT_EQ(arena.getAllocationCount(), 1008u);
+    EXPECT_EQ(arena.getAllocatedSize(), 6 * 3 + 100000 + 1001 * 16);
+}
+
+TEST(TesterUtilityArena, alignmentBeyondBlockEnd)
+{
+    // the padding of nearly full blocks exceeds their rest, a new block has to be used
+    utility::MonotonicArena arena(1024);
+    std::vector<uintptr_t> addresses;
+    for (size_t count = 0; count < 200; ++count) {
+        addresses.push_back(reinterpret_cast<uintptr_t>(arena.allocate(8, 128)));
+        EXPECT_EQ(addresses.back() % 128, 0u);
+    }
+    // at most 8 items fit into one block
+    EXPECT_GE(arena.getReservedSize(), 200 / 8 * 1024u);
+    std::sort(addresses.begin(), addresses.end());
+    EXPECT_EQ(std::adjacent_find(addresses.begin(), addresses.end()), addresses.end());
+}
+
+TEST(TesterUtilityArena, arenaScopeKeepsArenaAlive)
+{
+    std::weak_ptr<utility::MonotonicArena> arena_observer;
+    std::shared_ptr<StructType> struct_type;
+    {
+        auto arena = std::make_shared<utility::MonotonicArena>();
+        arena_observer = arena;
+        datamodel::DataDefinition data_model;
+        {
+            utility::ArenaScope arena_scope(arena);
+            EXPECT_EQ(utility::ArenaScope::getCurrentArena(), arena);
+            {
+                // nested scopes may switch back to the heap
+                utility::ArenaScope heap_scope(nullptr);
+                EXPECT_FALSE(utility::ArenaScope::getCurrentArena());
+                data_model.getDataTypes().add({"heap_type", 8});
+            }
+            EXPECT_EQ(utility::ArenaScope::getCurrentArena(), arena);
+            data_model.getStructTypes().add({"structtype1", "1"});
+            data_model.getStructTypes().access("structtype1")->getElements().add(
+                {"elem1", "heap_type", {}, {}});
+        }
+        EXPECT_FALSE(utility::ArenaScope::getCurrentArena());
+        // at least the struct type and the element
+        const auto allocation_count = arena->getAllocationCount();
+        EXPECT_GE(allocation_count, 2u);
+
+        // changes outside of the scope are allocated from the heap
+        data_model.getStructTypes().access("structtype1")->getElements().add(
+            {"elem2", "heap_type", {}, {}});
+        EXPECT_EQ(arena->getAllocationCount(), allocation_count);
+        struct_type = data_model.getStructTypes().access("structtype1");
+    }
+    // the items keep the arena alive
+    ASSERT_FALSE(arena_observer.expired());
+    EXPECT_EQ(struct_type->getName(), "structtype1");
+    EXPECT_EQ(struct_type->getElements().getSize(), 2u);
+    struct_type.reset();
+    EXPECT_TRUE(arena_observer.expired());
+}
+
+TEST(TesterUtilityStringCheck, isInteger)
+{
+    for (const auto* integer: {"0", "42", "-1", "007", "18446744073709551616"}) {
+        EXPECT_TRUE(utility::isInteger(integer)) << integer;
+    }
+    for (const auto* no_integer: {"", "-", "--1", "+1", "1.0", " 1", "1 ", "0x1", "a", "1-"}) {
+        EXPECT_FALSE(utility::isInteger(no_integer)) << no_integer;
+    }
+}
@@ -13,13 +13,16 @@
 #include "ddl_definitions.h"
 
 #include <a_util/xml.h>
+#include <ddl/dd/dd_typeinfomodel.h>
 #include <ddl/dd/ddcompare.h>
 #include <ddl/dd/ddstring.h>
 #include <ddl/dd/ddstructure.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cstdio>
+#include <iostream>
 
 /**
  * @detail The building up of a DataDefinition object representation.
@@ -109,6 +112,87 @@ TEST(TesterDDCompare, TestIsBinaryEqualNegativeSubset)
             "adtf.type.video", DDL_TEST_STRING, "adtf.type.video", DDL_TEST_STRING_SUBSET, true));
 }
 
+/**
+ * @detail The binary layout of unchanged types is compared via a cached fingerprint.
+ * Changing one of the types must invalidate the cached result.
+ */
+TEST(TesterDDCompare, TestIsBinaryEqualCachedLayoutIsInvalidatedOnChange)
+{
+    using namespace ddl;
+    auto dd1 = DDString::fromXMLString(DDL_TEST_STRING_LAYOUT_TEST);
+    auto dd2 = DDString::fromXMLString(DDL_TEST_STRING_LAYOUT_TEST);
+
+    // the second call uses the cached fingerprints
+    for (bool is_subset: {false, true, false, true}) {
+        ASSERT_EQ(a_util::result::SUCCESS,
+                  DDCompare::isBinaryEqual("tTest1", dd1, "tTest2", dd2, is_subset));
+    }
+
+    // change the layout of the sub struct, the dependent tTest1 must not be equal anymore
+    dd1.getStructTypes().access("sub1")->getElements().access("ui32MajorType")->setTypeName(
+        "tUInt16");
+    ASSERT_NE(a_util::result::SUCCESS,
+              DDCompare::isBinaryEqual("tTest1", dd1, "tTest2", dd2, false));
+    ASSERT_NE(a_util::result::SUCCESS,
+              DDCompare::isBinaryEqual("tTest1", dd1, "tTest2", dd2, false));
+
+    // change the other one to the same layout
+    dd2.getStructTypes().access("tTest2")->getElements().access("ui32MajorType")->setTypeName(
+        "tUInt16");
+    ASSERT_EQ(a_util::result::SUCCESS,
+              DDCompare::isBinaryEqual("tTest1", dd1, "tTest2", dd2, false));
+
+    // the array size changes the leaf count
+    dd2.getStructTypes().access("tTest2")->getElements().access("ui32MajorType")->setArraySize(5);
+    ASSERT_NE(a_util::result::SUCCESS,
+              DDCompare::isBinaryEqual("tTest1", dd1, "tTest2", dd2, false));
+    ASSERT_EQ(a_util::result::SUCCESS,
+              DDCompare::isBinaryEqual("tTest2", dd2, "tTest1", dd1, true));
+}
+
+/**
+ * @detail Equal fingerprints alone do not make binary layouts equal, a hash collision must not
+ * report equality.
+ */
+TEST(TesterDDCompare, TestBinaryLayoutEqualityConfirmsFingerprint)
+{
+    ddl::dd::BinaryLayout layout1;
+    layout1.fingerprint = 42;
+    layout1.leaves = {1, 0, 32, 32};
+    ddl::dd::BinaryLayout layout2 = layout1;
+    EXPECT_TRUE(layout1 == layout2);
+
+    // same fingerprint, different leaves
+    layout2.leaves = {1, 0, 16, 16};
+    EXPECT_FALSE(layout1 == layout2);
+
+    // different fingerprint rejects early
+    layout2 = layout1;
+    layout2.fingerprint = 43;
+    EXPECT_FALSE(layout1 == layout2);
+}
+
+/**
+ * @detail Repeated binary comparison of unchanged types must be fast.
+ */
+TEST(TesterDDCompare, TestIsBinaryEqualPerformance)
+{
+    using namespace ddl;
+    const auto dd1 = DDString::fromXMLString(DDL_TEST_STRING);
+    const auto dd2 = DDString::fromXMLString(DDL_TEST_STRING);
+
+    constexpr size_t test_count = 10000;
+    const auto begin_of_measurement = std::chrono::steady_clock::now();
+    for (size_t current_test = 0; current_test < test_count; ++current_test) {
+        ASSERT_EQ(a_util::result::SUCCESS,
+                  DDCompare::isBinaryEqual("adtf.type.video", dd1, "adtf.type.video", dd2, true));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin_of_measurement;
+    std::cout << "isBinaryEqual (" << test_count << " iterations): "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / test_count
+              << " ns per iteration" << std::endl;
+}
+
 namespace compare_with_padding {
 struct StructLevel2 {
     uint64_t value1;
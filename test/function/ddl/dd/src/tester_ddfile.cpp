@@ -11,11 +11,64 @@
 
 #include "./../../_common/test_oo_ddl.h"
 
+#include "./../../_common/test_measurement.h"
+#include "./../../../../../src/ddl/utilities/dd_arena.h"
+
+#include <a_util/xml.h>
+#include <ddl/datamodel/xml_ddfromxml_factory.h>
+#include <ddl/datamodel/xml_ddtoxml_factory.h>
+#include <ddl/dd/dd_typeinfomodel.h>
+#include <ddl/dd/ddcompare.h>
 #include <ddl/dd/ddfile.h>
+#include <ddl/dd/ddstring.h>
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define TEST_DDFILE_MEASURE_HEAP
+#endif
+
+namespace {
+/// counts the allocations of the replaced global operator new
+std::atomic<size_t> heap_allocation_count{0};
+} // namespace
+
+#if defined(__GNUC__) && !defined(__clang__)
+// the replaced operators allocate with malloc, so free is the matching deallocation
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t size)
+{
+    ++heap_allocation_count;
+    if (void* const memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 
 /**
  * @detail The building up of a DataDefinition object representation.
@@ -707,4 +760,488 @@ TEST(TesterDDFile, writeSorted)
     EXPECT_EQ(
         0,
         compareFiles(description_v4_sorted_descending, description_v4_sorted_descending_expected));
-}
\ No newline at end of file
+}
+namespace {
+/**
+ * Creates the XML string like it was done before the streaming writer: create a DOM with the
+ * DDToXMLFactory and serialize it.
+ */
+std::string toXMLStringWithDOM(const ddl::dd::DataDefinition& dd)
+{
+    a_util::xml::DOM dom;
+    dom.fromString("<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>\n"
+                   "<ddl:ddl xmlns:ddl=\"ddl\"> \n"
+                   "</ddl:ddl>");
+    a_util::xml::DOMElement root = dom.getRoot();
+    ddl::dd::DDToXMLFactory<a_util::xml::DOMElement>::createNode(root, *dd.getModel());
+    return dom.toString();
+}
+
+/**
+ * Creates a DataDefinition with 1000 structs using a struct with 20 elements.
+ */
+ddl::dd::DataDefinition createLargeDD()
+{
+    std::string large_description = "<struct name=\"tLargeElem\" version=\"1\">";
+    for (size_t elem_idx = 0; elem_idx < 20; ++elem_idx) {
+        large_description +=
+            "<element name=\"elem_" + std::to_string(elem_idx) +
+            "\" type=\"tUInt32\" arraysize=\"1\" unit=\"\" description=\"a description\">"
+            "<serialized bytepos=\"" +
+            std::to_string(elem_idx * 4) +
+            "\" byteorder=\"LE\"/><deserialized alignment=\"1\"/></element>";
+    }
+    large_description += "</struct>";
+    for (size_t struct_idx = 0; struct_idx < 1000; ++struct_idx) {
+        large_description += "<struct name=\"tLarge_" + std::to_string(struct_idx) +
+                             "\" version=\"1\" alignment=\"4\">"
+                             "<element name=\"a\" type=\"tLargeElem\">"
+                             "<serialized bytepos=\"0\" byteorder=\"LE\"/>"
+                             "<deserialized alignment=\"1\"/></element></struct>";
+    }
+    return ddl::DDString::fromXMLString("<structs>" + large_description + "</structs>",
+                                        ddl::dd::Version(4, 1));
+}
+
+/**
+ * Reads the datamodel like it was done before the streaming reader: create a DOM and read it
+ * with the DDFromXMLFactory.
+ */
+ddl::dd::datamodel::DataDefinition fromXMLStringWithDOM(const std::string& xml_string,
+                                                        const ddl::dd::Version& language_version,
+                                                        bool strict)
+{
+    a_util::xml::DOM dom;
+    if (!dom.fromString(xml_string)) {
+        throw ddl::dd::Error("fromXMLStringWithDOM", {"..."}, dom.getLastError());
+    }
+    return ddl::dd::DDFromXMLFactory<a_util::xml::DOMElement>::createDD(
+        dom.getRoot(), language_version, strict);
+}
+
+/**
+ * Reads the datamodel with the DOM and with the streaming reader and expects the same result
+ * (or an exception in both cases).
+ */
+void expectSameDatamodel(const std::string& xml_string,
+                         const ddl::dd::Version& language_version,
+                         bool strict)
+{
+    using namespace ddl::dd;
+    std::string xml_expected;
+    bool dom_failed = false;
+    try {
+        xml_expected =
+            datamodel::toXMLString(fromXMLStringWithDOM(xml_string, language_version, strict));
+    }
+    catch (const Error&) {
+        dom_failed = true;
+    }
+    if (dom_failed) {
+        EXPECT_THROW(datamodel::fromXMLString(xml_string, language_version, strict), Error);
+    }
+    else {
+        datamodel::DataDefinition dd_streamed;
+        ASSERT_NO_THROW(dd_streamed =
+                            datamodel::fromXMLString(xml_string, language_version, strict));
+        EXPECT_EQ(datamodel::toXMLString(dd_streamed), xml_expected);
+    }
+}
+
+size_t getUsedHeapSize()
+{
+#ifdef TEST_DDFILE_MEASURE_HEAP
+    // large blocks are mapped separately
+    const auto heap_info = mallinfo2();
+    return heap_info.uordblks + heap_info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+/**
+ * Test whether the streaming XML writer creates the same output as the DOM based writing
+ * @details Read description files of all versions and compare the output of toXMLString,
+ *          toXMLStream and toXMLFile with the serialized DOM created by the DDToXMLFactory.
+ */
+TEST(TesterDDFile, writeStreamedEqualsDOM)
+{
+    using namespace ddl;
+    for (const auto& description_file: {"adtf.description",
+                                        "adtf_1_02.description",
+                                        "adtf_1_0p.description",
+                                        "adtf_dynamic.description",
+                                        "adtf_min_max_default.description",
+                                        "adtf_v40.description",
+                                        "fep_driver.description",
+                                        "force_version_ddl-2.0.description",
+                                        "force_version_ddl-3.0.description",
+                                        "no_structs.description",
+                                        "test_insert_results_ref.description",
+                                        "test_insert_valid.description",
+                                        "sorting/unsorted_v3.description",
+                                        "sorting/unsorted_v4.description"}) {
+        SCOPED_TRACE(description_file);
+        dd::DataDefinition dd_read;
+        ASSERT_NO_THROW(dd_read = DDFile::fromXMLFile(std::string(TEST_FILES_DIR) +
+                                                      description_file));
+
+        const auto xml_expected = toXMLStringWithDOM(dd_read);
+        EXPECT_EQ(DDString::toXMLString(dd_read), xml_expected);
+
+        std::ostringstream xml_stream;
+        dd::datamodel::toXMLStream(*dd_read.getModel(), xml_stream);
+        EXPECT_EQ(xml_stream.str(), xml_expected);
+
+        const std::string test_file_write = TEST_FILES_WRITE_DIR "streamed_test.description";
+        std::remove(test_file_write.c_str());
+        DDFile::toXMLFile(dd_read, test_file_write);
+        std::string xml_file_content;
+        ASSERT_EQ(a_util::filesystem::readTextFile(test_file_write, xml_file_content),
+                  a_util::filesystem::OK);
+        EXPECT_EQ(xml_file_content, xml_expected);
+    }
+}
+
+/**
+ * Test whether the streaming XML writer escapes like the DOM
+ */
+TEST(TesterDDFile, writeStreamedEscapedEqualsDOM)
+{
+    using namespace ddl;
+    dd::DataDefinition dd_read;
+    ASSERT_NO_THROW(dd_read = DDFile::fromXMLFile(TEST_FILES_DIR "adtf_v40.description"));
+    dd_read.getHeader().setAuthor("<\"dev_essential\" & 'team'>\r\n\tline\x01");
+    dd_read.getHeader().getExtDeclarations().add({"escaped", "<\"a\" & 'b'>\r\n\tc\x1f"});
+
+    const auto xml_written = DDString::toXMLString(dd_read);
+    EXPECT_EQ(xml_written, toXMLStringWithDOM(dd_read));
+    EXPECT_NE(xml_written.find("<author>&lt;\"dev_essential\" &amp; 'team'&gt;\r\n\tline&#01;"
+                               "</author>"),
+              std::string::npos);
+    EXPECT_NE(xml_written.find("value=\"&lt;&quot;a&quot; &amp; 'b'&gt;&#13;&#10;\tc&#31;\""),
+              std::string::npos);
+}
+
+/**
+ * Benchmark of the streaming XML writer against the DOM based writing
+ */
+TEST(TesterDDFile, writeStreamedPerformance)
+{
+    using namespace ddl;
+    const auto dd_large = createLargeDD();
+
+    constexpr size_t loop_count = 10;
+    Measuremment measure_dom;
+    size_t heap_peak_dom = 0;
+    std::string xml_dom;
+    for (size_t loop = 0; loop < loop_count; ++loop) {
+        const auto heap_before = getUsedHeapSize();
+        measure_dom.start();
+        a_util::xml::DOM dom;
+        dom.fromString("<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>\n"
+                       "<ddl:ddl xmlns:ddl=\"ddl\"> \n"
+                       "</ddl:ddl>");
+        a_util::xml::DOMElement root = dom.getRoot();
+        dd::DDToXMLFactory<a_util::xml::DOMElement>::createNode(root, *dd_large.getModel());
+        xml_dom = dom.toString();
+        measure_dom.stop();
+        // DOM and the string are alive at the same time
+        heap_peak_dom = getUsedHeapSize() - heap_before;
+        xml_dom.clear();
+        xml_dom.shrink_to_fit();
+    }
+
+    Measuremment measure_streamed;
+    size_t heap_peak_streamed = 0;
+    std::string xml_streamed;
+    for (size_t loop = 0; loop < loop_count; ++loop) {
+        const auto heap_before = getUsedHeapSize();
+        measure_streamed.start();
+        xml_streamed = DDString::toXMLString(dd_large);
+        measure_streamed.stop();
+        heap_peak_streamed = getUsedHeapSize() - heap_before;
+        if (loop + 1 < loop_count) {
+            xml_streamed.clear();
+            xml_streamed.shrink_to_fit();
+        }
+    }
+    EXPECT_EQ(xml_streamed, toXMLStringWithDOM(dd_large));
+
+    const auto result_dom = measure_dom.getResult();
+    const auto result_streamed = measure_streamed.getResult();
+    std::cout << "XML size: " << xml_streamed.size() << " bytes" << std::endl;
+    std::cout << "DOM:      " << result_dom.average_duration << " ns average, "
+              << heap_peak_dom << " bytes heap" << std::endl;
+    std::cout << "Streamed: " << result_streamed.average_duration << " ns average, "
+              << heap_peak_streamed << " bytes heap" << std::endl;
+#ifdef TEST_DDFILE_MEASURE_HEAP
+    EXPECT_LT(heap_peak_streamed, heap_peak_dom);
+#endif
+}
+
+/**
+ * Test whether the streaming XML reader creates the same datamodel as the DOM based reading
+ * @details Read all description files with and without strict mode and for different language
+ *          versions.
+ */
+TEST(TesterDDFile, readStreamedEqualsDOM)
+{
+    using namespace ddl;
+    for (const auto& description_file: {"adtf.description",
+                                        "adtf1.description",
+                                        "adtf2.xml",
+                                        "adtf_1_02.description",
+                                        "adtf_1_0p.description",
+                                        "adtf_1_0p_out_expected.xml",
+                                        "adtf_changed_expected.xml",
+                                        "adtf_dynamic.description",
+                                        "adtf_merged_expected.xml",
+                                        "adtf_min_max_default.description",
+                                        "adtf_recursion.description",
+                                        "adtf_v40.description",
+                                        "default_expected.description",
+                                        "fep_driver.description",
+                                        "force_version_ddl-2.0.description",
+                                        "force_version_ddl-3.0.description",
+                                        "invalid_but_legacy_test.description",
+                                        "invalid_but_legacy_test_2.description",
+                                        "invalid_numbits_attribute.description",
+                                        "no_structs.description",
+                                        "partial_expected.description",
+                                        "printer.description",
+                                        "test_insert.description",
+                                        "test_insert_results_ref.description",
+                                        "test_insert_valid.description",
+                                        "unresolved_datatype.description",
+                                        "sorting/unsorted_v3.description",
+                                        "sorting/unsorted_v4.description"}) {
+        SCOPED_TRACE(description_file);
+        std::string xml_string;
+        ASSERT_EQ(a_util::filesystem::readTextFile(std::string(TEST_FILES_DIR) + description_file,
+                                                   xml_string),
+                  a_util::filesystem::OK);
+        for (const auto strict: {false, true}) {
+            for (const auto& language_version:
+                 {dd::Version(0, 0), dd::Version(2, 0), dd::Version(4, 1)}) {
+                SCOPED_TRACE(::testing::Message()
+                             << "strict: " << strict
+                             << " version: " << dd::VersionConversion::toString(language_version));
+                expectSameDatamodel(xml_string, language_version, strict);
+            }
+            // the file reading uses the version of the file
+            SCOPED_TRACE(::testing::Message() << "file, strict: " << strict);
+            std::string xml_expected;
+            try {
+                xml_expected = dd::datamodel::toXMLString(
+                    fromXMLStringWithDOM(xml_string, dd::Version(0, 0), strict));
+            }
+            catch (const dd::Error&) {
+            }
+            if (xml_expected.empty()) {
+                EXPECT_THROW(
+                    dd::datamodel::fromXMLFile(std::string(TEST_FILES_DIR) + description_file,
+                                               strict),
+                    dd::Error);
+            }
+            else {
+                EXPECT_EQ(dd::datamodel::toXMLString(dd::datamodel::fromXMLFile(
+                              std::string(TEST_FILES_DIR) + description_file, strict)),
+                          xml_expected);
+            }
+        }
+    }
+}
+
+/**
+ * Test whether the streaming XML reader handles the XML syntax like the DOM
+ */
+TEST(TesterDDFile, readStreamedSyntaxEqualsDOM)
+{
+    using namespace ddl;
+    // header after the structs, comments, processing instructions, CDATA and references
+    expectSameDatamodel(
+        "\xef\xbb\xbf<?xml version=\"1.0\"?>\n<!DOCTYPE ddl [<!ELEMENT ddl ANY>]>"
+        "<ddl:ddl xmlns:ddl=\"ddl\"><!-- <structs> -->"
+        "<structs><struct name=\"tTest\" version=\"1\" comment=\"a&#9;b\tc\r\nd&#x41;&lt;&quot;"
+        "&unknown;&#;&#12a;\"><element name=\"a\" type=\"tUInt8\" arraysize=\'1\'>"
+        "<serialized bytepos=\"0\" byteorder=\"LE\"/><deserialized alignment=\"1\"/>"
+        "</element></struct></structs>"
+        "<header><language_version>3.00</language_version><author>a&amp;b\r\nc</author>"
+        "<date_creation> <![CDATA[<date>]]></date_creation><date_change>\n</date_change>"
+        "<description>first<?pi?><b/>second</description></header></ddl:ddl>",
+        {},
+        false);
+    // empty and special root elements
+    expectSameDatamodel("<struct name=\"tTest\" version=\"1\"><element name=\"a\" "
+                        "type=\"tUInt8\" bytepos=\"0\" byteorder=\"LE\" alignment=\"1\"/>"
+                        "</struct>",
+                        {},
+                        false);
+    expectSameDatamodel("<units><baseunit name=\"Metre\" symbol=\"m\" description=\"\"/></units>"
+                        "<units><baseunit name=\"Second\" symbol=\"s\" description=\"\"/></units>",
+                        dd::Version(4, 1),
+                        true);
+    expectSameDatamodel("<ddl/>", {}, false);
+
+    // not well formed
+    for (const auto& invalid_xml: {"",
+                                   "  ",
+                                   "<structs>",
+                                   "<structs></struct>",
+                                   "<structs><struct name=\"a></structs>",
+                                   "<structs><struct name=a/></structs>",
+                                   "<structs><struct name=\"a\"name=\"b\"/></structs>",
+                                   "<structs><!-- </structs>",
+                                   "<structs><</structs>",
+                                   "<structs/><"}) {
+        SCOPED_TRACE(invalid_xml);
+        EXPECT_THROW(dd::datamodel::fromXMLString(invalid_xml), dd::Error);
+        EXPECT_THROW(DDString::fromXMLString(invalid_xml), dd::Error);
+    }
+}
+
+/**
+ * Benchmark of the streaming XML reader against the DOM based reading
+ */
+TEST(TesterDDFile, readStreamedPerformance)
+{
+    using namespace ddl;
+    const auto xml_large = DDString::toXMLString(createLargeDD());
+
+    constexpr size_t loop_count = 10;
+    Measuremment measure_dom;
+    size_t heap_peak_dom = 0;
+    for (size_t loop = 0; loop < loop_count; ++loop) {
+        const auto heap_before = getUsedHeapSize();
+        measure_dom.start();
+        a_util::xml::DOM dom;
+        dom.fromString(xml_large);
+        const auto dd_read = dd::DDFromXMLFactory<a_util::xml::DOMElement>::createDD(
+            dom.getRoot(), dd::Version(0, 0), false);
+        measure_dom.stop();
+        // DOM and the datamodel are alive at the same time
+        heap_peak_dom = getUsedHeapSize() - heap_before;
+    }
+
+    Measuremment measure_streamed;
+    size_t heap_streamed = 0;
+    for (size_t loop = 0; loop < loop_count; ++loop) {
+        const auto heap_before = getUsedHeapSize();
+        measure_streamed.start();
+        const auto dd_read = dd::datamodel::fromXMLString(xml_large);
+        measure_streamed.stop();
+        heap_streamed = getUsedHeapSize() - heap_before;
+    }
+    // the streaming reader holds a copy of the XML while reading
+    const auto heap_peak_streamed = heap_streamed + xml_large.size();
+
+    const auto result_dom = measure_dom.getResult();
+    const auto result_streamed = measure_streamed.getResult();
+    std::cout << "XML size: " << xml_large.size() << " bytes" << std::endl;
+    std::cout << "DOM:      " << result_dom.average_duration << " ns average, "
+              << heap_peak_dom << " bytes heap" << std::endl;
+    std::cout << "Streamed: " << result_streamed.average_duration << " ns average, "
+              << heap_peak_streamed << " bytes heap" << std::endl;
+#ifdef TEST_DDFILE_MEASURE_HEAP
+    EXPECT_LT(heap_peak_streamed, heap_peak_dom);
+#endif
+}
+
+/**
+ * Test reading a DataDefinition into an arena
+ * @details The datamodel read within an ArenaScope equals the one read from the heap. Items
+ *          accessed via the API keep the arena alive after the DataDefinition was destroyed.
+ */
+TEST(TesterDDFile, readIntoArena)
+{
+    using namespace ddl;
+    const auto xml_large = DDString::toXMLString(createLargeDD());
+    std::weak_ptr<dd::utility::MonotonicArena> arena_observer;
+    std::shared_ptr<const dd::StructType> struct_type;
+    {
+        dd::DataDefinition dd_arena;
+        {
+            auto arena = std::make_shared<dd::utility::MonotonicArena>();
+            arena_observer = arena;
+            dd::utility::ArenaScope arena_scope(arena);
+            ASSERT_NO_THROW(dd_arena = DDString::fromXMLString(xml_large));
+            // at least the type and validation infos of the struct types and elements
+            EXPECT_GT(arena->getAllocationCount(), 3000u);
+        }
+        const auto dd_heap = DDString::fromXMLString(xml_large);
+        EXPECT_EQ(DDCompare::isEqual(dd_arena, dd_heap, DDCompare::dcf_everything),
+                  a_util::result::SUCCESS);
+        EXPECT_TRUE(dd_arena.isValid());
+        EXPECT_EQ(dd_arena.getStructTypes()
+                      .get("tLarge_999")
+                      ->getInfo<dd::TypeInfo>()
+                      ->getTypeByteSize(),
+                  80u);
+
+        // a copy outside of the scope is created on the heap
+        const dd::DataDefinition dd_copy = dd_arena;
+        dd_arena.getStructTypes().remove("tLarge_0");
+        EXPECT_TRUE(dd_copy.getStructTypes().get("tLarge_0"));
+        EXPECT_EQ(DDCompare::isEqual(dd_copy, dd_heap, DDCompare::dcf_everything),
+                  a_util::result::SUCCESS);
+        struct_type = dd_arena.getStructTypes().get("tLargeElem");
+    }
+    ASSERT_FALSE(arena_observer.expired());
+    EXPECT_EQ(struct_type->getName(), "tLargeElem");
+    EXPECT_EQ(struct_type->getElements().getSize(), 20u);
+    struct_type.reset();
+    EXPECT_TRUE(arena_observer.expired());
+}
+
+/**
+ * Benchmark of reading a DataDefinition into an arena against reading it from the heap
+ */
+TEST(TesterDDFile, readIntoArenaPerformance)
+{
+    using namespace ddl;
+    const auto xml_large = DDString::toXMLString(createLargeDD());
+
+    constexpr size_t loop_count = 10;
+    Measuremment measure_heap;
+    size_t heap_used_heap = 0;
+    size_t allocation_count_heap = 0;
+    for (size_t loop = 0; loop < loop_count; ++loop) {
+        const auto heap_before = getUsedHeapSize();
+        const size_t allocation_count_before = heap_allocation_count;
+        measure_heap.start();
+        const auto dd_read = DDString::fromXMLString(xml_large);
+        measure_heap.stop();
+        heap_used_heap = getUsedHeapSize() - heap_before;
+        allocation_count_heap = heap_allocation_count - allocation_count_before;
+    }
+
+    Measuremment measure_arena;
+    size_t heap_used_arena = 0;
+    size_t allocation_count_arena = 0;
+    size_t arena_allocation_count = 0;
+    for (size_t loop = 0; loop < loop_count; ++loop) {
+        const auto heap_before = getUsedHeapSize();
+        const size_t allocation_count_before = heap_allocation_count;
+        measure_arena.start();
+        auto arena = std::make_shared<dd::utility::MonotonicArena>();
+        dd::utility::ArenaScope arena_scope(arena);
+        const auto dd_read = DDString::fromXMLString(xml_large);
+        measure_arena.stop();
+        heap_used_arena = getUsedHeapSize() - heap_before;
+        allocation_count_arena = heap_allocation_count - allocation_count_before;
+        arena_allocation_count = arena->getAllocationCount();
+    }
+
+    const auto result_heap = measure_heap.getResult();
+    const auto result_arena = measure_arena.getResult();
+    std::cout << "XML size: " << xml_large.size() << " bytes" << std::endl;
+    std::cout << "Heap:  " << result_heap.average_duration << " ns average, " << heap_used_heap
+              << " bytes heap, " << allocation_count_heap << " allocations" << std::endl;
+    std::cout << "Arena: " << result_arena.average_duration << " ns average, " << heap_used_arena
+              << " bytes heap, " << allocation_count_arena << " allocations ("
+              << arena_allocation_count << " from the arena)" << std::endl;
+    EXPECT_LT(allocation_count_arena, allocation_count_heap);
+}
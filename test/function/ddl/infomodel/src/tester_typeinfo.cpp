@@ -535,4 +535,149 @@ TEST(TesterOODDL, checkAddingTypesWithCorrectReferences)
             }
         }
     }
-}
\ No newline at end of file
+}
+namespace incremental_test {
+void addStruct(ddl::dd::DataDefinition& dd,
+               const std::string& struct_name,
+               const std::vector<std::string>& element_type_names)
+{
+    ddl::dd::StructType struct_type(struct_name);
+    size_t elem_count = 0;
+    for (const auto& type_name: element_type_names) {
+        struct_type.getElements().add(ddl::dd::StructType::Element(
+            "elem_" + std::to_string(elem_count++), type_name, {4}, {}));
+    }
+    dd.getStructTypes().add(struct_type);
+}
+
+/**
+ * Creates a diamond of dependencies:
+ * base <- mid <- top, base <- top, tUInt8 <- e1 <- top and a stream using top.
+ * Additionally the given count of structs is added which do not depend on the diamond.
+ */
+ddl::dd::DataDefinition createDiamond(size_t unrelated_struct_count)
+{
+    using namespace test_ddl;
+    ddl::dd::DataDefinition my_dd;
+    my_dd.getDataTypes().add(uint8_data_type());
+    my_dd.getDataTypes().add(uint16_data_type());
+    my_dd.getDataTypes().add(int32_data_type());
+    my_dd.getEnumTypes().add({"e1", "tUInt8"});
+    addStruct(my_dd, "base", {"tUInt8", "tUInt8"});
+    addStruct(my_dd, "mid", {"tUInt8", "base"});
+    addStruct(my_dd, "top", {"mid", "e1", "base", "tUInt8"});
+    for (size_t struct_count = 0; struct_count < unrelated_struct_count; ++struct_count) {
+        addStruct(my_dd,
+                  "unrelated_" + std::to_string(struct_count),
+                  {"tInt32", "tUInt16", "tInt32", "tUInt16"});
+    }
+    my_dd.getStreams().add({"top_stream", "top"});
+    return my_dd;
+}
+
+void expectSameLayout(const ddl::dd::DataDefinition& incremental_dd)
+{
+    // the fully recalculated reference is a freshly loaded copy
+    const auto full_dd =
+        ddl::DDString::fromXMLString(ddl::DDString::toXMLString(incremental_dd));
+    ASSERT_EQ(incremental_dd.isValid(), full_dd.isValid());
+    for (const auto& current_struct: full_dd.getStructTypes()) {
+        const auto& struct_name = current_struct.second->getName();
+        const auto full_access = full_dd.getStructTypeAccess(struct_name);
+        const auto incremental_access = incremental_dd.getStructTypeAccess(struct_name);
+        ASSERT_TRUE(incremental_access) << struct_name;
+        EXPECT_EQ(incremental_access.getStaticStructSize(), full_access.getStaticStructSize())
+            << struct_name;
+        EXPECT_EQ(incremental_access.getStaticUnalignedStructSize(),
+                  full_access.getStaticUnalignedStructSize())
+            << struct_name;
+        EXPECT_EQ(incremental_access.getStaticSerializedBitSize(),
+                  full_access.getStaticSerializedBitSize())
+            << struct_name;
+        EXPECT_EQ(incremental_access.isDynamic(), full_access.isDynamic()) << struct_name;
+        auto incremental_elem = incremental_access.begin();
+        for (const auto& full_elem: full_access) {
+            ASSERT_NE(incremental_elem, incremental_access.end()) << struct_name;
+            const auto elem_name = struct_name + "." + full_elem.getElement().getName();
+            EXPECT_EQ(incremental_elem->getDeserializedBytePos(),
+                      full_elem.getDeserializedBytePos())
+                << elem_name;
+            EXPECT_EQ(incremental_elem->getDeserializedByteSize(),
+                      full_elem.getDeserializedByteSize())
+                << elem_name;
+            EXPECT_EQ(incremental_elem->getSerializedBytePos(), full_elem.getSerializedBytePos())
+                << elem_name;
+            EXPECT_EQ(incremental_elem->getSerializedBitSize(), full_elem.getSerializedBitSize())
+                << elem_name;
+            ++incremental_elem;
+        }
+        EXPECT_EQ(incremental_elem, incremental_access.end()) << struct_name;
+    }
+}
+} // namespace incremental_test
+
+/**
+ * @detail A change of a single type only recalculates the dependent types.
+ *         The result must be equal to a full recalculation of the whole DataDefinition.
+ */
+TEST(TesterOODDL, checkIncrementalTypeCalculationEqualsFullCalculation)
+{
+    using namespace incremental_test;
+    auto my_dd = createDiamond(10);
+    ASSERT_TRUE(my_dd.isValid());
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    // change a datatype used via enum and struct
+    my_dd.getDataTypes().access("tUInt8")->setBitSize(32);
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    // add an element to the bottom of the diamond
+    my_dd.getStructTypes().access("base")->getElements().add(
+        ddl::dd::StructType::Element("added", "tInt32", {4}, {}));
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    // change an element type within the bottom of the diamond
+    my_dd.getStructTypes().access("base")->getElements().access("elem_0")->setTypeName("tUInt16");
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    // change the array size within the middle of the diamond
+    my_dd.getStructTypes().access("mid")->getElements().access("elem_1")->setArraySize(3);
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    // change the datatype of the enum
+    my_dd.getEnumTypes().access("e1")->setDataTypeName("tUInt16");
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    // remove an element of the bottom of the diamond
+    my_dd.getStructTypes().access("base")->getElements().remove("added");
+    ASSERT_NO_FATAL_FAILURE(expectSameLayout(my_dd));
+
+    ASSERT_TRUE(my_dd.isValid());
+}
+
+/**
+ * @detail The time of a single edit must depend on the dependency cone of the changed type, not on
+ *         the size of the whole DataDefinition.
+ */
+TEST(TesterOODDL, checkSingleEditPerformance)
+{
+    using namespace incremental_test;
+    for (size_t unrelated_struct_count: {10, 1000}) {
+        auto my_dd = createDiamond(unrelated_struct_count);
+        auto base_type = my_dd.getStructTypes().access("base");
+        auto elem_to_change = base_type->getElements().access("elem_0");
+
+        Measuremment measurement;
+        size_t test_count = 200;
+        for (size_t edit_count = 0; edit_count < test_count; ++edit_count) {
+            measurement.start();
+            elem_to_change->setTypeName((edit_count % 2) == 0 ? "tUInt16" : "tUInt8");
+            measurement.stop();
+        }
+        const auto measurement_result = measurement.getResult();
+        std::cout << "Single edit within a DataDefinition with " << unrelated_struct_count
+                  << " unrelated structs: " << std::endl
+                  << Measuremment::getResultAsString(measurement_result, 1);
+        ASSERT_TRUE(my_dd.isValid());
+    }
+}
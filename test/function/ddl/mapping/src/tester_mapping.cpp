@@ -13,17 +13,28 @@
 
 #include <a_util/filesystem.h>
 #include <a_util/result/error_def.h>
+#include <a_util/strings.h>
 #include <a_util/system.h>
 #include <ddl/codec/access_element.h>
+#include <ddl/codec/codec_factory.h>
+#include <ddl/codec/codec_factory_cache.h>
 #include <ddl/codec/static_codec.h>
 #include <ddl/dd/ddfile.h>
 #include <ddl/dd/ddstring.h>
+#include <ddl/mapping/engine/data_trigger.h>
 #include <ddl/mapping/engine/mapping_engine.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <limits>
 #include <memory>
+#include <thread>
 
 using namespace ddl::mapping;
 using namespace ddl::mapping::rt;
@@ -32,6 +43,7 @@ using namespace ddl;
 _MAKE_RESULT(-4, ERR_POINTER);
 _MAKE_RESULT(-5, ERR_INVALID_ARG);
 _MAKE_RESULT(-11, ERR_INVALID_FILE);
+_MAKE_RESULT(-13, ERR_TIMEOUT);
 _MAKE_RESULT(-20, ERR_NOT_FOUND);
 _MAKE_RESULT(-38, ERR_FAILED);
 _MAKE_RESULT(-42, ERR_INVALID_TYPE);
@@ -909,6 +921,7 @@ class MappingDriver : private IMappingEnvironment {
     std::map<std::string, Target::MemoryBuffer> mapTargetBuffers;
     std::map<handle_t, std::string> mapHandleTarget;
     tPeriodicWrappers m_mapPeriodicWrappers;
+    std::function<void(const void*, size_t)> m_fnTargetSent;
 
 protected:
     MappingEngine m_oEngine;
@@ -989,6 +1002,48 @@ public:
         ASSERT_TRUE(oTargetCoder.isValid());
     }
 
+    const MapConfiguration& getConfiguration() const
+    {
+        return m_oConfig;
+    }
+
+    IMappingEnvironment& getEnvironment()
+    {
+        return *this;
+    }
+
+    a_util::result::Result updateConfiguration(const MapConfiguration& oConfig)
+    {
+        return m_oEngine.updateConfiguration(oConfig);
+    }
+
+    a_util::result::Result updateConfiguration(const MapConfiguration& oConfig,
+                                               timestamp_t tmTimeout)
+    {
+        return m_oEngine.updateConfiguration(oConfig, tmTimeout);
+    }
+
+    handle_t getTargetHandle(const std::string& strTarget)
+    {
+        return mapTargetHandle[strTarget];
+    }
+
+    /// the callback is called for each target sent by a trigger
+    void setTargetSentCallback(std::function<void(const void*, size_t)> fnTargetSent)
+    {
+        m_fnTargetSent = std::move(fnTargetSent);
+    }
+
+    a_util::result::Result mapAndUnmapAll(const std::string& strTarget)
+    {
+        handle_t hTarget = nullptr;
+        const a_util::result::Result nRes = m_oEngine.Map(strTarget, hTarget);
+        if (!nRes) {
+            return nRes;
+        }
+        return m_oEngine.unmapAll();
+    }
+
     void resetEngine()
     {
         // reset engine
@@ -1066,6 +1121,9 @@ private:
             a_util::memory::copy(
                 &mapTargetBuffers[mapHandleTarget[hTarget]][0], szSize, pData, szSize);
         }
+        if (m_fnTargetSent) {
+            m_fnTargetSent(pData, szSize);
+        }
         return a_util::result::SUCCESS;
     }
 
@@ -1085,6 +1143,7 @@ private:
         return a_util::result::SUCCESS;
     }
 
+protected:
     void resolveTypeTest(const char* strTypeName, const char*& strTypeDescription)
     {
         static std::string strDesc;
@@ -1092,6 +1151,8 @@ private:
         strTypeDescription = strDesc.c_str();
     }
 
+private:
+
     timestamp_t getTime() const
     {
         return a_util::system::getCurrentMicroseconds();
@@ -1747,3 +1808,443 @@ TEST(cTesterMapping, TestInvalidAndWrongMap)
     ASSERT_EQ(count_valid_triggers, 3);
     ASSERT_EQ(count_invalid_triggers, 7);
 }
+
+/**
+ * @detail Test the update of the mapping configuration of a running engine
+ */
+TEST(cTesterMapping, TestUpdateConfigurationEngine)
+{
+    MappingDriver base_test(TEST_FILES_DIR "engine.description",
+                            TEST_FILES_DIR "engine_update.map");
+    base_test.addTarget("OutSignal");
+    base_test.startEngine();
+    const handle_t hTarget = base_test.getTargetHandle("OutSignal");
+
+    ddl::codec::StaticCodec& oTarget = base_test.getTargetCoder("OutSignal");
+    ddl::codec::StaticCodec& oSource = base_test.getSourceCoder("MinimalSignal");
+    oSource.setElementValue(oSource.getElement("i32Val").getIndex(), 42);
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("MinimalSignal"));
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.receiveTargetBuffer("OutSignal"));
+    EXPECT_EQ(oTarget.getElementValue<int32_t>(oTarget.getElement("i32Val").getIndex()), 42);
+    EXPECT_EQ(oTarget.getElementValue<int16_t>(oTarget.getElement("i16Val").getIndex()), 3);
+    EXPECT_EQ(oTarget.getElementValue<int64_t>(oTarget.getElement("i64Val").getIndex()), 0);
+
+    // change a constant and add an assignment
+    MapConfiguration oConfig(base_test.getConfiguration());
+    MapTarget* pMapTarget = oConfig.getTarget("OutSignal");
+    ASSERT_EQ(a_util::result::SUCCESS, pMapTarget->removeAssignment("i16Val"));
+    MapAssignment oConstant("i16Val");
+    ASSERT_EQ(a_util::result::SUCCESS, oConstant.setConstant("4"));
+    ASSERT_EQ(a_util::result::SUCCESS, pMapTarget->addAssignment(oConstant));
+    MapAssignment oAssignment("i64Val");
+    ASSERT_EQ(a_util::result::SUCCESS, oAssignment.connect("MinimalSignal.i32Val"));
+    ASSERT_EQ(a_util::result::SUCCESS, pMapTarget->addAssignment(oAssignment));
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.updateConfiguration(oConfig));
+
+    // the buffer is kept, the constant is set immediately
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.receiveTargetBuffer("OutSignal"));
+    EXPECT_EQ(oTarget.getElementValue<int32_t>(oTarget.getElement("i32Val").getIndex()), 42);
+    EXPECT_EQ(oTarget.getElementValue<int16_t>(oTarget.getElement("i16Val").getIndex()), 4);
+    EXPECT_EQ(oTarget.getElementValue<int64_t>(oTarget.getElement("i64Val").getIndex()), 0);
+    oSource.setElementValue(oSource.getElement("i32Val").getIndex(), 43);
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("MinimalSignal"));
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.receiveTargetBuffer("OutSignal"));
+    EXPECT_EQ(oTarget.getElementValue<int32_t>(oTarget.getElement("i32Val").getIndex()), 43);
+    EXPECT_EQ(oTarget.getElementValue<int64_t>(oTarget.getElement("i64Val").getIndex()), 43);
+    EXPECT_EQ(base_test.getTargetHandle("OutSignal"), hTarget);
+
+    // type changes are not possible, the current configuration is kept
+    MapConfiguration oInvalidConfig(oConfig);
+    oInvalidConfig.getTarget("OutSignal")->setType("InStruct");
+    EXPECT_EQ(ERR_INVALID_ARG, base_test.updateConfiguration(oInvalidConfig));
+    MapConfiguration oMissingTargetConfig(oConfig);
+    ASSERT_EQ(a_util::result::SUCCESS, oMissingTargetConfig.removeTarget("OutSignal"));
+    EXPECT_EQ(ERR_INVALID_ARG, base_test.updateConfiguration(oMissingTargetConfig));
+    oSource.setElementValue(oSource.getElement("i32Val").getIndex(), 44);
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("MinimalSignal"));
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.receiveTargetBuffer("OutSignal"));
+    EXPECT_EQ(oTarget.getElementValue<int64_t>(oTarget.getElement("i64Val").getIndex()), 44);
+}
+
+/**
+ * @detail Test that no sample is lost or torn while the configuration is updated repeatedly.
+ * Each sample of the source sends the target, in each sent target all assignments of one
+ * configuration must contain the value of the same sample.
+ */
+TEST(cTesterMapping, TestUpdateConfigurationWhileReceiving)
+{
+    MappingDriver base_test(TEST_FILES_DIR "engine.description",
+                            TEST_FILES_DIR "engine_update.map");
+    base_test.addTarget("OutSignal");
+    base_test.startEngine();
+
+    const MapConfiguration oConfig(base_test.getConfiguration());
+    MapConfiguration oOtherConfig(oConfig);
+    MapTarget* pMapTarget = oOtherConfig.getTarget("OutSignal");
+    ASSERT_EQ(a_util::result::SUCCESS, pMapTarget->removeAssignment("i16Val"));
+    MapAssignment oConstant("i16Val");
+    ASSERT_EQ(a_util::result::SUCCESS, oConstant.setConstant("4"));
+    ASSERT_EQ(a_util::result::SUCCESS, pMapTarget->addAssignment(oConstant));
+    MapAssignment oAssignment("i64Val");
+    ASSERT_EQ(a_util::result::SUCCESS, oAssignment.connect("MinimalSignal.i32Val"));
+    ASSERT_EQ(a_util::result::SUCCESS, pMapTarget->addAssignment(oAssignment));
+
+    const auto oDD = LoadDDL(TEST_FILES_DIR "engine.description");
+    const ddl::codec::CodecFactory oFactory(*oDD.getStructTypes().get("OutStruct"), oDD);
+    const auto i16_index = oFactory.getElement("i16Val").getIndex();
+    const auto i32_index = oFactory.getElement("i32Val").getIndex();
+    const auto i64_index = oFactory.getElement("i64Val").getIndex();
+    const auto struct_i32_index = oFactory.getElement("structMinimal.i32Val").getIndex();
+    int32_t nSentCount = 0;
+    int32_t nTornCount = 0;
+    int32_t nOtherConfigCount = 0;
+    base_test.setTargetSentCallback([&](const void* pData, size_t szData) {
+        const auto oDecoder = oFactory.makeStaticDecoderFor(pData, szData);
+        ++nSentCount;
+        const bool bOtherConfig = oDecoder.getElementValue<int16_t>(i16_index) == 4;
+        if (oDecoder.getElementValue<int32_t>(i32_index) != nSentCount ||
+            oDecoder.getElementValue<int32_t>(struct_i32_index) != nSentCount ||
+            (bOtherConfig && oDecoder.getElementValue<int64_t>(i64_index) != nSentCount)) {
+            ++nTornCount;
+        }
+        if (bOtherConfig) {
+            ++nOtherConfigCount;
+        }
+    });
+
+    const int32_t nSampleCount = 20000;
+    std::atomic<bool> bSending{true};
+    std::thread oSender([&]() {
+        ddl::codec::StaticCodec& oSource = base_test.getSourceCoder("MinimalSignal");
+        const auto source_i32_index = oSource.getElement("i32Val").getIndex();
+        for (int32_t nSample = 1; nSample <= nSampleCount; ++nSample) {
+            oSource.setElementValue(source_i32_index, nSample);
+            base_test.sendSourceBuffer("MinimalSignal");
+        }
+        bSending = false;
+    });
+    size_t nUpdateCount = 0;
+    for (; bSending || nUpdateCount < 100; ++nUpdateCount) {
+        EXPECT_EQ(a_util::result::SUCCESS,
+                  base_test.updateConfiguration(nUpdateCount % 2 ? oConfig : oOtherConfig));
+    }
+    oSender.join();
+
+    EXPECT_EQ(nSentCount, nSampleCount);
+    EXPECT_EQ(nTornCount, 0);
+    std::cout << nOtherConfigCount << " of " << nSentCount << " samples were mapped with the "
+              << "other configuration while " << nUpdateCount << " updates" << std::endl;
+}
+
+/**
+ * @detail Test that a callback of a trigger may wait for another sample of its source while an
+ * update waits for the switch. The source lock must not be held while the triggers are called,
+ * otherwise the waiting update blocks the other sample.
+ */
+TEST(cTesterMapping, TestUpdateConfigurationWhileTriggerCallbackWaits)
+{
+    MappingDriver base_test(TEST_FILES_DIR "engine.description",
+                            TEST_FILES_DIR "engine_callback.map");
+    base_test.addTarget("OutSignal");
+    base_test.startEngine();
+
+    const MapConfiguration oConfig(base_test.getConfiguration());
+    ddl::codec::StaticCodec& oTrigger = base_test.getSourceCoder("TriggerSignal");
+    const auto trigger_i32_index = oTrigger.getElement("i32Val").getIndex();
+
+    std::future<a_util::result::Result> oUpdate;
+    std::future<a_util::result::Result> oOtherSample;
+    bool bOtherSampleProcessed = false;
+    base_test.setTargetSentCallback([&](const void*, size_t) {
+        if (oUpdate.valid()) {
+            return;
+        }
+        oUpdate = std::async(std::launch::async,
+                             [&]() { return base_test.updateConfiguration(oConfig); });
+        // give the update the time to wait for the switch
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // the other sample does not fulfill the trigger condition, so it sends no target
+        oOtherSample = std::async(std::launch::async, [&]() {
+            oTrigger.setElementValue(trigger_i32_index, 0);
+            return base_test.sendSourceBuffer("TriggerSignal");
+        });
+        bOtherSampleProcessed =
+            oOtherSample.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    });
+
+    oTrigger.setElementValue(trigger_i32_index, 1);
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("TriggerSignal"));
+    ASSERT_TRUE(oUpdate.valid());
+    EXPECT_TRUE(bOtherSampleProcessed);
+    EXPECT_EQ(a_util::result::SUCCESS, oOtherSample.get());
+    EXPECT_EQ(a_util::result::SUCCESS, oUpdate.get());
+}
+
+/**
+ * @detail Test that an update gives up the switch after its timeout while a trigger callback
+ * does not return and that the previous configuration is still in use afterwards.
+ */
+TEST(cTesterMapping, TestUpdateConfigurationTimeout)
+{
+    MappingDriver base_test(TEST_FILES_DIR "engine.description",
+                            TEST_FILES_DIR "engine_callback.map");
+    base_test.addTarget("OutSignal");
+    base_test.startEngine();
+
+    const MapConfiguration oConfig(base_test.getConfiguration());
+    ddl::codec::StaticCodec& oTrigger = base_test.getSourceCoder("TriggerSignal");
+    const auto trigger_i32_index = oTrigger.getElement("i32Val").getIndex();
+
+    std::future<a_util::result::Result> oUpdate;
+    bool bUpdateReturned = false;
+    int nSentCount = 0;
+    base_test.setTargetSentCallback([&](const void*, size_t) {
+        ++nSentCount;
+        if (oUpdate.valid()) {
+            return;
+        }
+        // the sample stays in progress until the update gave up
+        oUpdate = std::async(std::launch::async,
+                             [&]() { return base_test.updateConfiguration(oConfig, 10000); });
+        bUpdateReturned = oUpdate.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    });
+
+    oTrigger.setElementValue(trigger_i32_index, 1);
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("TriggerSignal"));
+    ASSERT_TRUE(oUpdate.valid());
+    EXPECT_TRUE(bUpdateReturned);
+    EXPECT_EQ(ERR_TIMEOUT, oUpdate.get());
+
+    // the previous configuration still maps, a later update succeeds
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("TriggerSignal"));
+    EXPECT_EQ(nSentCount, 2);
+    EXPECT_EQ(a_util::result::SUCCESS, base_test.updateConfiguration(oConfig));
+    ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("TriggerSignal"));
+    EXPECT_EQ(nSentCount, 3);
+}
+
+/// derived test class that resolves a changed layout of the element i8Val for all types
+class MappingDriverChangedLayout : public MappingDriver {
+public:
+    MappingDriverChangedLayout(const std::string& strDDL, const std::string& strMapping)
+        : MappingDriver(strDDL, strMapping), m_bChangeLayout(false)
+    {
+    }
+    a_util::result::Result resolveType(const char* strTypeName, const char*& strTypeDescription)
+    {
+        static std::string strDesc;
+        const char* strOrigDescription = nullptr;
+        resolveTypeTest(strTypeName, strOrigDescription);
+        strDesc = strOrigDescription;
+        if (m_bChangeLayout) {
+            a_util::strings::replace(
+                strDesc, "name=\"i8Val\" type=\"tInt8\"", "name=\"i8Val\" type=\"tUInt8\"");
+        }
+        strTypeDescription = strDesc.c_str();
+        return a_util::result::SUCCESS;
+    }
+    bool m_bChangeLayout;
+};
+
+/**
+ * @detail Check that updateConfiguration rejects a configuration if the layout of a mapped
+ * type has been changed in the meantime.
+ */
+TEST(cTesterMapping, TestUpdateConfigurationChangedLayout)
+{
+    MappingDriverChangedLayout base_test(TEST_FILES_DIR "engine.description",
+                                         TEST_FILES_DIR "engine_callback.map");
+    base_test.addTarget("OutSignal");
+    base_test.startEngine();
+
+    const MapConfiguration oConfig(base_test.getConfiguration());
+    EXPECT_EQ(a_util::result::SUCCESS, base_test.updateConfiguration(oConfig));
+
+    base_test.m_bChangeLayout = true;
+    EXPECT_EQ(ERR_INVALID_ARG, base_test.updateConfiguration(oConfig));
+}
+
+/**
+ * @detail Benchmark of the mapping setup with and without cached codec factories.
+ * The target of benchmark2.map references 93 sources of the same type.
+ */
+TEST(cTesterMapping, TestMappingSetupPerformance)
+{
+    using namespace std::chrono;
+    MappingDriver base_test(TEST_FILES_DIR "benchmark.description",
+                            TEST_FILES_DIR "benchmark2.map");
+    auto& codec_factory_cache = ddl::codec::CodecFactoryCache::getGlobalCache();
+    const size_t test_count = 10;
+
+    const auto start_uncached = steady_clock::now();
+    for (size_t current_test = 0; current_test < test_count; ++current_test) {
+        codec_factory_cache.clear();
+        ASSERT_EQ(a_util::result::SUCCESS, base_test.mapAndUnmapAll("Output0"));
+    }
+    const auto duration_uncached = (steady_clock::now() - start_uncached) / test_count;
+
+    const auto start_cached = steady_clock::now();
+    for (size_t current_test = 0; current_test < test_count; ++current_test) {
+        ASSERT_EQ(a_util::result::SUCCESS, base_test.mapAndUnmapAll("Output0"));
+    }
+    const auto duration_cached = (steady_clock::now() - start_cached) / test_count;
+
+    std::cout << "Mapping setup without cached codec factories: "
+              << duration_cast<microseconds>(duration_uncached).count() << " micro sec"
+              << std::endl
+              << "Mapping setup with cached codec factories: "
+              << duration_cast<microseconds>(duration_cached).count() << " micro sec"
+              << std::endl;
+}
+
+template <typename T>
+std::vector<T> makeIntegerSamples()
+{
+    return {std::numeric_limits<T>::lowest(),
+            static_cast<T>(std::numeric_limits<T>::lowest() + 1),
+            static_cast<T>(-1),
+            static_cast<T>(0),
+            static_cast<T>(1),
+            static_cast<T>(2),
+            static_cast<T>(3),
+            static_cast<T>(127),
+            static_cast<T>(128),
+            static_cast<T>(255),
+            static_cast<T>(256),
+            static_cast<T>((std::numeric_limits<T>::max)() - 1),
+            (std::numeric_limits<T>::max)()};
+}
+
+template <typename T>
+void checkCompiledComparison(DataTrigger& oTrigger,
+                             uint32_t type32,
+                             const std::vector<T>& vecSamples)
+{
+    ASSERT_EQ(a_util::result::SUCCESS, oTrigger.compile(type32));
+    for (const T& value: vecSamples) {
+        EXPECT_EQ(oTrigger.compare(static_cast<double>(value)), oTrigger.compare(&value))
+            << "type " << type32 << " sample " << static_cast<double>(value);
+    }
+}
+
+/**
+ * @detail Test the data trigger comparisons compiled for the type of the variable
+ */
+TEST(cTesterMapping, TestDataTriggerCompiledComparison)
+{
+    MappingDriver base_test(TEST_FILES_DIR "engine.description",
+                            TEST_FILES_DIR "engine_triggers.map");
+    const std::vector<std::string> vecOperators = {"equal",
+                                                   "not_equal",
+                                                   "less_than",
+                                                   "greater_than",
+                                                   "less_than_equal",
+                                                   "greater_than_equal"};
+    // the values 9.3e18 and 2e19 are behind the range of int64 and uint64, but far enough away
+    // from the limits to compare 64 bit samples as double without rounding issues
+    const std::vector<double> vecValues = {-std::numeric_limits<double>::infinity(),
+                                           -2e19,
+                                           -9.3e18,
+                                           -129.0,
+                                           -128.0,
+                                           -2.5,
+                                           -1.0,
+                                           0.0,
+                                           0.5,
+                                           1.0,
+                                           2.0,
+                                           127.0,
+                                           127.5,
+                                           128.0,
+                                           255.0,
+                                           256.0,
+                                           65535.0,
+                                           9.3e18,
+                                           2e19,
+                                           std::numeric_limits<double>::infinity(),
+                                           std::numeric_limits<double>::quiet_NaN()};
+
+    for (const auto& strOperator: vecOperators) {
+        for (const double f64Value: vecValues) {
+            SCOPED_TRACE(strOperator + " " + std::to_string(f64Value));
+            DataTrigger oTrigger(
+                base_test.getEnvironment(), "trigger", "variable", strOperator, f64Value);
+            // never fulfilled as long as it is not compiled
+            const int32_t i32Zero = 0;
+            EXPECT_FALSE(oTrigger.compare(&i32Zero));
+
+            checkCompiledComparison(oTrigger, e_uint8, makeIntegerSamples<uint8_t>());
+            checkCompiledComparison(oTrigger, e_uint16, makeIntegerSamples<uint16_t>());
+            checkCompiledComparison(oTrigger, e_uint32, makeIntegerSamples<uint32_t>());
+            checkCompiledComparison(oTrigger, e_uint64, makeIntegerSamples<uint64_t>());
+            checkCompiledComparison(oTrigger, e_int8, makeIntegerSamples<int8_t>());
+            checkCompiledComparison(oTrigger, e_int16, makeIntegerSamples<int16_t>());
+            checkCompiledComparison(oTrigger, e_int32, makeIntegerSamples<int32_t>());
+            checkCompiledComparison(oTrigger, e_int64, makeIntegerSamples<int64_t>());
+            checkCompiledComparison(oTrigger, e_bool, makeIntegerSamples<bool>());
+            checkCompiledComparison(oTrigger, e_char, makeIntegerSamples<char>());
+            checkCompiledComparison(
+                oTrigger, e_float32, std::vector<float>{-1e30f, -2.5f, 0.0f, 0.5f, 127.5f, 1e30f});
+            checkCompiledComparison(
+                oTrigger, e_float64, std::vector<double>{-1e300, -2.5, 0.0, 0.5, 127.5, 1e300});
+        }
+    }
+
+    DataTrigger oTrigger(base_test.getEnvironment(), "trigger", "variable", "equal", 1.0);
+    ASSERT_EQ(ERR_INVALID_TYPE, oTrigger.compile(0));
+}
+
+/**
+ * @detail Benchmark a source driving 100 data triggers
+ */
+TEST(cTesterMapping, TestDataTriggerPerformance)
+{
+    using namespace std::chrono;
+    MappingDriver base_test(TEST_FILES_DIR "engine.description",
+                            TEST_FILES_DIR "benchmark_data_triggers.map");
+    base_test.addTarget("OutSignal");
+    base_test.startEngine();
+
+    size_t nSentTargets = 0;
+    base_test.setTargetSentCallback([&nSentTargets](const void*, size_t) { ++nSentTargets; });
+
+    // the triggers of benchmark_data_triggers.map compare i32Val with their position in the list
+    const std::vector<std::string> vecOperators = {"equal",
+                                                   "not_equal",
+                                                   "less_than",
+                                                   "greater_than",
+                                                   "less_than_equal",
+                                                   "greater_than_equal"};
+    std::vector<std::unique_ptr<DataTrigger>> vecExpectedTriggers;
+    for (size_t nTrigger = 0; nTrigger < 100; ++nTrigger) {
+        vecExpectedTriggers.emplace_back(
+            new DataTrigger(base_test.getEnvironment(),
+                            "expected",
+                            "i32Val",
+                            vecOperators[nTrigger % vecOperators.size()],
+                            static_cast<double>(nTrigger)));
+    }
+
+    ddl::codec::StaticCodec& oSource = base_test.getSourceCoder("MinimalSignal");
+    const ddl::codec::CodecIndex oIndex = oSource.getElement("i32Val").getIndex();
+    const int32_t sample_count = 20000;
+    size_t nExpectedTargets = 0;
+    for (int32_t nSample = 0; nSample < sample_count; ++nSample) {
+        for (const auto& pTrigger: vecExpectedTriggers) {
+            nExpectedTargets += pTrigger->compare(static_cast<double>(nSample % 110 - 5)) ? 1 : 0;
+        }
+    }
+
+    const auto start = steady_clock::now();
+    for (int32_t nSample = 0; nSample < sample_count; ++nSample) {
+        oSource.setElementValue(oIndex, nSample % 110 - 5);
+        base_test.sendSourceBuffer("MinimalSignal");
+    }
+    const auto duration = steady_clock::now() - start;
+
+    std::cout << "Sample with 100 data triggers: "
+              << duration_cast<nanoseconds>(duration).count() / sample_count << " nano sec"
+              << std::endl;
+    EXPECT_EQ(nExpectedTargets, nSentTargets);
+}
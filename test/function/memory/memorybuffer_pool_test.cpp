@@ -0,0 +1,177 @@
+/**
+ * @file
+ * Memory buffer pool test implementation
+ *
+ * Copyright @ 2022 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <a_util/memory/memory.h>
+#include <a_util/memory/memorybuffer_pool.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using a_util::memory::HugePages;
+using a_util::memory::MemoryBuffer;
+using a_util::memory::MemoryBufferPool;
+
+namespace {
+bool isAligned(const void* pointer, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+} // namespace
+
+/// Buffers of a pool are aligned, zero-initialized and rounded up to a size class
+TEST(MemoryBufferPoolTest, allocateAlignedBuffers)
+{
+    EXPECT_THROW(MemoryBufferPool(48), std::invalid_argument);
+
+    MemoryBufferPool pool;
+    EXPECT_EQ(pool.getAlignment(), MemoryBufferPool::default_alignment);
+    EXPECT_EQ(pool.getCapacity(0), 0u);
+    EXPECT_EQ(pool.getCapacity(1), 64u);
+    EXPECT_EQ(pool.getCapacity(65), 128u);
+    EXPECT_EQ(pool.getCapacity(1000), 1024u);
+    EXPECT_EQ(pool.getCapacity(1025), 1280u);
+    EXPECT_EQ(pool.getCapacity(3 * 1024 * 1024 + 1), 3584u * 1024u);
+
+    for (std::size_t size = 1; size < 100000; size = size * 3 + 1) {
+        MemoryBuffer buffer(size, pool);
+        ASSERT_EQ(buffer.getSize(), size);
+        EXPECT_TRUE(isAligned(buffer.getPtr(), pool.getAlignment()));
+        EXPECT_TRUE(a_util::memory::isZero(buffer.getPtr(), size));
+        EXPECT_TRUE(a_util::memory::set(buffer, 42, size));
+    }
+
+    MemoryBufferPool page_pool(4096);
+    MemoryBuffer buffer(100, page_pool);
+    EXPECT_TRUE(isAligned(buffer.getPtr(), 4096));
+    EXPECT_TRUE(buffer.allocate(0, page_pool));
+    EXPECT_EQ(buffer.getPtr(), nullptr);
+    EXPECT_EQ(buffer.getSize(), 0u);
+}
+
+/// Released buffers are reused by allocations of the same size class
+TEST(MemoryBufferPoolTest, recycleReleasedBuffers)
+{
+    MemoryBufferPool pool(MemoryBufferPool::default_alignment, HugePages::none, 0, 2);
+    MemoryBuffer buffer(1000, pool);
+    void* const memory = buffer.getPtr();
+    EXPECT_TRUE(a_util::memory::set(buffer, 42, buffer.getSize()));
+
+    // a fitting size class keeps the memory, but zero-initializes it
+    EXPECT_TRUE(buffer.allocate(800, pool));
+    EXPECT_EQ(buffer.getPtr(), memory);
+    EXPECT_TRUE(a_util::memory::isZero(buffer.getPtr(), 800));
+    EXPECT_EQ(pool.getCachedSize(), 0u);
+
+    // the buffer is returned to the pool and reused
+    buffer.reset();
+    EXPECT_EQ(pool.getCachedSize(), 1024u);
+    MemoryBuffer other_buffer(1010, pool);
+    EXPECT_EQ(other_buffer.getPtr(), memory);
+    EXPECT_EQ(pool.getCachedSize(), 0u);
+
+    // growing exchanges the memory
+    EXPECT_TRUE(other_buffer.allocate(1500, pool));
+    EXPECT_NE(other_buffer.getPtr(), memory);
+    EXPECT_EQ(pool.getCachedSize(), 1024u);
+
+    // only the given amount of buffers is kept per size class
+    {
+        MemoryBuffer first(1000, pool), second(1000, pool), third(1000, pool);
+    }
+    EXPECT_EQ(pool.getCachedSize(), 2048u);
+    pool.shrink();
+    EXPECT_EQ(pool.getCachedSize(), 0u);
+
+    // heap buffers and attached buffers are not returned to the pool
+    MemoryBuffer heap_buffer(1000);
+    EXPECT_TRUE(heap_buffer.allocate(1000, pool));
+    heap_buffer.attach(&buffer, sizeof(buffer));
+    EXPECT_EQ(pool.getCachedSize(), 1024u);
+    heap_buffer.reset();
+    EXPECT_EQ(pool.getCachedSize(), 1024u);
+}
+
+/// Buffers may outlive their pool and may be allocated from several threads
+TEST(MemoryBufferPoolTest, buffersOutliveThePool)
+{
+    std::vector<MemoryBuffer> buffers(4);
+    {
+        MemoryBufferPool pool;
+        std::vector<std::thread> threads;
+        for (auto& buffer: buffers) {
+            threads.emplace_back([&buffer, &pool]() {
+                for (std::size_t cycle = 0; cycle < 1000; ++cycle) {
+                    ASSERT_TRUE(buffer.allocate(100 + cycle % 3 * 1000, pool));
+                    ASSERT_TRUE(a_util::memory::set(buffer, 42, buffer.getSize()));
+                }
+            });
+        }
+        for (auto& thread: threads) {
+            thread.join();
+        }
+    }
+    for (auto& buffer: buffers) {
+        EXPECT_EQ(buffer.getSize(), 100u);
+        buffer.reset();
+    }
+}
+
+/// Large buffers may be backed by huge pages
+TEST(MemoryBufferPoolTest, allocateHugePages)
+{
+    const std::size_t size = 3 * 1024 * 1024;
+    for (const auto huge_pages: {HugePages::transparent, HugePages::hugetlb}) {
+        MemoryBufferPool pool(MemoryBufferPool::default_alignment, huge_pages);
+        MemoryBuffer small_buffer(1000, pool);
+        EXPECT_EQ(pool.getCapacity(1000), 1024u);
+        MemoryBuffer buffer(size, pool);
+        ASSERT_NE(buffer.getPtr(), nullptr);
+        EXPECT_TRUE(a_util::memory::isZero(buffer.getPtr(), size));
+        EXPECT_TRUE(a_util::memory::set(buffer, 42, size));
+#ifdef __linux__
+        EXPECT_EQ(pool.getCapacity(size), 4u * 1024u * 1024u);
+        EXPECT_TRUE(isAligned(buffer.getPtr(), MemoryBufferPool::default_huge_page_threshold));
+#endif
+        buffer.reset();
+        EXPECT_EQ(pool.getCachedSize(), pool.getCapacity(size));
+    }
+}
+
+/// Benchmark of allocating, writing and releasing a large buffer with and without a pool
+TEST(MemoryBufferPoolTest, allocateReleasePerformance)
+{
+    using namespace std::chrono;
+    const std::size_t size = 4 * 1024 * 1024 + 100;
+    const std::size_t cycles = 200;
+    const auto measure = [&](const char* description, const auto& allocate) {
+        const auto start = steady_clock::now();
+        for (std::size_t cycle = 0; cycle < cycles; ++cycle) {
+            MemoryBuffer buffer;
+            ASSERT_TRUE(allocate(buffer));
+            static_cast<std::uint8_t*>(buffer.getPtr())[size - 1] = 1;
+        }
+        std::cout << description << ": "
+                  << duration_cast<microseconds>(steady_clock::now() - start).count() / cycles
+                  << " micro sec per cycle" << std::endl;
+    };
+    measure("heap", [&](MemoryBuffer& buffer) { return buffer.allocate(size); });
+    MemoryBufferPool pool;
+    measure("pool", [&](MemoryBuffer& buffer) { return buffer.allocate(size, pool); });
+    MemoryBufferPool huge_page_pool(MemoryBufferPool::default_alignment, HugePages::transparent);
+    measure("pool with transparent huge pages",
+            [&](MemoryBuffer& buffer) { return buffer.allocate(size, huge_page_pool); });
+}
@@ -14,7 +14,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cstddef>
+#include <iostream>
 
 constexpr uint32_t success = 0;
 
@@ -242,3 +244,138 @@ TEST(process_test, TestExecute_And_Wait_with_stdout_std_error_return_neg)
     }
     teardown_test();
 }
+
+#ifndef _WIN32
+TEST(process_test, TestExecute_Arguments)
+{
+    // the arguments are passed without shell expansion
+    auto result = a_util::process::execute("printf", {"%s|", "a b", "*", "$HOME", "'\"quoted\"'"});
+    ASSERT_TRUE(result.started);
+    EXPECT_FALSE(result.timed_out);
+    EXPECT_EQ(result.exit_code, success);
+    EXPECT_EQ(result.std_out, "a b|*|$HOME|'\"quoted\"'|");
+    EXPECT_TRUE(result.std_err.empty());
+
+    result = a_util::process::execute("sh", {"-c", "printf out; printf err >&2; exit 3"});
+    ASSERT_TRUE(result.started);
+    EXPECT_EQ(result.exit_code, 3u);
+    EXPECT_EQ(result.std_out, "out");
+    EXPECT_EQ(result.std_err, "err");
+
+    // negative exit codes are sign extended
+    result = a_util::process::execute("sh", {"-c", "exit 255"});
+    EXPECT_EQ(result.exit_code, static_cast<uint32_t>(-1));
+
+    // both pipes are read while the application runs, so large output does not block it
+    result = a_util::process::execute(
+        "sh", {"-c", "head -c 1000000 /dev/zero >&2; head -c 1000000 /dev/zero"});
+    EXPECT_EQ(result.exit_code, success);
+    EXPECT_EQ(result.std_out.size(), 1000000u);
+    EXPECT_EQ(result.std_err.size(), 1000000u);
+
+    result = a_util::process::execute("this_does_not_exist", {});
+    EXPECT_FALSE(result.started);
+}
+
+TEST(process_test, TestExecute_Arguments_WorkingDir)
+{
+    a_util::process::ExecuteOptions options;
+    options.working_dir = a_util::filesystem::getTempDirectory();
+    auto result = a_util::process::execute("pwd", {"-P"}, options);
+    ASSERT_TRUE(result.started);
+    EXPECT_EQ(result.exit_code, success);
+    EXPECT_NE(result.std_out.find(options.working_dir.getLastElement().toString()),
+              std::string::npos);
+
+    options.working_dir = "this_does_not_exist";
+    result = a_util::process::execute("pwd", {}, options);
+    EXPECT_TRUE(!result.started || result.exit_code != success);
+    EXPECT_TRUE(result.std_out.empty());
+}
+
+TEST(process_test, TestExecute_Arguments_Callbacks)
+{
+    std::string std_out;
+    std::string std_err;
+    size_t std_out_chunks = 0;
+    a_util::process::ExecuteOptions options;
+    options.on_std_out = [&](const char* data, std::size_t size) {
+        std_out.append(data, size);
+        ++std_out_chunks;
+    };
+    options.on_std_err = [&](const char* data, std::size_t size) { std_err.append(data, size); };
+    const auto result = a_util::process::execute(
+        "sh", {"-c", "echo first; sleep 0.1; echo second; echo error >&2"}, options);
+    ASSERT_TRUE(result.started);
+    EXPECT_EQ(result.exit_code, success);
+    EXPECT_EQ(std_out, "first\nsecond\n");
+    EXPECT_EQ(std_out_chunks, 2u);
+    EXPECT_EQ(std_err, "error\n");
+    EXPECT_TRUE(result.std_out.empty());
+    EXPECT_TRUE(result.std_err.empty());
+}
+
+TEST(process_test, TestExecute_Arguments_Timeout)
+{
+    a_util::process::ExecuteOptions options;
+    options.timeout = 100000;
+    const auto start = std::chrono::steady_clock::now();
+    auto result = a_util::process::execute("sh", {"-c", "echo started; exec sleep 10"}, options);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    ASSERT_TRUE(result.started);
+    EXPECT_TRUE(result.timed_out);
+    EXPECT_EQ(result.std_out, "started\n");
+    // 128 + SIGKILL
+    EXPECT_EQ(result.exit_code, static_cast<uint32_t>(static_cast<int8_t>(128 + 9)));
+
+    result = a_util::process::execute("true", {}, options);
+    EXPECT_FALSE(result.timed_out);
+    EXPECT_EQ(result.exit_code, success);
+}
+
+TEST(process_test, TestExecute_Arguments_ChildHoldsPipes)
+{
+    // the background process inherits the pipes, the application exit must be noticed anyway
+    const auto start = std::chrono::steady_clock::now();
+    auto result = a_util::process::execute("sh", {"-c", "echo started; sleep 10 & exit 3"});
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    ASSERT_TRUE(result.started);
+    EXPECT_FALSE(result.timed_out);
+    EXPECT_EQ(result.exit_code, 3u);
+    EXPECT_EQ(result.std_out, "started\n");
+
+    // an application which exited before the timeout elapsed is not reported as timed out
+    a_util::process::ExecuteOptions options;
+    options.timeout = 500000;
+    result = a_util::process::execute("sh", {"-c", "sleep 10 & exit 0"}, options);
+    ASSERT_TRUE(result.started);
+    EXPECT_FALSE(result.timed_out);
+    EXPECT_EQ(result.exit_code, success);
+}
+
+/// Benchmark of process launches with a command line through the shell and with arguments
+TEST(process_test, TestExecute_Performance)
+{
+    using namespace std::chrono;
+    const size_t launch_count = 200;
+    auto start = steady_clock::now();
+    for (size_t launch = 0; launch < launch_count; ++launch) {
+        std::string std_out;
+        ASSERT_EQ(a_util::process::execute("true", "", "", std_out), success);
+    }
+    const auto duration_shell = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    for (size_t launch = 0; launch < launch_count; ++launch) {
+        ASSERT_EQ(a_util::process::execute("true", {}).exit_code, success);
+    }
+    const auto duration_arguments = steady_clock::now() - start;
+
+    std::cout << "Launches per second with a command line: "
+              << launch_count * 1000000 / duration_cast<microseconds>(duration_shell).count()
+              << std::endl
+              << "Launches per second with arguments: "
+              << launch_count * 1000000 / duration_cast<microseconds>(duration_arguments).count()
+              << std::endl;
+}
+#endif // _WIN32
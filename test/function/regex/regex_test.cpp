@@ -13,6 +13,12 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
 // Test ctors, cctor, assign op, Set/getPattern, getError
 TEST(regex_test, TestBasics)
 {
@@ -139,3 +145,104 @@ TEST(regex_test, TestDoMatch)
     EXPECT_TRUE(text_exp.match("a1234-test-4321a", RegularExpression::AT_Unanchored, consumed));
     EXPECT_EQ(consumed, 15);
 }
+
+// Test that the automaton matches like std::regex
+TEST(regex_test, TestAutomatonFullMatch)
+{
+    using a_util::regex::RegularExpression;
+
+    const std::vector<std::string> patterns{
+        "abc",          "a.c",           "^a*b+c?$",       "(ab|cd)*",       "(?:ab|a)(bc|c)",
+        "[a-c]+x",      "[^a-c]+",       "[-a]b[a-]",      "a{2}",           "a{1,3}b{2,}",
+        "(a|b){0,2}c",  "\\d+\\.\\d*",   "\\w+_\\W\\s\\S", "[\\d_]+[^\\D]",  "a\\*\\(\\)\\[",
+        "x*?y+?z??",    "(a*)*b",        "()a",            "a|",             "[.]\\.[\\]\\\\]",
+        "Signal_[0-9]+\\.(speed|accel)_[xyz]",             "[A-Z][a-z]*",    ".*[^\\n]"};
+    const std::vector<std::string> texts{
+        "",      "a",      "abc",     "aac",    "abbc",  "ABC",     "cdab",   "abcd",
+        "abc",   "ac",     "dx",      "abcx",   "defg",  "-b-",     "ab-",    "aa",
+        "aaa",   "abb",    "aaabbb",  "c",      "abc",   "bac",     "12.",    "12.34",
+        "1x2",   "a_! x",  "ab_  x",  "_1",     "a*()[", "xyz",     "yy",     "xxyz",
+        "aab",   "b",      ".\\.]",   "..\\",   ".x\\",  "Signal_12.speed_x", "Signal_.speed_x",
+        "Signal_1.accel_z",        "signal_1.accel_z", "Hello", "hELLO", "h\n", "\n"};
+
+    for (const bool case_sensitive: {true, false}) {
+        for (const auto& pattern: patterns) {
+            RegularExpression re;
+            ASSERT_TRUE(re.setPattern(pattern, case_sensitive)) << pattern;
+            EXPECT_TRUE(re.isAutomatonUsed()) << pattern;
+            const std::regex reference(pattern,
+                                       case_sensitive ? std::regex::ECMAScript :
+                                                        std::regex::ECMAScript | std::regex::icase);
+            for (const auto& text: texts) {
+                EXPECT_EQ(re.fullMatch(text), std::regex_match(text, reference))
+                    << "pattern: " << pattern << ", text: " << text
+                    << ", case sensitive: " << case_sensitive;
+            }
+        }
+    }
+
+    // patterns beyond the supported subset are matched by std::regex
+    for (const std::string pattern: {"(a)\\1", "a(?=b)b", "\\bab", "[[:alpha:]]+", "a^b", "a$b"}) {
+        RegularExpression re(pattern);
+        EXPECT_EQ(re.getError(), "") << pattern;
+        EXPECT_FALSE(re.isAutomatonUsed()) << pattern;
+    }
+    EXPECT_TRUE(RegularExpression("(a)\\1").fullMatch("aa"));
+    EXPECT_FALSE(RegularExpression("(a)\\1").fullMatch("ab"));
+    EXPECT_TRUE(RegularExpression("[[:alpha:]]+").fullMatch("abc"));
+    EXPECT_FALSE(RegularExpression().isAutomatonUsed());
+    EXPECT_TRUE(RegularExpression(RegularExpression("a+")).isAutomatonUsed());
+}
+
+// Test filter
+TEST(regex_test, TestFilter)
+{
+    using a_util::regex::RegularExpression;
+
+    const std::vector<std::string> names{"speed", "accel_x", "accel_y", "Accel_z", "accel"};
+    EXPECT_EQ(RegularExpression("accel_.").filter(names),
+              std::vector<std::string>({"accel_x", "accel_y"}));
+    EXPECT_EQ(RegularExpression("accel_.", false).filter(names),
+              std::vector<std::string>({"accel_x", "accel_y", "Accel_z"}));
+    // std::regex
+    EXPECT_EQ(RegularExpression("a(c)\\1el_.").filter(names),
+              std::vector<std::string>({"accel_x", "accel_y"}));
+    EXPECT_TRUE(RegularExpression().filter(names).empty());
+}
+
+// Benchmark of filtering signal names with the automaton and with std::regex
+TEST(regex_test, TestFilterPerformance)
+{
+    using namespace std::chrono;
+    using a_util::regex::RegularExpression;
+
+    std::vector<std::string> names;
+    for (size_t index = 0; index < 50000; ++index) {
+        names.push_back("Vehicle.Chassis.Axle_" + std::to_string(index % 4) + ".Wheel_" +
+                        std::to_string(index) + (index % 3 ? ".Speed" : ".Acceleration"));
+    }
+    const std::string pattern = "Vehicle\\.Chassis\\.Axle_[0-3]\\.Wheel_[0-9]*7\\.(Speed|Accel)";
+    const RegularExpression re(pattern);
+    ASSERT_TRUE(re.isAutomatonUsed());
+
+    auto start = steady_clock::now();
+    const auto matching_names = re.filter(names);
+    const auto duration_automaton = steady_clock::now() - start;
+
+    const std::regex reference(pattern);
+    std::vector<std::string> reference_names;
+    start = steady_clock::now();
+    for (const auto& name: names) {
+        if (std::regex_match(name, reference)) {
+            reference_names.push_back(name);
+        }
+    }
+    const auto duration_std_regex = steady_clock::now() - start;
+
+    EXPECT_EQ(matching_names, reference_names);
+    std::cout << "Filtering " << names.size() << " names:" << std::endl
+              << "    automaton: " << duration_cast<microseconds>(duration_automaton).count()
+              << " micro sec" << std::endl
+              << "    std::regex: " << duration_cast<microseconds>(duration_std_regex).count()
+              << " micro sec" << std::endl;
+}
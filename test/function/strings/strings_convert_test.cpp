@@ -10,9 +10,18 @@
  */
 
 #include <a_util/strings/strings_convert.h>
+#include <a_util/strings/strings_format.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <clocale>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
 using namespace a_util;
 
 #if defined(__GNUC__) && (__GNUC__ == 5) && defined(__QNX__)
@@ -383,6 +392,138 @@ TEST(string_convert_test, TestStringToDouble)
     EXPECT_DOUBLE_EQ(0, strings::toDouble(str_ltm));
 }
 
+TEST(string_convert_test, TestStringToDoubleEqualsStrtod)
+{
+    // converted the same way with and without std::from_chars
+    const char* const strings_to_convert[] = {"0.1",
+                                              "-2.5e-3",
+                                              "1E10",
+                                              ".5",
+                                              "5.",
+                                              "1e-400",
+                                              "4.9406564584124654e-324",
+                                              "2.2250738585072011e-308",
+                                              "9007199254740993",
+                                              " 42",
+                                              "0x10",
+                                              "nan"};
+    for (const char* const str: strings_to_convert) {
+        double value = 0.0;
+        ASSERT_TRUE(strings::toDouble(str, value)) << str;
+        const double expected = std::strtod(str, nullptr);
+        if (expected == expected) {
+            EXPECT_EQ(expected, value) << str;
+        }
+        else {
+            EXPECT_NE(value, value) << str;
+        }
+    }
+
+    double value = 1.0;
+    EXPECT_FALSE(strings::toDouble("1e400", value));
+    EXPECT_FALSE(strings::toDouble("inf", value));
+    EXPECT_FALSE(strings::toDouble("1.0 ", value));
+    EXPECT_EQ(1.0, value);
+}
+
+// Conversions of floating point values use the decimal point of the C locale like strtod and "%f"
+TEST(string_convert_test, TestFloatingPointConversionUsesDecimalPointOfLocale)
+{
+    const std::string previous_locale = std::setlocale(LC_NUMERIC, nullptr);
+    const char* const locales_with_decimal_comma[] = {
+        "de_DE.UTF-8", "de_DE.utf8", "de_DE", "German_Germany.1252"};
+    const char* locale = nullptr;
+    for (const char* const current_locale: locales_with_decimal_comma) {
+        locale = std::setlocale(LC_NUMERIC, current_locale);
+        if (locale && std::localeconv()->decimal_point == std::string(",")) {
+            break;
+        }
+        locale = nullptr;
+    }
+    if (!locale) {
+        std::setlocale(LC_NUMERIC, previous_locale.c_str());
+        GTEST_SKIP() << "no locale with the decimal point ',' installed";
+    }
+
+    EXPECT_EQ("1,500000", strings::toString(1.5));
+    EXPECT_EQ("-2,500000", strings::toString(-2.5f));
+    EXPECT_EQ(strings::format("%f", 123456.7890125), strings::toString(123456.7890125));
+    char buffer[32];
+    char* const end = strings::toChars(buffer, buffer + sizeof(buffer), 0.25);
+    ASSERT_NE(nullptr, end);
+    EXPECT_EQ("0,250000", std::string(buffer, end));
+    EXPECT_EQ("0,1", strings::toRoundTripString(0.1));
+    EXPECT_EQ(0.1, strings::toDouble(strings::toRoundTripString(0.1)));
+
+    double value = 0.0;
+    EXPECT_TRUE(strings::toDouble("1,5", value));
+    EXPECT_EQ(1.5, value);
+    EXPECT_FALSE(strings::toDouble("2.5", value));
+    EXPECT_EQ(1.5, value);
+    float float_value = 0.0f;
+    EXPECT_TRUE(strings::toFloat("-0,25", float_value));
+    EXPECT_EQ(-0.25f, float_value);
+    // integers do not depend on the locale
+    std::int32_t int_value = 0;
+    EXPECT_TRUE(strings::toInt32("-1234", int_value));
+    EXPECT_EQ(-1234, int_value);
+    EXPECT_EQ("1234", strings::toString(std::int32_t(1234)));
+
+    std::setlocale(LC_NUMERIC, previous_locale.c_str());
+    EXPECT_EQ("1.500000", strings::toString(1.5));
+    EXPECT_TRUE(strings::toDouble("2.5", value));
+    EXPECT_EQ(2.5, value);
+}
+
+TEST(string_convert_test, TestStringToNumericPerformance)
+{
+    using namespace std::chrono;
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    std::vector<std::string> doubles;
+    std::vector<std::string> integers;
+    for (int count = 0; count < 100000; ++count) {
+        const double value = distribution(generator);
+        doubles.push_back(strings::toRoundTripString(value));
+        integers.push_back(strings::toString(static_cast<std::int64_t>(value)));
+    }
+
+    double sum = 0.0;
+    const auto start_strtod = steady_clock::now();
+    for (const auto& str: doubles) {
+        sum += std::strtod(str.c_str(), nullptr);
+    }
+    const auto duration_strtod = steady_clock::now() - start_strtod;
+
+    const auto start_to_double = steady_clock::now();
+    for (const auto& str: doubles) {
+        sum += strings::toDouble(str);
+    }
+    const auto duration_to_double = steady_clock::now() - start_to_double;
+
+    const auto start_strtoll = steady_clock::now();
+    for (const auto& str: integers) {
+        sum += static_cast<double>(std::strtoll(str.c_str(), nullptr, 10));
+    }
+    const auto duration_strtoll = steady_clock::now() - start_strtoll;
+
+    const auto start_to_int64 = steady_clock::now();
+    for (const auto& str: integers) {
+        sum += static_cast<double>(strings::toInt64(str));
+    }
+    const auto duration_to_int64 = steady_clock::now() - start_to_int64;
+
+    const auto to_ns = [&doubles](steady_clock::duration duration) {
+        return duration_cast<nanoseconds>(duration).count() /
+               static_cast<steady_clock::rep>(doubles.size());
+    };
+    std::cout << "double with strtod(): " << to_ns(duration_strtod) << " ns" << std::endl
+              << "double with toDouble(): " << to_ns(duration_to_double) << " ns" << std::endl
+              << "int64 with strtoll(): " << to_ns(duration_strtoll) << " ns" << std::endl
+              << "int64 with toInt64(): " << to_ns(duration_to_int64) << " ns" << std::endl;
+    EXPECT_EQ(sum, sum);
+}
+
 #if defined(__GNUC__) && (__GNUC__ == 5) && defined(__QNX__)
 #pragma GCC diagnostic warning                                                                     \
     "-Wattributes" // standard type attributes are ignored when used in templates
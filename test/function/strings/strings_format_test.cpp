@@ -14,6 +14,15 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+
 using namespace a_util;
 
 template <typename T>
@@ -27,6 +36,40 @@ void test_integral_to_string_with_numeric_limits()
     EXPECT_EQ(numeric_min, strings::toNumeric<T>(str_numeric_min));
 }
 
+template <typename T>
+void test_to_chars_equals_format(const char* specifier)
+{
+    const T values[] = {std::numeric_limits<T>::lowest(),
+                        static_cast<T>(std::numeric_limits<T>::lowest() + 1),
+                        static_cast<T>(-100),
+                        static_cast<T>(-99),
+                        static_cast<T>(-10),
+                        static_cast<T>(-9),
+                        static_cast<T>(-1),
+                        static_cast<T>(0),
+                        static_cast<T>(1),
+                        static_cast<T>(9),
+                        static_cast<T>(10),
+                        static_cast<T>(99),
+                        static_cast<T>(100),
+                        static_cast<T>(12345),
+                        static_cast<T>(std::numeric_limits<T>::max() - 1),
+                        std::numeric_limits<T>::max()};
+    for (const T value: values) {
+        const std::string expected = strings::format(specifier, value);
+        EXPECT_EQ(expected, strings::toString(value));
+
+        char buffer[32];
+        char* const end = strings::toChars(buffer, buffer + sizeof(buffer), value);
+        ASSERT_NE(nullptr, end);
+        EXPECT_EQ(expected, std::string(buffer, end));
+        // too small buffers are not written behind their end
+        EXPECT_EQ(nullptr, strings::toChars(buffer, buffer + expected.size() - 1, value));
+        EXPECT_EQ(buffer + expected.size(),
+                  strings::toChars(buffer, buffer + expected.size(), value));
+    }
+}
+
 static const std::string str_127(
     " This string consists of %d chars which is exactly the maximum size needed to not perform a \
 reallocation in format() function.");
@@ -186,3 +229,139 @@ TEST(string_format_test, TestBoolToString)
     EXPECT_EQ("true", strings::toString(bool(1)));
     EXPECT_EQ("true", strings::toString(bool(-1)));
 }
+
+TEST(string_format_test, TestIntegralToCharsEqualsFormat)
+{
+    test_to_chars_equals_format<std::int8_t>("%d");
+    test_to_chars_equals_format<std::int16_t>("%hd");
+    test_to_chars_equals_format<std::int32_t>("%d");
+    test_to_chars_equals_format<std::int64_t>("%lld");
+    test_to_chars_equals_format<std::uint8_t>("%u");
+    test_to_chars_equals_format<std::uint16_t>("%u");
+    test_to_chars_equals_format<std::uint32_t>("%u");
+    test_to_chars_equals_format<std::uint64_t>("%llu");
+}
+
+TEST(string_format_test, TestFloatingPointToCharsEqualsFormat)
+{
+    const double values[] = {0.0,
+                             -0.0,
+                             0.1,
+                             -2.5,
+                             0.0000005,
+                             0.0000015,
+                             123456.7890125,
+                             1e20,
+                             std::numeric_limits<double>::min(),
+                             std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::lowest()};
+    for (const double value: values) {
+        EXPECT_EQ(strings::format("%f", value), strings::toString(value));
+        const float float_value = static_cast<float>(value);
+        EXPECT_EQ(strings::format("%f", static_cast<double>(float_value)),
+                  strings::toString(float_value));
+
+        const std::string expected = strings::format("%f", value);
+        char buffer[400];
+        char* const end = strings::toChars(buffer, buffer + sizeof(buffer), value);
+        ASSERT_NE(nullptr, end);
+        EXPECT_EQ(expected, std::string(buffer, end));
+        EXPECT_EQ(nullptr, strings::toChars(buffer, buffer + expected.size() - 1, value));
+    }
+
+    char buffer[5];
+    EXPECT_EQ(buffer + 4, strings::toChars(buffer, buffer + sizeof(buffer), true));
+    EXPECT_EQ("true", std::string(buffer, 4));
+    EXPECT_EQ(nullptr, strings::toChars(buffer, buffer + 4, false));
+}
+
+TEST(string_format_test, TestRoundTripString)
+{
+    EXPECT_EQ("0.1", strings::toRoundTripString(0.1));
+    EXPECT_EQ("0.1", strings::toRoundTripString(0.1f));
+    EXPECT_EQ("-2.5", strings::toRoundTripString(-2.5));
+    EXPECT_EQ("0", strings::toRoundTripString(0.0));
+
+    std::mt19937_64 generator(42);
+    for (int count = 0; count < 10000; ++count) {
+        const std::uint64_t bits = generator();
+        double double_value;
+        std::memcpy(&double_value, &bits, sizeof(double_value));
+        float float_value;
+        std::memcpy(&float_value, &bits, sizeof(float_value));
+        if (std::isfinite(double_value)) {
+            const std::string str_double = strings::toRoundTripString(double_value);
+            EXPECT_EQ(double_value, strings::toDouble(str_double)) << str_double;
+        }
+        if (std::isfinite(float_value)) {
+            const std::string str_float = strings::toRoundTripString(float_value);
+            EXPECT_EQ(float_value, static_cast<float>(std::strtod(str_float.c_str(), nullptr)))
+                << str_float;
+        }
+    }
+
+    char buffer[32];
+    char* const end = strings::toRoundTripChars(buffer, buffer + sizeof(buffer), 1.25);
+    ASSERT_NE(nullptr, end);
+    EXPECT_EQ("1.25", std::string(buffer, end));
+    EXPECT_EQ(nullptr, strings::toRoundTripChars(buffer, buffer + 3, 1.25));
+}
+
+TEST(string_format_test, TestNumericToStringPerformance)
+{
+    using namespace std::chrono;
+    const int count = 200000;
+    std::size_t size = 0;
+
+    const auto start_format_int = steady_clock::now();
+    for (int value = 0; value < count; ++value) {
+        size += strings::format(12, "%d", value * 7919).size();
+    }
+    const auto duration_format_int = steady_clock::now() - start_format_int;
+
+    const auto start_to_string_int = steady_clock::now();
+    for (int value = 0; value < count; ++value) {
+        size += strings::toString(value * 7919).size();
+    }
+    const auto duration_to_string_int = steady_clock::now() - start_to_string_int;
+
+    char buffer[400];
+    const auto start_to_chars_int = steady_clock::now();
+    for (int value = 0; value < count; ++value) {
+        size += strings::toChars(buffer, buffer + sizeof(buffer), value * 7919) - buffer;
+    }
+    const auto duration_to_chars_int = steady_clock::now() - start_to_chars_int;
+
+    const auto start_format_double = steady_clock::now();
+    for (int value = 0; value < count; ++value) {
+        size += strings::format("%f", value * 0.7919).size();
+    }
+    const auto duration_format_double = steady_clock::now() - start_format_double;
+
+    const auto start_to_chars_double = steady_clock::now();
+    for (int value = 0; value < count; ++value) {
+        size += strings::toChars(buffer, buffer + sizeof(buffer), value * 0.7919) - buffer;
+    }
+    const auto duration_to_chars_double = steady_clock::now() - start_to_chars_double;
+
+    const auto start_round_trip_double = steady_clock::now();
+    for (int value = 0; value < count; ++value) {
+        size +=
+            strings::toRoundTripChars(buffer, buffer + sizeof(buffer), value * 0.7919) - buffer;
+    }
+    const auto duration_round_trip_double = steady_clock::now() - start_round_trip_double;
+
+    const auto to_ns = [count](steady_clock::duration duration) {
+        return duration_cast<nanoseconds>(duration).count() / count;
+    };
+    std::cout << "int32 with format(\"%d\"): " << to_ns(duration_format_int) << " ns" << std::endl
+              << "int32 with toString(): " << to_ns(duration_to_string_int) << " ns" << std::endl
+              << "int32 with toChars(): " << to_ns(duration_to_chars_int) << " ns" << std::endl
+              << "double with format(\"%f\"): " << to_ns(duration_format_double) << " ns"
+              << std::endl
+              << "double with toChars(): " << to_ns(duration_to_chars_double) << " ns"
+              << std::endl
+              << "double with toRoundTripChars(): " << to_ns(duration_round_trip_double) << " ns"
+              << std::endl;
+    EXPECT_GT(size, 0u);
+}
@@ -9,9 +9,25 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include <a_util/system/detail/chacha20.h>
 #include <a_util/system/uuid.h>
 
 #include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif // !_WIN32
+
 using namespace a_util;
 
 TEST(uuid_test, TestUUIDGeneration)
@@ -23,3 +39,167 @@ TEST(uuid_test, TestUUIDGeneration)
     EXPECT_EQ(uuid[18], '-');
     EXPECT_EQ(uuid[23], '-');
 }
+
+// Known answer tests of the generator with the test vectors of RFC 8439 (2.3.2 and A.1)
+TEST(uuid_test, TestChaCha20BlockFunction)
+{
+    using system::detail::chaCha20Block;
+    std::array<std::uint8_t, system::detail::chacha20_block_size> block;
+
+    const std::array<std::uint32_t, 8> key_rfc = {
+        {0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c,
+         0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c}};
+    chaCha20Block(key_rfc, 1, {{0x09000000, 0x4a000000, 0x00000000}}, block.data());
+    EXPECT_EQ(block,
+              (std::array<std::uint8_t, 64>{
+                  {0x10, 0xf1, 0xe7, 0xe4, 0xd1, 0x3b, 0x59, 0x15, 0x50, 0x0f, 0xdd, 0x1f, 0xa3,
+                   0x20, 0x71, 0xc4, 0xc7, 0xd1, 0xf4, 0xc7, 0x33, 0xc0, 0x68, 0x03, 0x04, 0x22,
+                   0xaa, 0x9a, 0xc3, 0xd4, 0x6c, 0x4e, 0xd2, 0x82, 0x64, 0x46, 0x07, 0x9f, 0xaa,
+                   0x09, 0x14, 0xc2, 0xd7, 0x05, 0xd9, 0x8b, 0x02, 0xa2, 0xb5, 0x12, 0x9c, 0xd1,
+                   0xde, 0x16, 0x4e, 0xb9, 0xcb, 0xd0, 0x83, 0xe8, 0xa2, 0x50, 0x3c, 0x4e}}));
+
+    const std::array<std::uint32_t, 8> key_zero = {};
+    chaCha20Block(key_zero, 0, {{0, 0, 0}}, block.data());
+    EXPECT_EQ(block,
+              (std::array<std::uint8_t, 64>{
+                  {0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53,
+                   0x86, 0xbd, 0x28, 0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a, 0xa8, 0x36,
+                   0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7, 0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48,
+                   0x8d, 0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37, 0x6a, 0x43, 0xb8, 0xf4,
+                   0x15, 0x18, 0xa1, 0x1c, 0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86}}));
+
+    chaCha20Block(key_zero, 1, {{0, 0, 0}}, block.data());
+    EXPECT_EQ(block,
+              (std::array<std::uint8_t, 64>{
+                  {0x9f, 0x07, 0xe7, 0xbe, 0x55, 0x51, 0x38, 0x7a, 0x98, 0xba, 0x97, 0x7c, 0x73,
+                   0x2d, 0x08, 0x0d, 0xcb, 0x0f, 0x29, 0xa0, 0x48, 0xe3, 0x65, 0x69, 0x12, 0xc6,
+                   0x53, 0x3e, 0x32, 0xee, 0x7a, 0xed, 0x29, 0xb7, 0x21, 0x76, 0x9c, 0xe6, 0x4e,
+                   0x43, 0xd5, 0x71, 0x33, 0xb0, 0x74, 0xd8, 0x39, 0xd5, 0x31, 0xed, 0x1f, 0x28,
+                   0x51, 0x0a, 0xfb, 0x45, 0xac, 0xe1, 0x0a, 0x1f, 0x4b, 0x79, 0x4d, 0x6f}}));
+}
+
+TEST(uuid_test, TestBinaryUUID)
+{
+    const system::Uuid nil;
+    EXPECT_TRUE(nil.isNil());
+    EXPECT_EQ(nil.toString(), "00000000-0000-0000-0000-000000000000");
+
+    const system::Uuid known({0x6b, 0xa7, 0xb8, 0x10, 0x9d, 0xad, 0x11, 0xd1,
+                              0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8});
+    EXPECT_FALSE(known.isNil());
+    EXPECT_EQ(known.toString(), "6ba7b810-9dad-11d1-80b4-00c04fd430c8");
+    char buffer[system::Uuid::string_length + 1] = {};
+    known.format(buffer);
+    EXPECT_EQ(std::string(buffer), known.toString());
+    EXPECT_EQ(known, system::Uuid(known.getBytes()));
+    EXPECT_NE(known, nil);
+    EXPECT_TRUE(nil < known);
+    EXPECT_EQ(std::hash<system::Uuid>()(known), known.getHash());
+
+    const system::Uuid uuid = system::generateBinaryUUIDv4();
+    const std::string text = uuid.toString();
+    ASSERT_EQ(text.size(), 36U);
+    EXPECT_EQ(text[14], '4');
+    EXPECT_NE(std::string("89ab").find(text[19]), std::string::npos);
+    EXPECT_TRUE(std::all_of(text.begin(), text.end(), [](char character) {
+        return character == '-' || std::isxdigit(static_cast<unsigned char>(character));
+    }));
+    EXPECT_EQ(uuid.getBytes()[6] >> 4, 4);
+    EXPECT_EQ(uuid.getBytes()[8] >> 6, 2);
+}
+
+TEST(uuid_test, TestUniqueAcrossThreads)
+{
+    const std::size_t count = 20000;
+    std::vector<std::vector<system::Uuid>> generated(4);
+    std::vector<std::thread> threads;
+    for (auto& uuids: generated) {
+        threads.emplace_back([&uuids, count]() {
+            for (std::size_t index = 0; index < count; ++index) {
+                uuids.push_back(system::generateBinaryUUIDv4());
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+
+    std::unordered_set<system::Uuid> unique;
+    std::unordered_set<std::size_t> hashes;
+    for (const auto& uuids: generated) {
+        for (const auto& uuid: uuids) {
+            EXPECT_TRUE(unique.insert(uuid).second);
+            hashes.insert(uuid.getHash());
+        }
+    }
+    EXPECT_EQ(unique.size(), generated.size() * count);
+    EXPECT_GT(hashes.size(), unique.size() - 10);
+}
+
+#ifndef _WIN32
+TEST(uuid_test, TestUniqueAfterFork)
+{
+    // the child process must not continue with the generator state of the parent
+    system::generateBinaryUUIDv4();
+    int pipe_ends[2];
+    ASSERT_EQ(::pipe(pipe_ends), 0);
+    const pid_t child = ::fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        const system::Uuid uuid = system::generateBinaryUUIDv4();
+        const auto written = ::write(pipe_ends[1], uuid.getBytes().data(), uuid.getBytes().size());
+        ::_exit(written == static_cast<ssize_t>(uuid.getBytes().size()) ? 0 : 1);
+    }
+
+    const system::Uuid uuid = system::generateBinaryUUIDv4();
+    system::Uuid::Bytes child_bytes;
+    EXPECT_EQ(::read(pipe_ends[0], child_bytes.data(), child_bytes.size()),
+              static_cast<ssize_t>(child_bytes.size()));
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    ::close(pipe_ends[0]);
+    ::close(pipe_ends[1]);
+    EXPECT_NE(system::Uuid(child_bytes), uuid);
+}
+#endif // !_WIN32
+
+/// Benchmark of generating UUIDs from several threads
+TEST(uuid_test, TestGenerationThroughputPerformance)
+{
+    using namespace std::chrono;
+    const std::size_t count = 200000;
+    const auto measure = [&](const char* description, std::size_t thread_count, auto generate) {
+        const auto start = steady_clock::now();
+        std::vector<std::thread> threads;
+        for (std::size_t thread = 0; thread < thread_count; ++thread) {
+            threads.emplace_back([&]() {
+                for (std::size_t index = 0; index < count; ++index) {
+                    generate();
+                }
+            });
+        }
+        for (auto& thread: threads) {
+            thread.join();
+        }
+        const auto duration = duration_cast<microseconds>(steady_clock::now() - start).count();
+        std::cout << description << " with " << thread_count << " threads: "
+                  << count * thread_count / static_cast<std::size_t>(std::max<long long>(
+                                                                 duration, 1))
+                  << " UUIDs per micro sec" << std::endl;
+    };
+
+    for (const std::size_t thread_count: {1, 4}) {
+        measure("generateBinaryUUIDv4", thread_count, []() {
+            const system::Uuid uuid = system::generateBinaryUUIDv4();
+            ASSERT_FALSE(uuid.isNil());
+        });
+        measure("generateBinaryUUIDv4 and format", thread_count, []() {
+            char buffer[system::Uuid::string_length];
+            system::generateBinaryUUIDv4().format(buffer);
+            ASSERT_EQ(buffer[8], '-');
+        });
+        measure("generateUUIDv4", thread_count, []() {
+            ASSERT_EQ(system::generateUUIDv4().size(), 36U);
+        });
+    }
+}
@@ -0,0 +1,335 @@
+/**
+ * @file
+ * XML test_query implementation
+ *
+ * Copyright @ 2024 VW Group. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include <a_util/filesystem.h>
+#include <a_util/xml.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+using namespace a_util;
+
+/**
+ * Creates a large configuration like XML file with @c group_count groups of 100 signals each.
+ */
+std::string createLargeXMLFile(const std::size_t group_count)
+{
+    std::string xml = "<?xml version=\"1.0\"?>\n<config>\n";
+    for (std::size_t group_idx = 0; group_idx < group_count; ++group_idx) {
+        xml += "  <group name=\"group_" + std::to_string(group_idx) + "\">\n";
+        for (std::size_t signal_idx = 0; signal_idx < 100; ++signal_idx) {
+            xml += "    <signal name=\"signal_" + std::to_string(signal_idx) + "\" type=\"" +
+                   (signal_idx % 2 ? "tUInt32" : "tFloat64") +
+                   "\"><source>source_" + std::to_string(signal_idx) +
+                   "</source><unit>m</unit></signal>\n";
+        }
+        xml += "  </group>\n";
+    }
+    xml += "</config>\n";
+
+    const std::string file_path = TEST_FILES_WRITE_DIR "/test_query_large.xml";
+    EXPECT_EQ(filesystem::writeTextFile(file_path, xml), filesystem::OK);
+    return file_path;
+}
+
+/**
+ * Returns the best duration of 5 calls of @c function.
+ */
+template <typename Function>
+std::chrono::nanoseconds measure(Function function)
+{
+    auto best_duration = std::chrono::nanoseconds::max();
+    for (int loop = 0; loop < 5; ++loop) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        best_duration = std::min<std::chrono::nanoseconds>(
+            best_duration, std::chrono::steady_clock::now() - start);
+    }
+    return best_duration;
+}
+
+} // namespace
+
+// Test the precompiled query
+TEST(xml_test_query, TestDOMQuery)
+{
+    using xml::DOM;
+    using xml::DOMElement;
+    using xml::DOMElementList;
+    using xml::DOMQuery;
+
+    const DOMQuery invalid_query;
+    EXPECT_FALSE(invalid_query.isValid());
+    EXPECT_TRUE(invalid_query.getQuery().empty());
+    EXPECT_TRUE(invalid_query.getLastError().empty());
+
+    const DOMQuery syntax_error("level_1[");
+    EXPECT_FALSE(syntax_error.isValid());
+    EXPECT_EQ(syntax_error.getQuery(), "level_1[");
+    EXPECT_FALSE(syntax_error.getLastError().empty());
+
+    DOM dom;
+    ASSERT_TRUE(dom.load(TEST_FILES_DIR "/test.xml"));
+    DOM dom_copy(dom);
+
+    const DOMQuery query_level_2("level_1/level_2[@name='beta']");
+    ASSERT_TRUE(query_level_2.isValid());
+    EXPECT_EQ(query_level_2.getQuery(), "level_1/level_2[@name='beta']");
+    EXPECT_TRUE(query_level_2.getLastError().empty());
+
+    // the same query can be used for different documents and gives the same result as the string
+    for (const auto& document: {&dom, &dom_copy}) {
+        DOMElement element, element_expected;
+        EXPECT_TRUE(document->findNode(query_level_2, element));
+        EXPECT_TRUE(document->findNode("level_1/level_2[@name='beta']", element_expected));
+        EXPECT_EQ(element.getPath(), element_expected.getPath());
+        EXPECT_EQ(element.getAttribute("id"), "2");
+
+        DOMElementList elements, elements_expected;
+        EXPECT_TRUE(document->findNodes(query_level_2, elements));
+        EXPECT_TRUE(document->findNodes("level_1/level_2[@name='beta']", elements_expected));
+        ASSERT_EQ(elements.size(), elements_expected.size());
+        EXPECT_EQ(elements.front().getPath(), elements_expected.front().getPath());
+    }
+
+    // relative to an element
+    DOMElement level_1;
+    ASSERT_TRUE(dom.findNode(DOMQuery("level_1"), level_1));
+    DOMElementList children;
+    EXPECT_TRUE(level_1.findNodes(DOMQuery("level_2"), children));
+    EXPECT_EQ(children.size(), 3U);
+
+    // not found or invalid
+    DOMElement not_found = level_1;
+    EXPECT_FALSE(dom.findNode(DOMQuery("not_existing"), not_found));
+    EXPECT_TRUE(not_found.isNull());
+    EXPECT_FALSE(dom.findNode(invalid_query, not_found));
+    EXPECT_FALSE(dom.findNode(syntax_error, not_found));
+    EXPECT_FALSE(dom.findNode("level_1[", not_found));
+    EXPECT_FALSE(dom.findNodes(syntax_error, children));
+    EXPECT_TRUE(children.empty());
+    // valid XPath, but no node set
+    EXPECT_TRUE(DOMQuery("1 + 1").isValid());
+    EXPECT_FALSE(dom.findNode(DOMQuery("1 + 1"), not_found));
+    EXPECT_FALSE(dom.findNodes("1 + 1", children));
+
+    // found elements belong to the document
+    DOMElement found;
+    ASSERT_TRUE(dom.findNode(query_level_2, found));
+    EXPECT_EQ(found.getDocument(), dom);
+}
+
+// Test the query string cache of the DOM
+TEST(xml_test_query, TestDOMQueryCache)
+{
+    using xml::DOM;
+    using xml::DOMElement;
+    using xml::DOMElementList;
+
+    DOM dom;
+    ASSERT_TRUE(dom.load(TEST_FILES_DIR "/test.xml"));
+
+    // use more different queries than cached to check the eviction
+    for (int loop = 0; loop < 3; ++loop) {
+        for (int id = 0; id < 100; ++id) {
+            DOMElementList elements;
+            const std::string query = "//*[@id='" + std::to_string(id) + "']";
+            EXPECT_EQ(dom.findNodes(query, elements), id >= 1 && id <= 3) << query;
+            EXPECT_FALSE(dom.findNodes(query + "[", elements));
+        }
+    }
+
+    // the cache is not shared with a copy and still valid after reset
+    DOM dom_copy(dom);
+    DOMElement element;
+    EXPECT_TRUE(dom_copy.findNode("level_1/level_2", element));
+    dom.reset();
+    EXPECT_FALSE(dom.findNode("level_1/level_2", element));
+    ASSERT_TRUE(dom.load(TEST_FILES_DIR "/test.xml"));
+    EXPECT_TRUE(dom.findNode("level_1/level_2", element));
+
+    // concurrent use of the cache
+    std::vector<std::thread> threads;
+    for (int thread_idx = 0; thread_idx < 4; ++thread_idx) {
+        threads.emplace_back([&dom, thread_idx]() {
+            for (int id = 0; id < 200; ++id) {
+                DOMElementList elements;
+                const std::string query =
+                    "//level_2[@id='" + std::to_string((id + thread_idx) % 70) + "']";
+                EXPECT_EQ(dom.findNodes(query, elements), (id + thread_idx) % 70 == 1 ||
+                                                              (id + thread_idx) % 70 == 2 ||
+                                                              (id + thread_idx) % 70 == 3);
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+}
+
+// Test the lightweight element handle
+TEST(xml_test_query, TestDOMElementHandle)
+{
+    using xml::DOM;
+    using xml::DOMElement;
+    using xml::DOMElementHandle;
+    using xml::DOMElementHandleList;
+    using xml::DOMQuery;
+
+    const DOMElementHandle null_handle;
+    EXPECT_TRUE(null_handle.isNull());
+    EXPECT_STREQ(null_handle.getName(), "");
+    EXPECT_STREQ(null_handle.getAttribute("id", "default"), "default");
+    EXPECT_TRUE(null_handle.getFirstChild().isNull());
+    EXPECT_TRUE(null_handle.toElement().isNull());
+
+    DOM dom;
+    ASSERT_TRUE(dom.fromString("<root attr=\"value\">text<a id=\"1\">data_a</a>text<b id=\"2\"/>"
+                               "<a id=\"3\"/></root>"));
+    const DOMElementHandle root(dom.getRoot());
+    EXPECT_FALSE(root.isNull());
+    EXPECT_STREQ(root.getName(), "root");
+    EXPECT_TRUE(root.hasAttribute("attr"));
+    EXPECT_FALSE(root.hasAttribute("id"));
+    EXPECT_STREQ(root.getAttribute("attr"), "value");
+    EXPECT_STREQ(root.getAttribute("id"), "");
+    EXPECT_TRUE(root.getParent().isNull());
+
+    // iterate over the elements, text nodes are skipped
+    std::string names;
+    for (auto child = root.getFirstChild(); !child.isNull(); child = child.getNextSibling()) {
+        names += child.getName();
+        names += child.getAttribute("id");
+        EXPECT_EQ(child.getParent(), root);
+    }
+    EXPECT_EQ(names, "a1b2a3");
+    EXPECT_STREQ(root.getChild("a").getData(), "data_a");
+    EXPECT_STREQ(root.getChild("b").getAttribute("id"), "2");
+    EXPECT_TRUE(root.getChild("c").isNull());
+
+    // find
+    DOMElementHandleList elements;
+    EXPECT_TRUE(root.findNodes(DOMQuery("a"), elements));
+    ASSERT_EQ(elements.size(), 2U);
+    EXPECT_STREQ(elements[1].getAttribute("id"), "3");
+    EXPECT_TRUE(dom.getRoot().findNodes(DOMQuery("*"), elements));
+    EXPECT_EQ(elements.size(), 3U);
+    EXPECT_FALSE(root.findNodes(DOMQuery("c"), elements));
+    EXPECT_TRUE(elements.empty());
+    EXPECT_FALSE(root.findNodes(DOMQuery("c["), elements));
+    DOMElementHandle found;
+    EXPECT_TRUE(root.findNode(DOMQuery("b"), found));
+    EXPECT_EQ(found, root.getChild("b"));
+    EXPECT_NE(found, root.getChild("a"));
+    EXPECT_FALSE(root.findNode(DOMQuery("c"), found));
+    EXPECT_TRUE(found.isNull());
+
+    // conversion
+    DOMElement element = root.getChild("a").toElement();
+    EXPECT_EQ(element.getName(), "a");
+    EXPECT_EQ(element.getData(), "data_a");
+    EXPECT_EQ(element.getDocument(), dom);
+    EXPECT_TRUE(element.setAttribute("id", "4"));
+    EXPECT_STREQ(root.getChild("a").getAttribute("id"), "4");
+    EXPECT_EQ(DOMElementHandle(element), root.getChild("a"));
+}
+
+// Benchmark of finding nodes in a large XML file like a configuration loader does
+TEST(xml_test_query, TestFindNodesPerformance)
+{
+    using xml::DOM;
+    using xml::DOMElement;
+    using xml::DOMElementHandle;
+    using xml::DOMElementHandleList;
+    using xml::DOMElementList;
+    using xml::DOMQuery;
+
+    DOM dom;
+    ASSERT_TRUE(dom.load(createLargeXMLFile(100)));
+
+    // the loader of each signal queries the same information, compiling each query per call was
+    // the behaviour before the queries were cached
+    std::size_t count_compiled = 0;
+    const auto duration_compiled = measure([&]() {
+        count_compiled = 0;
+        DOMElementList signals;
+        dom.findNodes(DOMQuery("group/signal"), signals);
+        for (const auto& signal: signals) {
+            DOMElement source;
+            if (signal.findNode(DOMQuery("source"), source) && !source.getData().empty() &&
+                signal.getAttribute("type") == "tUInt32") {
+                ++count_compiled;
+            }
+        }
+    });
+
+    std::size_t count_string = 0;
+    const auto duration_string = measure([&]() {
+        count_string = 0;
+        DOMElementList signals;
+        dom.findNodes("group/signal", signals);
+        for (const auto& signal: signals) {
+            DOMElement source;
+            if (signal.findNode("source", source) && !source.getData().empty() &&
+                signal.getAttribute("type") == "tUInt32") {
+                ++count_string;
+            }
+        }
+    });
+
+    std::size_t count_query = 0;
+    const auto duration_query = measure([&]() {
+        count_query = 0;
+        const DOMQuery query_signals("group/signal");
+        const DOMQuery query_source("source");
+        DOMElementList signals;
+        dom.findNodes(query_signals, signals);
+        for (const auto& signal: signals) {
+            DOMElement source;
+            if (signal.findNode(query_source, source) && !source.getData().empty() &&
+                signal.getAttribute("type") == "tUInt32") {
+                ++count_query;
+            }
+        }
+    });
+
+    std::size_t count_handle = 0;
+    const auto duration_handle = measure([&]() {
+        count_handle = 0;
+        const DOMQuery query_signals("group/signal");
+        const DOMQuery query_source("source");
+        DOMElementHandleList signals;
+        DOMElementHandle(dom.getRoot()).findNodes(query_signals, signals);
+        for (const auto& signal: signals) {
+            DOMElementHandle source;
+            if (signal.findNode(query_source, source) && *source.getData() != '\0' &&
+                std::strcmp(signal.getAttribute("type"), "tUInt32") == 0) {
+                ++count_handle;
+            }
+        }
+    });
+
+    EXPECT_EQ(count_compiled, 5000U);
+    EXPECT_EQ(count_string, count_compiled);
+    EXPECT_EQ(count_query, count_compiled);
+    EXPECT_EQ(count_handle, count_compiled);
+    std::cout << "compiled per call:     " << duration_compiled.count() << " ns" << std::endl;
+    std::cout << "query string (cached): " << duration_string.count() << " ns" << std::endl;
+    std::cout << "DOMQuery:              " << duration_query.count() << " ns" << std::endl;
+    std::cout << "DOMElementHandle:      " << duration_handle.count() << " ns" << std::endl;
+}